@@ -224,6 +224,9 @@ private:
   LpFragmenter m_fragmenter;
   LpReassembler m_reassembler;
   lp::Sequence m_lastSeqNo;
+
+  // falls back to the send path, and initializes GenericLinkServiceCounters
+  friend class InternalLinkService;
 };
 
 inline const GenericLinkService::Options&
@@ -24,7 +24,7 @@
  */
 
 #include "internal-face.hpp"
-#include "generic-link-service.hpp"
+#include "internal-link-service.hpp"
 #include "internal-transport.hpp"
 #include "core/global-io.hpp"
 
@@ -34,10 +34,7 @@ namespace face {
 std::tuple<shared_ptr<Face>, shared_ptr<ndn::Face>>
 makeInternalFace(ndn::KeyChain& clientKeyChain)
 {
-  GenericLinkService::Options serviceOpts;
-  serviceOpts.allowLocalFields = true;
-
-  auto face = make_shared<Face>(make_unique<GenericLinkService>(serviceOpts),
+  auto face = make_shared<Face>(make_unique<InternalLinkService>(),
                                 make_unique<InternalForwarderTransport>());
 
   auto forwarderTransport = static_cast<InternalForwarderTransport*>(face->getTransport());
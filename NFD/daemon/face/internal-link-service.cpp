@@ -0,0 +1,120 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "internal-link-service.hpp"
+
+namespace nfd {
+namespace face {
+
+NFD_LOG_INIT("InternalLinkService");
+
+static GenericLinkService::Options
+makeOptions()
+{
+  GenericLinkService::Options options;
+  options.allowLocalFields = true;
+  return options;
+}
+
+/** \return a shared pointer to packet, or to a copy if packet is not owned by a shared_ptr
+ */
+template<typename Packet>
+static shared_ptr<const Packet>
+getSharedPacket(const Packet& packet)
+{
+  try {
+    return packet.shared_from_this();
+  }
+  catch (const std::bad_weak_ptr&) {
+    return make_shared<Packet>(packet);
+  }
+}
+
+InternalLinkService::InternalLinkService()
+  : GenericLinkServiceCounters(m_reassembler) // virtual base, initialized as in GenericLinkService
+  , GenericLinkService(makeOptions())
+{
+}
+
+void
+InternalLinkService::receiveInterestFromClient(const Interest& interest)
+{
+  NFD_LOG_FACE_TRACE(__func__);
+
+  this->receiveInterest(interest);
+}
+
+void
+InternalLinkService::receiveDataFromClient(const Data& data)
+{
+  NFD_LOG_FACE_TRACE(__func__);
+
+  this->receiveData(data);
+}
+
+void
+InternalLinkService::receiveNackFromClient(const lp::Nack& nack)
+{
+  NFD_LOG_FACE_TRACE(__func__);
+
+  this->receiveNack(nack);
+}
+
+void
+InternalLinkService::doSendInterest(const Interest& interest)
+{
+  if (afterSendInterestToClient.isEmpty()) {
+    GenericLinkService::doSendInterest(interest);
+    return;
+  }
+
+  this->afterSendInterestToClient(getSharedPacket(interest));
+}
+
+void
+InternalLinkService::doSendData(const Data& data)
+{
+  if (afterSendDataToClient.isEmpty()) {
+    GenericLinkService::doSendData(data);
+    return;
+  }
+
+  this->afterSendDataToClient(getSharedPacket(data));
+}
+
+void
+InternalLinkService::doSendNack(const ndn::lp::Nack& nack)
+{
+  if (afterSendNackToClient.isEmpty()) {
+    GenericLinkService::doSendNack(nack);
+    return;
+  }
+
+  // Nack is not owned by a shared_ptr: the forwarder creates it on the stack
+  this->afterSendNackToClient(make_shared<lp::Nack>(nack));
+}
+
+} // namespace face
+} // namespace nfd
@@ -0,0 +1,91 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FACE_INTERNAL_LINK_SERVICE_HPP
+#define NFD_DAEMON_FACE_INTERNAL_LINK_SERVICE_HPP
+
+#include "generic-link-service.hpp"
+
+namespace nfd {
+namespace face {
+
+/** \brief GenericLinkService that exchanges packets with an InternalClientTransport
+ *         without encoding them
+ *
+ *  Interests, Data, and Nacks are passed as objects, together with their tags, between
+ *  the forwarder and a client whose InternalClientTransport is connected to this face and
+ *  has receive packet callbacks.  Otherwise, packets are sent and received in wire format
+ *  as by GenericLinkService with local fields allowed.
+ *
+ *  \warning Packets are shared between the forwarder and the client,
+ *           and must not be modified after they have been sent.
+ */
+class InternalLinkService : public GenericLinkService
+{
+public:
+  InternalLinkService();
+
+  /** \brief delivers an Interest sent by the client to forwarding
+   */
+  void
+  receiveInterestFromClient(const Interest& interest);
+
+  /** \brief delivers a Data sent by the client to forwarding
+   */
+  void
+  receiveDataFromClient(const Data& data);
+
+  /** \brief delivers a Nack sent by the client to forwarding
+   */
+  void
+  receiveNackFromClient(const lp::Nack& nack);
+
+  /** \brief signals on Interest sent to the client without encoding
+   */
+  signal::Signal<InternalLinkService, shared_ptr<const Interest>> afterSendInterestToClient;
+
+  /** \brief signals on Data sent to the client without encoding
+   */
+  signal::Signal<InternalLinkService, shared_ptr<const Data>> afterSendDataToClient;
+
+  /** \brief signals on Nack sent to the client without encoding
+   */
+  signal::Signal<InternalLinkService, shared_ptr<const lp::Nack>> afterSendNackToClient;
+
+private:
+  void
+  doSendInterest(const Interest& interest) DECL_OVERRIDE;
+
+  void
+  doSendData(const Data& data) DECL_OVERRIDE;
+
+  void
+  doSendNack(const ndn::lp::Nack& nack) DECL_OVERRIDE;
+};
+
+} // namespace face
+} // namespace nfd
+
+#endif // NFD_DAEMON_FACE_INTERNAL_LINK_SERVICE_HPP
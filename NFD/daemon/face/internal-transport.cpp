@@ -24,6 +24,8 @@
  */
 
 #include "internal-transport.hpp"
+#include "internal-link-service.hpp"
+#include "face.hpp"
 #include "core/global-io.hpp"
 
 namespace nfd {
@@ -90,6 +92,20 @@ asyncReceive(InternalTransportBase* recipient, const Block& packet)
   });
 }
 
+/** \return whether the forwarder-side face is still there and not closed
+ */
+static bool
+isOpen(const weak_ptr<const Face>& weakFace)
+{
+  shared_ptr<const Face> face = weakFace.lock();
+  return face != nullptr && face->getState() != FaceState::CLOSED;
+}
+
+InternalClientTransport::InternalClientTransport()
+  : m_linkService(nullptr)
+{
+}
+
 void
 InternalClientTransport::connectToForwarder(InternalForwarderTransport* forwarderTransport)
 {
@@ -98,8 +114,17 @@ InternalClientTransport::connectToForwarder(InternalForwarderTransport* forwarde
   m_fwToClientTransmitConn.disconnect();
   m_clientToFwTransmitConn.disconnect();
   m_fwTransportStateConn.disconnect();
+  m_linkService = nullptr;
+  m_linkServiceFace.reset();
+  this->connectToLinkService();
 
   if (forwarderTransport != nullptr) {
+    m_linkService = dynamic_cast<InternalLinkService*>(forwarderTransport->getLinkService());
+    if (m_linkService != nullptr) {
+      m_linkServiceFace = forwarderTransport->getFace()->shared_from_this();
+    }
+    this->connectToLinkService();
+
     m_fwToClientTransmitConn = forwarderTransport->afterSend.connect(bind(&asyncReceive, this, _1));
     m_clientToFwTransmitConn = this->afterSend.connect(bind(&asyncReceive, forwarderTransport, _1));
     m_fwTransportStateConn = forwarderTransport->afterStateChange.connect(
@@ -135,5 +160,103 @@ InternalClientTransport::send(const Block& header, const Block& payload)
   this->send(encoder.block());
 }
 
+void
+InternalClientTransport::setReceivePacketCallbacks(const ReceiveInterestCallback& receiveInterest,
+                                                   const ReceiveDataCallback& receiveData,
+                                                   const ReceiveNackCallback& receiveNack)
+{
+  m_receiveInterestCallback = receiveInterest;
+  m_receiveDataCallback = receiveData;
+  m_receiveNackCallback = receiveNack;
+  this->connectToLinkService();
+}
+
+void
+InternalClientTransport::connectToLinkService()
+{
+  m_fwToClientInterestConn.disconnect();
+  m_fwToClientDataConn.disconnect();
+  m_fwToClientNackConn.disconnect();
+
+  if (!this->canSendPackets() || m_receiveInterestCallback == nullptr ||
+      m_receiveDataCallback == nullptr || m_receiveNackCallback == nullptr) {
+    return;
+  }
+
+  // as asyncReceive, deliver packets after the sender has returned,
+  // unless the client has gone away in the meantime;
+  // throws std::bad_weak_ptr if this transport is not owned by a shared_ptr
+  weak_ptr<InternalClientTransport> self = this->shared_from_this();
+  m_fwToClientInterestConn = m_linkService->afterSendInterestToClient.connect(
+    [self] (const shared_ptr<const Interest>& interest) {
+      getGlobalIoService().post([self, interest] {
+        shared_ptr<InternalClientTransport> transport = self.lock();
+        if (transport != nullptr && transport->m_receiveInterestCallback != nullptr) {
+          transport->m_receiveInterestCallback(interest);
+        }
+      });
+    });
+  m_fwToClientDataConn = m_linkService->afterSendDataToClient.connect(
+    [self] (const shared_ptr<const Data>& data) {
+      getGlobalIoService().post([self, data] {
+        shared_ptr<InternalClientTransport> transport = self.lock();
+        if (transport != nullptr && transport->m_receiveDataCallback != nullptr) {
+          transport->m_receiveDataCallback(data);
+        }
+      });
+    });
+  m_fwToClientNackConn = m_linkService->afterSendNackToClient.connect(
+    [self] (const shared_ptr<const lp::Nack>& nack) {
+      getGlobalIoService().post([self, nack] {
+        shared_ptr<InternalClientTransport> transport = self.lock();
+        if (transport != nullptr && transport->m_receiveNackCallback != nullptr) {
+          transport->m_receiveNackCallback(nack);
+        }
+      });
+    });
+}
+
+void
+InternalClientTransport::sendInterest(shared_ptr<const Interest> interest)
+{
+  BOOST_ASSERT(this->canSendPackets());
+
+  InternalLinkService* linkService = m_linkService;
+  weak_ptr<const Face> weakFace = m_linkServiceFace;
+  getGlobalIoService().post([linkService, weakFace, interest] {
+    if (isOpen(weakFace)) { // forwarder may have closed the face
+      linkService->receiveInterestFromClient(*interest);
+    }
+  });
+}
+
+void
+InternalClientTransport::sendData(shared_ptr<const Data> data)
+{
+  BOOST_ASSERT(this->canSendPackets());
+
+  InternalLinkService* linkService = m_linkService;
+  weak_ptr<const Face> weakFace = m_linkServiceFace;
+  getGlobalIoService().post([linkService, weakFace, data] {
+    if (isOpen(weakFace)) { // forwarder may have closed the face
+      linkService->receiveDataFromClient(*data);
+    }
+  });
+}
+
+void
+InternalClientTransport::sendNack(shared_ptr<const lp::Nack> nack)
+{
+  BOOST_ASSERT(this->canSendPackets());
+
+  InternalLinkService* linkService = m_linkService;
+  weak_ptr<const Face> weakFace = m_linkServiceFace;
+  getGlobalIoService().post([linkService, weakFace, nack] {
+    if (isOpen(weakFace)) { // forwarder may have closed the face
+      linkService->receiveNackFromClient(*nack);
+    }
+  });
+}
+
 } // namespace face
 } // namespace nfd
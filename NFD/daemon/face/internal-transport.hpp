@@ -76,11 +76,22 @@ private:
   NFD_LOG_INCLASS_DECLARE();
 };
 
+class InternalLinkService;
+
 /** \brief implements a client-side transport that can be paired with another
+ *  \note This transport must be owned by a shared_ptr: packets posted to it hold a weak_ptr,
+ *        so that they are dropped if the transport has gone away in the meantime.
  */
 class InternalClientTransport : public ndn::Transport, public InternalTransportBase
+                              , public enable_shared_from_this<InternalClientTransport>
 {
 public:
+  typedef function<void(shared_ptr<const Interest>)> ReceiveInterestCallback;
+  typedef function<void(shared_ptr<const Data>)> ReceiveDataCallback;
+  typedef function<void(shared_ptr<const lp::Nack>)> ReceiveNackCallback;
+
+  InternalClientTransport();
+
   /** \brief connect to a forwarder-side transport
    *  \param forwarderTransport the forwarder-side transport to connect to; may be nullptr
    *
@@ -88,6 +99,8 @@ public:
    *  is called again, or if that transport is closed.
    *  It's safe to use InternalClientTransport without a connected forwarder-side transport:
    *  all sent packets would be lost, and nothing would be received.
+   *  \pre this transport is owned by a shared_ptr if receive packet callbacks are set,
+   *       otherwise std::bad_weak_ptr is thrown
    */
   void
   connectToForwarder(InternalForwarderTransport* forwarderTransport);
@@ -116,14 +129,71 @@ public:
   virtual void
   send(const Block& header, const Block& payload) DECL_OVERRIDE;
 
+public: // packets exchanged with InternalLinkService without encoding
+  /** \brief set callbacks to receive packets as objects
+   *
+   *  If the connected forwarder-side face has an InternalLinkService, packets it sends
+   *  are passed to these callbacks without being encoded; otherwise, or without these
+   *  callbacks, packets are received in wire format.
+   *  \pre this transport is owned by a shared_ptr if connected to an InternalLinkService,
+   *       otherwise std::bad_weak_ptr is thrown
+   */
+  void
+  setReceivePacketCallbacks(const ReceiveInterestCallback& receiveInterest,
+                            const ReceiveDataCallback& receiveData,
+                            const ReceiveNackCallback& receiveNack);
+
+  /** \return whether the connected forwarder-side face has an InternalLinkService,
+   *          so that sendInterest, sendData, and sendNack can be used
+   */
+  bool
+  canSendPackets() const;
+
+  /** \brief send an Interest to the forwarder without encoding it
+   *  \pre canSendPackets()
+   */
+  void
+  sendInterest(shared_ptr<const Interest> interest);
+
+  /** \brief send a Data to the forwarder without encoding it
+   *  \pre canSendPackets()
+   */
+  void
+  sendData(shared_ptr<const Data> data);
+
+  /** \brief send a Nack to the forwarder without encoding it
+   *  \pre canSendPackets()
+   */
+  void
+  sendNack(shared_ptr<const lp::Nack> nack);
+
+private:
+  void
+  connectToLinkService();
+
 private:
   NFD_LOG_INCLASS_DECLARE();
 
   signal::ScopedConnection m_fwToClientTransmitConn;
   signal::ScopedConnection m_clientToFwTransmitConn;
   signal::ScopedConnection m_fwTransportStateConn;
+
+  InternalLinkService* m_linkService;
+  weak_ptr<const Face> m_linkServiceFace; ///< owner of m_linkService, to detect its destruction
+  ReceiveInterestCallback m_receiveInterestCallback;
+  ReceiveDataCallback m_receiveDataCallback;
+  ReceiveNackCallback m_receiveNackCallback;
+  signal::ScopedConnection m_fwToClientInterestConn;
+  signal::ScopedConnection m_fwToClientDataConn;
+  signal::ScopedConnection m_fwToClientNackConn;
 };
 
+inline bool
+InternalClientTransport::canSendPackets() const
+{
+  return m_linkService != nullptr && !m_linkServiceFace.expired();
+}
+
 } // namespace face
 } // namespace nfd
 
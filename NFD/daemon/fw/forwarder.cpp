@@ -27,8 +27,13 @@
 #include "core/logger.hpp"
 #include "core/random.hpp"
 #include "strategy.hpp"
+#include "best-route-strategy2.hpp"
+#include "multicast-strategy.hpp"
+#include "ncc-strategy.hpp"
 #include "face/null-face.hpp"
 
+#include <typeinfo>
+
 #include "utils/ndn-ns3-packet-tag.hpp"
 
 #include <boost/random/uniform_int_distribution.hpp>
@@ -41,6 +46,120 @@ using fw::Strategy;
 
 const Name Forwarder::LOCALHOST_NAME("ndn:/localhost");
 
+/** \brief strategies whose triggers are invoked without virtual function calls
+ *         in fixed strategy dispatch mode
+ *
+ *  Only exact types are listed, so that subclasses (e.g. BroadcastStrategy derived
+ *  from MulticastStrategy) keep their own overrides.
+ */
+enum StrategyKind {
+  STRATEGY_KIND_OTHER = 0,
+  STRATEGY_KIND_BEST_ROUTE2,
+  STRATEGY_KIND_MULTICAST,
+  STRATEGY_KIND_NCC
+};
+
+static StrategyKind
+getStrategyKind(const Strategy& strategy)
+{
+  const std::type_info& type = typeid(strategy);
+  if (type == typeid(fw::BestRouteStrategy2)) {
+    return STRATEGY_KIND_BEST_ROUTE2;
+  }
+  if (type == typeid(fw::MulticastStrategy)) {
+    return STRATEGY_KIND_MULTICAST;
+  }
+  if (type == typeid(fw::NccStrategy)) {
+    return STRATEGY_KIND_NCC;
+  }
+  return STRATEGY_KIND_OTHER;
+}
+
+/** \brief strategy triggers passed to dispatchToStrategy
+ *
+ *  When invoked with a pointer to a concrete strategy type S, the trigger is called
+ *  as S::trigger, which binds statically and can be inlined.
+ */
+struct AfterReceiveInterestTrigger
+{
+  const Face& inFace;
+  const Interest& interest;
+  const shared_ptr<fib::Entry>& fibEntry;
+  const shared_ptr<pit::Entry>& pitEntry;
+
+  void
+  operator()(Strategy* strategy) const
+  {
+    strategy->afterReceiveInterest(inFace, interest, fibEntry, pitEntry);
+  }
+
+  template<class S>
+  void
+  operator()(S* strategy) const
+  {
+    strategy->S::afterReceiveInterest(inFace, interest, fibEntry, pitEntry);
+  }
+};
+
+struct BeforeSatisfyInterestTrigger
+{
+  const shared_ptr<pit::Entry>& pitEntry;
+  const Face& inFace;
+  const Data& data;
+
+  void
+  operator()(Strategy* strategy) const
+  {
+    strategy->beforeSatisfyInterest(pitEntry, inFace, data);
+  }
+
+  template<class S>
+  void
+  operator()(S* strategy) const
+  {
+    strategy->S::beforeSatisfyInterest(pitEntry, inFace, data);
+  }
+};
+
+struct BeforeExpirePendingInterestTrigger
+{
+  const shared_ptr<pit::Entry>& pitEntry;
+
+  void
+  operator()(Strategy* strategy) const
+  {
+    strategy->beforeExpirePendingInterest(pitEntry);
+  }
+
+  template<class S>
+  void
+  operator()(S* strategy) const
+  {
+    strategy->S::beforeExpirePendingInterest(pitEntry);
+  }
+};
+
+struct AfterReceiveNackTrigger
+{
+  const Face& inFace;
+  const lp::Nack& nack;
+  const shared_ptr<fib::Entry>& fibEntry;
+  const shared_ptr<pit::Entry>& pitEntry;
+
+  void
+  operator()(Strategy* strategy) const
+  {
+    strategy->afterReceiveNack(inFace, nack, fibEntry, pitEntry);
+  }
+
+  template<class S>
+  void
+  operator()(S* strategy) const
+  {
+    strategy->S::afterReceiveNack(inFace, nack, fibEntry, pitEntry);
+  }
+};
+
 Forwarder::Forwarder()
   : m_faceTable(*this)
   , m_fib(m_nameTree)
@@ -48,6 +167,7 @@ Forwarder::Forwarder()
   , m_measurements(m_nameTree)
   , m_strategyChoice(m_nameTree, fw::makeDefaultStrategy(*this))
   , m_csFace(face::makeNullFace(FaceUri("contentstore://")))
+  , m_isFixedStrategyDispatchEnabled(false)
 {
   fw::installStrategies(*this);
   getFaceTable().addReserved(m_csFace, face::FACEID_CONTENT_STORE);
@@ -57,6 +177,63 @@ Forwarder::~Forwarder()
 {
 }
 
+void
+Forwarder::setFixedStrategyDispatch(bool isEnabled)
+{
+  NFD_LOG_INFO("setFixedStrategyDispatch " << isEnabled);
+  m_isFixedStrategyDispatchEnabled = isEnabled;
+}
+
+Strategy&
+Forwarder::findEffectiveStrategy(pit::Entry& pitEntry)
+{
+  if (!m_isFixedStrategyDispatchEnabled) {
+    return m_strategyChoice.findEffectiveStrategy(pitEntry);
+  }
+
+  if (pitEntry.m_strategy == nullptr ||
+      pitEntry.m_strategyVersion != m_strategyChoice.getVersion()) {
+    pitEntry.m_strategy = &m_strategyChoice.findEffectiveStrategy(pitEntry);
+    pitEntry.m_strategyVersion = m_strategyChoice.getVersion();
+    pitEntry.m_strategyKind = getStrategyKind(*pitEntry.m_strategy);
+  }
+  return *pitEntry.m_strategy;
+}
+
+#ifdef WITH_TESTS
+void
+Forwarder::dispatchToStrategy(shared_ptr<pit::Entry> pitEntry, function<void(Strategy*)> trigger)
+{
+  trigger(&this->findEffectiveStrategy(*pitEntry));
+}
+#else
+template<class Function>
+void
+Forwarder::dispatchToStrategy(shared_ptr<pit::Entry> pitEntry, Function trigger)
+{
+  Strategy& strategy = this->findEffectiveStrategy(*pitEntry);
+  if (!m_isFixedStrategyDispatchEnabled) {
+    trigger(&strategy);
+    return;
+  }
+
+  switch (pitEntry->m_strategyKind) {
+  case STRATEGY_KIND_BEST_ROUTE2:
+    trigger(static_cast<fw::BestRouteStrategy2*>(&strategy));
+    break;
+  case STRATEGY_KIND_MULTICAST:
+    trigger(static_cast<fw::MulticastStrategy*>(&strategy));
+    break;
+  case STRATEGY_KIND_NCC:
+    trigger(static_cast<fw::NccStrategy*>(&strategy));
+    break;
+  default:
+    trigger(&strategy);
+    break;
+  }
+}
+#endif // WITH_TESTS
+
 void
 Forwarder::startProcessInterest(Face& face, const Interest& interest)
 {
@@ -151,16 +328,26 @@ Forwarder::onIncomingInterest(Face& inFace, const Interest& interest)
   bool isPending = inRecords.begin() != inRecords.end();
   if (!isPending) {
     if (m_csFromNdnSim == nullptr) {
+      // lambdas instead of bind: Cs::find takes them as is, without wrapping into std::function
       m_cs.find(interest,
-                bind(&Forwarder::onContentStoreHit, this, ref(inFace), pitEntry, _1, _2),
-                bind(&Forwarder::onContentStoreMiss, this, ref(inFace), pitEntry, _1));
+                [this, &inFace, pitEntry, &interest] (const Interest&, const Data& data) {
+                  this->afterCsHit(interest, data);
+                  this->onContentStoreHit(inFace, pitEntry, interest, data);
+                },
+                [this, &inFace, pitEntry, &interest] (const Interest&) {
+                  this->afterCsMiss(interest);
+                  this->onContentStoreMiss(inFace, pitEntry, interest);
+                });
     }
     else {
-      shared_ptr<Data> match = m_csFromNdnSim->Lookup(interest.shared_from_this());
+      // legacy ContentStore enabled with StackHelper::SetOldContentStore
+      shared_ptr<const Data> match = m_csFromNdnSim->Lookup(interest.shared_from_this());
       if (match != nullptr) {
+        this->afterCsHit(interest, *match);
         this->onContentStoreHit(inFace, pitEntry, interest, *match);
       }
       else {
+        this->afterCsMiss(interest);
         this->onContentStoreMiss(inFace, pitEntry, interest);
       }
     }
@@ -255,8 +442,8 @@ Forwarder::onContentStoreMiss(const Face& inFace,
 
   // dispatch to strategy
   BOOST_ASSERT(fibEntry != nullptr);
-  this->dispatchToStrategy(pitEntry, bind(&Strategy::afterReceiveInterest, _1,
-                                          cref(inFace), cref(interest), fibEntry, pitEntry));
+  this->dispatchToStrategy(pitEntry,
+                           AfterReceiveInterestTrigger{inFace, interest, fibEntry, pitEntry});
 }
 
 void
@@ -268,8 +455,7 @@ Forwarder::onContentStoreHit(const Face& inFace,
   NFD_LOG_DEBUG("onContentStoreHit interest=" << interest.getName());
 
   beforeSatisfyInterest(*pitEntry, *m_csFace, data);
-  this->dispatchToStrategy(pitEntry, bind(&Strategy::beforeSatisfyInterest, _1,
-                                          pitEntry, cref(*m_csFace), cref(data)));
+  this->dispatchToStrategy(pitEntry, BeforeSatisfyInterestTrigger{pitEntry, *m_csFace, data});
 
   data.setTag(make_shared<lp::IncomingFaceIdTag>(face::FACEID_CONTENT_STORE));
   // XXX should we lookup PIT for other Interests that also match csMatch?
@@ -390,8 +576,7 @@ Forwarder::onInterestUnsatisfied(shared_ptr<pit::Entry> pitEntry)
 
   // invoke PIT unsatisfied callback
   beforeExpirePendingInterest(*pitEntry);
-  this->dispatchToStrategy(pitEntry, bind(&Strategy::beforeExpirePendingInterest, _1,
-                                          pitEntry));
+  this->dispatchToStrategy(pitEntry, BeforeExpirePendingInterestTrigger{pitEntry});
 
   // goto Interest Finalize pipeline
   this->onInterestFinalize(pitEntry, false);
@@ -471,8 +656,7 @@ Forwarder::onIncomingData(Face& inFace, const Data& data)
 
     // invoke PIT satisfy callback
     beforeSatisfyInterest(*pitEntry, inFace, data);
-    this->dispatchToStrategy(pitEntry, bind(&Strategy::beforeSatisfyInterest, _1,
-                                            pitEntry, cref(inFace), cref(data)));
+    this->dispatchToStrategy(pitEntry, BeforeSatisfyInterestTrigger{pitEntry, inFace, data});
 
     // Dead Nonce List insert if necessary (for OutRecord of inFace)
     this->insertDeadNonceList(*pitEntry, true, data.getFreshnessPeriod(), &inFace);
@@ -592,8 +776,8 @@ Forwarder::onIncomingNack(Face& inFace, const lp::Nack& nack)
 
   // trigger strategy: after receive NACK
   shared_ptr<fib::Entry> fibEntry = m_fib.findLongestPrefixMatch(*pitEntry);
-  this->dispatchToStrategy(pitEntry, bind(&Strategy::afterReceiveNack, _1,
-                                          cref(inFace), cref(nack), fibEntry, pitEntry));
+  this->dispatchToStrategy(pitEntry,
+                           AfterReceiveNackTrigger{inFace, nack, fibEntry, pitEntry});
 }
 
 void
@@ -686,7 +870,7 @@ Forwarder::cancelUnsatisfyAndStragglerTimer(shared_ptr<pit::Entry> pitEntry)
 }
 
 static inline void
-insertNonceToDnl(DeadNonceList& dnl, const pit::Entry& pitEntry,
+insertNonceToDnl(Forwarder::DeadNonceTable& dnl, const pit::Entry& pitEntry,
                  const pit::OutRecord& outRecord)
 {
   dnl.add(pitEntry.getName(), outRecord.getLastNonce());
@@ -36,6 +36,7 @@
 #include "table/measurements.hpp"
 #include "table/strategy-choice.hpp"
 #include "table/dead-nonce-list.hpp"
+#include "table/cuckoo-dead-nonce-list.hpp"
 #include "table/network-region-table.hpp"
 
 #include "ns3/ndnSIM/model/cs/ndn-content-store.hpp"
@@ -55,6 +56,12 @@ class NullFace;
 class Forwarder
 {
 public:
+#ifdef NFD_CUCKOO_DEAD_NONCE_LIST
+  typedef CuckooDeadNonceList DeadNonceTable;
+#else
+  typedef DeadNonceList DeadNonceTable;
+#endif // NFD_CUCKOO_DEAD_NONCE_LIST
+
   Forwarder();
 
   VIRTUAL_WITH_TESTS
@@ -121,12 +128,27 @@ public: // forwarding entrypoints and tables
   StrategyChoice&
   getStrategyChoice();
 
-  DeadNonceList&
+  DeadNonceTable&
   getDeadNonceList();
 
   NetworkRegionTable&
   getNetworkRegionTable();
 
+public: // strategy dispatch
+  /** \brief enable or disable fixed strategy dispatch
+   *
+   *  In this mode, the effective strategy of a PIT entry is looked up once and cached
+   *  in the entry until the Strategy Choice table changes, and triggers of best-route,
+   *  multicast, and ncc strategies are invoked without virtual function calls.
+   *  It is intended for simulations that choose strategies at startup;
+   *  later changes of strategy choice remain effective, but discard the cached lookups.
+   */
+  void
+  setFixedStrategyDispatch(bool isEnabled);
+
+  bool
+  isFixedStrategyDispatchEnabled() const;
+
 public: // allow enabling ndnSIM content store (will be removed in the future)
   void
   setCsFromNdnSim(ns3::Ptr<ns3::ndn::ContentStore> cs);
@@ -142,6 +164,16 @@ public:
    */
   signal::Signal<Forwarder, pit::Entry> beforeExpirePendingInterest;
 
+  /** \brief trigger after a ContentStore lookup finds a matching Data
+   *  \note fired for both NFD's ContentStore and the one from ndnSIM
+   */
+  signal::Signal<Forwarder, Interest, Data> afterCsHit;
+
+  /** \brief trigger after a ContentStore lookup finds no match
+   *  \note not fired for Interests that are already pending, as they skip the lookup
+   */
+  signal::Signal<Forwarder, Interest> afterCsMiss;
+
 PUBLIC_WITH_TESTS_ELSE_PRIVATE: // pipelines
   /** \brief incoming Interest pipeline
    */
@@ -243,6 +275,14 @@ PROTECTED_WITH_TESTS_ELSE_PRIVATE:
   dispatchToStrategy(shared_ptr<pit::Entry> pitEntry, Function trigger);
 #endif
 
+private:
+  /** \brief get effective strategy of pitEntry
+   *
+   *  In fixed strategy dispatch mode, the result is cached in pitEntry.
+   */
+  fw::Strategy&
+  findEffectiveStrategy(pit::Entry& pitEntry);
+
 private:
   ForwarderCounters m_counters;
 
@@ -255,12 +295,14 @@ private:
   Cs                 m_cs;
   Measurements       m_measurements;
   StrategyChoice     m_strategyChoice;
-  DeadNonceList      m_deadNonceList;
+  DeadNonceTable     m_deadNonceList;
   NetworkRegionTable m_networkRegionTable;
   shared_ptr<Face>   m_csFace;
 
   ns3::Ptr<ns3::ndn::ContentStore> m_csFromNdnSim;
 
+  bool m_isFixedStrategyDispatchEnabled;
+
   static const Name LOCALHOST_NAME;
 
   // allow Strategy (base class) to enter pipelines
@@ -327,7 +369,7 @@ Forwarder::getStrategyChoice()
   return m_strategyChoice;
 }
 
-inline DeadNonceList&
+inline Forwarder::DeadNonceTable&
 Forwarder::getDeadNonceList()
 {
   return m_deadNonceList;
@@ -339,23 +381,16 @@ Forwarder::getNetworkRegionTable()
   return m_networkRegionTable;
 }
 
-inline void
-Forwarder::setCsFromNdnSim(ns3::Ptr<ns3::ndn::ContentStore> cs)
+inline bool
+Forwarder::isFixedStrategyDispatchEnabled() const
 {
-  m_csFromNdnSim = cs;
+  return m_isFixedStrategyDispatchEnabled;
 }
 
-#ifdef WITH_TESTS
-inline void
-Forwarder::dispatchToStrategy(shared_ptr<pit::Entry> pitEntry, function<void(fw::Strategy*)> trigger)
-#else
-template<class Function>
 inline void
-Forwarder::dispatchToStrategy(shared_ptr<pit::Entry> pitEntry, Function trigger)
-#endif
+Forwarder::setCsFromNdnSim(ns3::Ptr<ns3::ndn::ContentStore> cs)
 {
-  fw::Strategy& strategy = m_strategyChoice.findEffectiveStrategy(*pitEntry);
-  trigger(&strategy);
+  m_csFromNdnSim = cs;
 }
 
 } // namespace nfd
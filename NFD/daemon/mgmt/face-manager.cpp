@@ -403,6 +403,9 @@ FaceManager::afterFaceAdded(shared_ptr<Face> face,
   collectFaceProperties(*face, notification);
 
   post(notification.wireEncode());
+
+  m_faceStateChangeConn[face->getId()] = face->afterStateChange.connect(
+    bind(&FaceManager::afterFaceStateChanged, this, face->getId(), _2, post));
 }
 
 void
@@ -414,6 +417,33 @@ FaceManager::afterFaceRemoved(shared_ptr<Face> face,
   collectFaceProperties(*face, notification);
 
   post(notification.wireEncode());
+
+  m_faceStateChangeConn.erase(face->getId());
+}
+
+void
+FaceManager::afterFaceStateChanged(FaceId faceId, face::FaceState newState,
+                                   const ndn::mgmt::PostNotification& post)
+{
+  ndn::nfd::FaceEventNotification notification;
+  if (newState == face::FaceState::UP) {
+    notification.setKind(ndn::nfd::FACE_EVENT_UP);
+  }
+  else if (newState == face::FaceState::DOWN) {
+    notification.setKind(ndn::nfd::FACE_EVENT_DOWN);
+  }
+  else {
+    // closing and failed faces are notified as destroyed
+    return;
+  }
+
+  shared_ptr<Face> face = m_faceTable.get(faceId);
+  if (face == nullptr) {
+    return;
+  }
+  collectFaceProperties(*face, notification);
+
+  post(notification.wireEncode());
 }
 
 void
@@ -128,6 +128,12 @@ private: // NotificationStream
   afterFaceRemoved(shared_ptr<Face> face,
                    const ndn::mgmt::PostNotification& post);
 
+  /** \brief notify FACE_EVENT_UP or FACE_EVENT_DOWN when the face goes up or down
+   */
+  void
+  afterFaceStateChanged(FaceId faceId, face::FaceState newState,
+                        const ndn::mgmt::PostNotification& post);
+
 private: // configuration
   void
   processConfig(const ConfigSection& configSection, bool isDryRun,
@@ -157,6 +163,7 @@ private:
   FaceTable& m_faceTable;
   signal::ScopedConnection m_faceAddConn;
   signal::ScopedConnection m_faceRemoveConn;
+  std::map<FaceId, signal::ScopedConnection> m_faceStateChangeConn;
 };
 
 } // namespace nfd
@@ -32,6 +32,8 @@
 
 #include "common.hpp"
 
+#include <unordered_map>
+
 namespace nfd {
 namespace cs {
 
@@ -40,6 +42,13 @@ class EntryImpl;
 typedef std::set<EntryImpl> Table;
 typedef Table::const_iterator iterator;
 
+/** \brief maps hash of Data Name (without implicit digest) to the leftmost Table entry
+ *         with that Name
+ *  \note Entries with equal Names are adjacent in Table, ordered by implicit digest.
+ *        Hash collisions are resolved by comparing the Name of the referenced entry.
+ */
+typedef std::unordered_multimap<size_t, iterator> ExactIndex;
+
 } // namespace cs
 } // namespace nfd
 
@@ -114,22 +114,30 @@ Cs::insert(const Data& data, bool isUnsolicited)
     m_policy->afterRefresh(it);
   }
   else {
+    this->insertExactIndex(it);
     m_policy->afterInsert(it);
   }
 }
 
-void
-Cs::find(const Interest& interest,
-         const HitCallback& hitCallback,
-         const MissCallback& missCallback) const
+iterator
+Cs::findImpl(const Interest& interest) const
 {
-  BOOST_ASSERT(static_cast<bool>(hitCallback));
-  BOOST_ASSERT(static_cast<bool>(missCallback));
-
   const Name& prefix = interest.getName();
   bool isRightmost = interest.getChildSelector() == 1;
   NFD_LOG_DEBUG("find " << prefix << (isRightmost ? " R" : " L"));
 
+  // Entries whose Name equals the Interest Name (or whose full Name equals a full-Name
+  // Interest) precede every other entry under the prefix, so a satisfying entry among them
+  // is the leftmost match and can be found through the ExactIndex.
+  if (!isRightmost) {
+    iterator exact = this->findExact(interest);
+    if (exact != m_table.end()) {
+      NFD_LOG_DEBUG("  matching-exact " << exact->getName());
+      m_policy->beforeUse(exact);
+      return exact;
+    }
+  }
+
   iterator first = m_table.lower_bound(prefix);
   iterator last = m_table.end();
   if (prefix.size() > 0) {
@@ -146,12 +154,11 @@ Cs::find(const Interest& interest,
 
   if (match == last) {
     NFD_LOG_DEBUG("  no-match");
-    missCallback(interest);
-    return;
+    return m_table.end();
   }
   NFD_LOG_DEBUG("  matching " << match->getName());
   m_policy->beforeUse(match);
-  hitCallback(interest, match->getData());
+  return match;
 }
 
 iterator
@@ -198,11 +205,103 @@ Cs::findRightmostAmongExact(const Interest& interest, iterator first, iterator l
   return find_last_if(first, last, bind(&EntryImpl::canSatisfy, _1, interest));
 }
 
+iterator
+Cs::findExact(const Interest& interest) const
+{
+  const Name& interestName = interest.getName();
+  bool isFullName = !interestName.empty() && interestName[-1].isImplicitSha256Digest();
+  Name fullNamePrefix;
+  if (isFullName) {
+    fullNamePrefix = interestName.getPrefix(-1);
+  }
+  const Name& name = isFullName ? fullNamePrefix : interestName;
+
+  auto indexIt = this->findExactIndex(name, std::hash<Name>()(name));
+  if (indexIt == m_exactIndex.end()) {
+    return m_table.end();
+  }
+
+  for (iterator it = indexIt->second; it != m_table.end() && it->getName() == name; ++it) {
+    if (isFullName && it->getFullName()[-1] != interestName[-1]) {
+      continue;
+    }
+    if (it->canSatisfy(interest)) {
+      return it;
+    }
+  }
+  return m_table.end();
+}
+
+void
+Cs::insertExactIndex(iterator it)
+{
+  const Name& name = it->getName();
+  if (it != m_table.begin() && std::prev(it)->getName() == name) {
+    // not the leftmost entry with this Name
+    return;
+  }
+
+  size_t hash = std::hash<Name>()(name);
+  auto indexIt = this->findExactIndex(name, hash);
+  if (indexIt != m_exactIndex.end()) {
+    indexIt->second = it;
+  }
+  else {
+    m_exactIndex.emplace(hash, it);
+  }
+}
+
+void
+Cs::eraseExactIndex(iterator it)
+{
+  const Name& name = it->getName();
+  if (it != m_table.begin() && std::prev(it)->getName() == name) {
+    // not the leftmost entry with this Name
+    return;
+  }
+
+  auto indexIt = this->findExactIndex(name, std::hash<Name>()(name));
+  BOOST_ASSERT(indexIt != m_exactIndex.end() && indexIt->second == it);
+
+  iterator next = std::next(it);
+  if (next != m_table.end() && next->getName() == name) {
+    indexIt->second = next;
+  }
+  else {
+    m_exactIndex.erase(indexIt);
+  }
+}
+
+ExactIndex::iterator
+Cs::findExactIndex(const Name& name, size_t hash)
+{
+  auto range = m_exactIndex.equal_range(hash);
+  for (auto indexIt = range.first; indexIt != range.second; ++indexIt) {
+    if (indexIt->second->getName() == name) {
+      return indexIt;
+    }
+  }
+  return m_exactIndex.end();
+}
+
+ExactIndex::const_iterator
+Cs::findExactIndex(const Name& name, size_t hash) const
+{
+  auto range = m_exactIndex.equal_range(hash);
+  for (auto indexIt = range.first; indexIt != range.second; ++indexIt) {
+    if (indexIt->second->getName() == name) {
+      return indexIt;
+    }
+  }
+  return m_exactIndex.end();
+}
+
 void
 Cs::setPolicyImpl(unique_ptr<Policy>& policy)
 {
   m_policy = std::move(policy);
   m_beforeEvictConnection = m_policy->beforeEvict.connect([this] (iterator it) {
+      this->eraseExactIndex(it);
       m_table.erase(it);
     });
 
@@ -35,6 +35,12 @@
  *  Each Entry contain the Data packet itself,
  *  and a few addition attributes such as the staleness of the Data packet.
  *
+ *  The Table is accompanied by an ExactIndex, a hash table keyed by Data Name
+ *  (without implicit digest) that points to the leftmost Table entry having that Name.
+ *  Leftmost lookups whose Interest Name equals a stored Data Name, or is a full Name,
+ *  are answered through the ExactIndex without walking the Table.
+ *  Prefix and selector lookups fall back to the ordered Table.
+ *
  *  The cleanup queues are three doubly linked lists which stores Table iterators.
  *  The three queues keep track of unsolicited, stale, and fresh Data packet, respectively.
  *  Table iterator is placed into, removed from, and moved between suitable queues
@@ -82,11 +88,22 @@ public:
    *  \param missCallback a callback if there's no match; must not be empty
    *  \note A lookup invokes either callback exactly once.
    *        The callback may be invoked either before or after find() returns
+   *  \note The callbacks are taken as arbitrary callables rather than HitCallback and
+   *        MissCallback, so that a lookup from the forwarding pipeline does not allocate.
    */
+  template<typename HitFunc, typename MissFunc>
   void
   find(const Interest& interest,
-       const HitCallback& hitCallback,
-       const MissCallback& missCallback) const;
+       const HitFunc& hitCallback,
+       const MissFunc& missCallback) const
+  {
+    iterator match = this->findImpl(interest);
+    if (match == m_table.end()) {
+      missCallback(interest);
+      return;
+    }
+    hitCallback(interest, match->getData());
+  }
 
   void
   erase(const Name& exactName)
@@ -159,6 +176,12 @@ public: // enumeration
   }
 
 private: // find
+  /** \brief find the best matching Data packet and notify the policy of its use
+   *  \return the match, or m_table.end() if not found
+   */
+  iterator
+  findImpl(const Interest& interest) const;
+
   /** \brief find leftmost match in [first,last)
    *  \return the leftmost match, or last if not found
    */
@@ -177,11 +200,39 @@ private: // find
   iterator
   findRightmostAmongExact(const Interest& interest, iterator first, iterator last) const;
 
+  /** \brief find leftmost match among entries whose Name equals Interest Name,
+   *         or whose full Name equals Interest Name if it ends with an implicit digest
+   *  \return the leftmost match, or m_table.end() if not found
+   */
+  iterator
+  findExact(const Interest& interest) const;
+
+private: // exact index
+  /** \brief records a newly inserted Table entry in the ExactIndex
+   */
+  void
+  insertExactIndex(iterator it);
+
+  /** \brief removes a Table entry from the ExactIndex before it is erased
+   */
+  void
+  eraseExactIndex(iterator it);
+
+  /** \return ExactIndex position of the leftmost entry with \p name,
+   *          or m_exactIndex.end() if not found
+   */
+  ExactIndex::iterator
+  findExactIndex(const Name& name, size_t hash);
+
+  ExactIndex::const_iterator
+  findExactIndex(const Name& name, size_t hash) const;
+
   void
   setPolicyImpl(unique_ptr<Policy>& policy);
 
 private:
   Table m_table;
+  ExactIndex m_exactIndex;
   unique_ptr<Policy> m_policy;
   ndn::util::signal::ScopedConnection m_beforeEvictConnection;
 };
@@ -0,0 +1,325 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "cuckoo-dead-nonce-list.hpp"
+#include "core/city-hash.hpp"
+#include "core/logger.hpp"
+
+#include <cmath>
+
+NFD_LOG_INIT("CuckooDeadNonceList");
+
+namespace nfd {
+namespace dnl {
+
+const size_t CuckooFilter::SLOTS_PER_BUCKET = 4;
+const size_t CuckooFilter::MAX_KICKS = 500;
+
+CuckooFilter::CuckooFilter(size_t nBuckets, size_t fingerprintBits)
+  : m_nBuckets(nBuckets)
+  , m_width((fingerprintBits + 7) / 8)
+  , m_mask(fingerprintBits >= 32 ? 0xFFFFFFFF : ((Fingerprint(1) << fingerprintBits) - 1))
+  , m_table(nBuckets * SLOTS_PER_BUCKET * m_width, 0)
+  , m_nEntries(0)
+  , m_random(2463534242)
+{
+  BOOST_ASSERT(nBuckets > 0);
+  BOOST_ASSERT(fingerprintBits > 0 && fingerprintBits <= 32);
+}
+
+bool
+CuckooFilter::contains(uint64_t hash) const
+{
+  Fingerprint fp = this->makeFingerprint(hash);
+  size_t index = this->getIndex(hash);
+  return this->bucketHas(index, fp) || this->bucketHas(this->getAltIndex(index, fp), fp);
+}
+
+bool
+CuckooFilter::insert(uint64_t hash)
+{
+  Fingerprint fp = this->makeFingerprint(hash);
+  size_t index = this->getIndex(hash);
+  size_t altIndex = this->getAltIndex(index, fp);
+  if (this->bucketInsert(index, fp) || this->bucketInsert(altIndex, fp)) {
+    ++m_nEntries;
+    return true;
+  }
+
+  // relocate fingerprints along a random path, remembering it so that it can be undone
+  std::vector<std::pair<size_t, size_t>> path;
+  path.reserve(MAX_KICKS);
+  size_t bucket = (this->nextRandom() & 1) ? index : altIndex;
+  for (size_t nKicks = 0; nKicks < MAX_KICKS; ++nKicks) {
+    size_t slot = this->nextRandom() % SLOTS_PER_BUCKET;
+    Fingerprint victim = this->getSlot(bucket, slot);
+    this->setSlot(bucket, slot, fp);
+    path.emplace_back(bucket, slot);
+    fp = victim;
+
+    bucket = this->getAltIndex(bucket, fp);
+    if (this->bucketInsert(bucket, fp)) {
+      ++m_nEntries;
+      return true;
+    }
+  }
+
+  for (auto step = path.rbegin(); step != path.rend(); ++step) {
+    Fingerprint displaced = this->getSlot(step->first, step->second);
+    this->setSlot(step->first, step->second, fp);
+    fp = displaced;
+  }
+  return false;
+}
+
+void
+CuckooFilter::clear()
+{
+  std::fill(m_table.begin(), m_table.end(), 0);
+  m_nEntries = 0;
+}
+
+CuckooFilter::Fingerprint
+CuckooFilter::makeFingerprint(uint64_t hash) const
+{
+  // upper half of the hash, as the lower half selects the bucket
+  Fingerprint fp = static_cast<Fingerprint>(hash >> 32) & m_mask;
+  return fp == 0 ? 1 : fp;
+}
+
+size_t
+CuckooFilter::getIndex(uint64_t hash) const
+{
+  // maps the lower half of the hash onto [0, m_nBuckets) without a division
+  return static_cast<size_t>((static_cast<uint64_t>(static_cast<uint32_t>(hash)) * m_nBuckets) >> 32);
+}
+
+size_t
+CuckooFilter::getAltIndex(size_t index, Fingerprint fp) const
+{
+  // (h(fp) - index) mod m_nBuckets is its own inverse, so the alternate of the alternate bucket
+  // is the original bucket for any m_nBuckets
+  size_t h = this->getIndex(static_cast<uint64_t>(fp) * 0x5bd1e995);
+  return h >= index ? h - index : h + m_nBuckets - index;
+}
+
+CuckooFilter::Fingerprint
+CuckooFilter::getSlot(size_t bucket, size_t slot) const
+{
+  const uint8_t* p = &m_table[(bucket * SLOTS_PER_BUCKET + slot) * m_width];
+  Fingerprint fp = 0;
+  for (size_t i = 0; i < m_width; ++i) {
+    fp |= static_cast<Fingerprint>(p[i]) << (8 * i);
+  }
+  return fp;
+}
+
+void
+CuckooFilter::setSlot(size_t bucket, size_t slot, Fingerprint fp)
+{
+  uint8_t* p = &m_table[(bucket * SLOTS_PER_BUCKET + slot) * m_width];
+  for (size_t i = 0; i < m_width; ++i) {
+    p[i] = static_cast<uint8_t>(fp >> (8 * i));
+  }
+}
+
+bool
+CuckooFilter::bucketHas(size_t bucket, Fingerprint fp) const
+{
+  for (size_t slot = 0; slot < SLOTS_PER_BUCKET; ++slot) {
+    if (this->getSlot(bucket, slot) == fp) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool
+CuckooFilter::bucketInsert(size_t bucket, Fingerprint fp)
+{
+  for (size_t slot = 0; slot < SLOTS_PER_BUCKET; ++slot) {
+    if (this->getSlot(bucket, slot) == 0) {
+      this->setSlot(bucket, slot, fp);
+      return true;
+    }
+  }
+  return false;
+}
+
+uint32_t
+CuckooFilter::nextRandom()
+{
+  m_random ^= m_random << 13;
+  m_random ^= m_random >> 17;
+  m_random ^= m_random << 5;
+  return m_random;
+}
+
+} // namespace dnl
+
+const time::nanoseconds CuckooDeadNonceList::DEFAULT_LIFETIME = time::seconds(6);
+const time::nanoseconds CuckooDeadNonceList::MIN_LIFETIME = time::milliseconds(1);
+const size_t CuckooDeadNonceList::DEFAULT_FINGERPRINT_BITS = 16;
+const size_t CuckooDeadNonceList::MIN_FINGERPRINT_BITS = 8;
+const size_t CuckooDeadNonceList::MAX_FINGERPRINT_BITS = 32;
+const size_t CuckooDeadNonceList::N_GENERATIONS;
+const size_t CuckooDeadNonceList::INITIAL_CAPACITY = (1 << 7);
+const double CuckooDeadNonceList::CAPACITY_HEADROOM = 1.25;
+
+CuckooDeadNonceList::CuckooDeadNonceList(const time::nanoseconds& lifetime,
+                                         size_t fingerprintBits)
+  : m_lifetime(lifetime)
+  , m_fingerprintBits(fingerprintBits)
+  , m_partitions(N_GENERATIONS + 1)
+  , m_current(0)
+  , m_rotateInterval(m_lifetime / N_GENERATIONS)
+{
+  if (m_lifetime < MIN_LIFETIME) {
+    BOOST_THROW_EXCEPTION(std::invalid_argument("lifetime is less than MIN_LIFETIME"));
+  }
+  if (m_fingerprintBits < MIN_FINGERPRINT_BITS || m_fingerprintBits > MAX_FINGERPRINT_BITS) {
+    BOOST_THROW_EXCEPTION(std::invalid_argument("fingerprintBits is out of range"));
+  }
+  BOOST_ASSERT_MSG(CAPACITY_HEADROOM >= 1.0, "CAPACITY_HEADROOM must not be less than 1");
+
+  for (size_t i = 0; i < m_partitions.size(); ++i) {
+    this->resetPartition(i, INITIAL_CAPACITY);
+  }
+
+  m_rotateEvent = scheduler::schedule(m_rotateInterval, bind(&CuckooDeadNonceList::rotate, this));
+}
+
+CuckooDeadNonceList::~CuckooDeadNonceList()
+{
+  scheduler::cancel(m_rotateEvent);
+}
+
+bool
+CuckooDeadNonceList::has(const Name& name, uint32_t nonce) const
+{
+  uint64_t hash = CuckooDeadNonceList::makeHash(name, nonce);
+  for (const Partition& partition : m_partitions) {
+    for (const auto& filter : partition) {
+      if (filter->contains(hash)) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+void
+CuckooDeadNonceList::add(const Name& name, uint32_t nonce)
+{
+  uint64_t hash = CuckooDeadNonceList::makeHash(name, nonce);
+  Partition& partition = m_partitions[m_current];
+  if (partition.back()->insert(hash)) {
+    return;
+  }
+
+  size_t nBuckets = partition.back()->getNBuckets() * 2;
+  NFD_LOG_TRACE("add partition=" << m_current << " overflow, chaining nBuckets=" << nBuckets);
+  partition.push_back(make_unique<dnl::CuckooFilter>(nBuckets, m_fingerprintBits));
+  bool isInserted = partition.back()->insert(hash);
+  BOOST_ASSERT(isInserted);
+  (void)isInserted;
+}
+
+size_t
+CuckooDeadNonceList::size() const
+{
+  size_t n = 0;
+  for (const Partition& partition : m_partitions) {
+    for (const auto& filter : partition) {
+      n += filter->size();
+    }
+  }
+  return n;
+}
+
+size_t
+CuckooDeadNonceList::getMemoryUsage() const
+{
+  size_t n = 0;
+  for (const Partition& partition : m_partitions) {
+    for (const auto& filter : partition) {
+      n += filter->getMemoryUsage();
+    }
+  }
+  return n;
+}
+
+double
+CuckooDeadNonceList::getFalsePositiveBound() const
+{
+  size_t nFilters = 0;
+  for (const Partition& partition : m_partitions) {
+    nFilters += partition.size();
+  }
+  return std::min(1.0, nFilters * 2 * dnl::CuckooFilter::SLOTS_PER_BUCKET /
+                       std::ldexp(1.0, static_cast<int>(m_fingerprintBits)));
+}
+
+uint64_t
+CuckooDeadNonceList::makeHash(const Name& name, uint32_t nonce)
+{
+  Block nameWire = name.wireEncode();
+  return CityHash64WithSeed(reinterpret_cast<const char*>(nameWire.wire()), nameWire.size(),
+                            static_cast<uint64_t>(nonce));
+}
+
+void
+CuckooDeadNonceList::rotate()
+{
+  size_t nEntries = 0;
+  for (const auto& filter : m_partitions[m_current]) {
+    nEntries += filter->size();
+  }
+
+  m_current = (m_current + 1) % m_partitions.size();
+  this->resetPartition(m_current, std::max(nEntries, INITIAL_CAPACITY));
+  NFD_LOG_TRACE("rotate partition=" << m_current << " nExpected=" << nEntries);
+
+  m_rotateEvent = scheduler::schedule(m_rotateInterval, bind(&CuckooDeadNonceList::rotate, this));
+}
+
+void
+CuckooDeadNonceList::resetPartition(size_t index, size_t nExpected)
+{
+  size_t nBuckets = static_cast<size_t>(std::ceil(nExpected * CAPACITY_HEADROOM /
+                                                  dnl::CuckooFilter::SLOTS_PER_BUCKET));
+
+  Partition& partition = m_partitions[index];
+  if (partition.size() == 1 && partition.front()->getNBuckets() == nBuckets) {
+    partition.front()->clear();
+    return;
+  }
+
+  partition.clear();
+  partition.push_back(make_unique<dnl::CuckooFilter>(nBuckets, m_fingerprintBits));
+}
+
+} // namespace nfd
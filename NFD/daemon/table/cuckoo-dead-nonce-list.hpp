@@ -0,0 +1,259 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef NFD_DAEMON_TABLE_CUCKOO_DEAD_NONCE_LIST_HPP
+#define NFD_DAEMON_TABLE_CUCKOO_DEAD_NONCE_LIST_HPP
+
+#include "common.hpp"
+#include "core/scheduler.hpp"
+
+namespace nfd {
+namespace dnl {
+
+/** \brief a cuckoo filter of 64-bit hashes with a fixed number of buckets
+ *
+ *  Each bucket has SLOTS_PER_BUCKET slots, and each slot stores a fingerprint of
+ *  \p fingerprintBits bits in the smallest number of bytes that can hold it.
+ *  A hash can be placed into one of two buckets; the alternate bucket is derived from
+ *  the current bucket and the fingerprint alone, so that stored fingerprints can be relocated.
+ *  Any number of buckets is supported.
+ */
+class CuckooFilter : noncopyable
+{
+public:
+  CuckooFilter(size_t nBuckets, size_t fingerprintBits);
+
+  /** \return true if \p hash may have been inserted
+   */
+  bool
+  contains(uint64_t hash) const;
+
+  /** \brief inserts \p hash
+   *  \retval false the filter is too full; the filter is left unchanged
+   */
+  bool
+  insert(uint64_t hash);
+
+  /** \brief removes all fingerprints
+   */
+  void
+  clear();
+
+  size_t
+  size() const
+  {
+    return m_nEntries;
+  }
+
+  size_t
+  getNBuckets() const
+  {
+    return m_nBuckets;
+  }
+
+  /** \return number of bytes used by the slot array
+   */
+  size_t
+  getMemoryUsage() const
+  {
+    return m_table.size();
+  }
+
+public:
+  static const size_t SLOTS_PER_BUCKET;
+
+  /** \brief maximum number of relocations before insert gives up
+   */
+  static const size_t MAX_KICKS;
+
+private:
+  typedef uint32_t Fingerprint; ///< 0 denotes an empty slot
+
+  Fingerprint
+  makeFingerprint(uint64_t hash) const;
+
+  size_t
+  getIndex(uint64_t hash) const;
+
+  size_t
+  getAltIndex(size_t index, Fingerprint fp) const;
+
+  Fingerprint
+  getSlot(size_t bucket, size_t slot) const;
+
+  void
+  setSlot(size_t bucket, size_t slot, Fingerprint fp);
+
+  bool
+  bucketHas(size_t bucket, Fingerprint fp) const;
+
+  bool
+  bucketInsert(size_t bucket, Fingerprint fp);
+
+  uint32_t
+  nextRandom();
+
+private:
+  size_t m_nBuckets;
+  size_t m_width; ///< bytes per slot
+  Fingerprint m_mask;
+  std::vector<uint8_t> m_table;
+  size_t m_nEntries;
+  uint32_t m_random; ///< xorshift state; deterministic so that simulations are repeatable
+};
+
+} // namespace dnl
+
+/** \brief represents the Dead Nonce List as a ring of cuckoo filters
+ *
+ *  This is an alternative to DeadNonceList with the same has/add interface.
+ *  Instead of 64-bit hashes in a multi-index container, it stores short fingerprints
+ *  in cuckoo filters, which needs a few bytes per Nonce instead of several dozens.
+ *
+ *  Entries are partitioned by insertion time.  The list has N_GENERATIONS + 1 partitions,
+ *  and new entries go into the current partition.  Every lifetime / N_GENERATIONS,
+ *  the oldest partition is cleared and becomes the current partition,
+ *  so that every entry is kept for at least the lifetime and at most
+ *  lifetime * (N_GENERATIONS + 1) / N_GENERATIONS.
+ *  A cleared partition is sized after the number of entries inserted into the previous one;
+ *  if it overflows within its interval, another filter of twice the size is chained to it.
+ *
+ *  A lookup probes two buckets in every filter, so the false positive rate is bounded by
+ *  nFilters * 2 * SLOTS_PER_BUCKET / 2^fingerprintBits.  With the default of 16 bits and
+ *  one filter per partition, this is below 0.1%.  Like in DeadNonceList, a false positive
+ *  is recoverable when the consumer retransmits with a different Nonce.
+ */
+class CuckooDeadNonceList : noncopyable
+{
+public:
+  /** \brief constructs the Dead Nonce List
+   *  \param lifetime duration of the expected lifetime of each nonce,
+   *         must be no less than MIN_LIFETIME.
+   *  \param fingerprintBits size of each fingerprint,
+   *         between MIN_FINGERPRINT_BITS and MAX_FINGERPRINT_BITS.
+   *         Each additional bit halves the false positive rate.
+   *  \throw std::invalid_argument if lifetime or fingerprintBits is out of range
+   */
+  explicit
+  CuckooDeadNonceList(const time::nanoseconds& lifetime = DEFAULT_LIFETIME,
+                      size_t fingerprintBits = DEFAULT_FINGERPRINT_BITS);
+
+  ~CuckooDeadNonceList();
+
+  /** \brief determines if name+nonce exists
+   *  \return true if name+nonce exists, or in case of a false positive
+   */
+  bool
+  has(const Name& name, uint32_t nonce) const;
+
+  /** \brief records name+nonce
+   */
+  void
+  add(const Name& name, uint32_t nonce);
+
+  /** \return number of stored Nonces
+   */
+  size_t
+  size() const;
+
+  /** \return expected lifetime
+   */
+  const time::nanoseconds&
+  getLifetime() const
+  {
+    return m_lifetime;
+  }
+
+  /** \return number of bytes used by fingerprint storage
+   */
+  size_t
+  getMemoryUsage() const;
+
+  /** \return upper bound of the false positive rate of has() with the current filters
+   */
+  double
+  getFalsePositiveBound() const;
+
+public:
+  /// default entry lifetime
+  static const time::nanoseconds DEFAULT_LIFETIME;
+
+  /// minimum entry lifetime
+  static const time::nanoseconds MIN_LIFETIME;
+
+  static const size_t DEFAULT_FINGERPRINT_BITS;
+  static const size_t MIN_FINGERPRINT_BITS;
+  static const size_t MAX_FINGERPRINT_BITS;
+
+private:
+  static uint64_t
+  makeHash(const Name& name, uint32_t nonce);
+
+  /** \brief clears the oldest partition and makes it current
+   */
+  void
+  rotate();
+
+  /** \brief resets a partition to one empty filter for \p nExpected entries
+   */
+  void
+  resetPartition(size_t index, size_t nExpected);
+
+private:
+  typedef std::vector<unique_ptr<dnl::CuckooFilter>> Partition;
+
+  time::nanoseconds m_lifetime;
+  size_t m_fingerprintBits;
+  std::vector<Partition> m_partitions;
+  size_t m_current;
+  scheduler::EventId m_rotateEvent;
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  /** \brief number of partitions that must cover the lifetime
+   */
+  static const size_t N_GENERATIONS = 5;
+  static_assert(N_GENERATIONS >= 1, "N_GENERATIONS must be at least 1");
+
+  /** \brief number of entries a partition is sized for initially
+   */
+  static const size_t INITIAL_CAPACITY;
+
+  /** \brief ratio of slots to expected entries when sizing a partition
+   */
+  static const double CAPACITY_HEADROOM;
+
+  time::nanoseconds m_rotateInterval;
+
+  size_t
+  getNFilters(size_t partition) const
+  {
+    return m_partitions.at(partition).size();
+  }
+};
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_CUCKOO_DEAD_NONCE_LIST_HPP
@@ -33,7 +33,10 @@ const Name Entry::LOCALHOST_NAME("ndn:/localhost");
 const Name Entry::LOCALHOP_NAME("ndn:/localhop");
 
 Entry::Entry(const Interest& interest)
-  : m_interest(interest.shared_from_this())
+  : m_strategy(nullptr)
+  , m_strategyVersion(0)
+  , m_strategyKind(0)
+  , m_interest(interest.shared_from_this())
 {
 }
 
@@ -34,6 +34,10 @@ namespace nfd {
 
 class NameTree;
 
+namespace fw {
+class Strategy;
+} // namespace fw
+
 namespace name_tree {
 class Entry;
 } // namespace name_tree
@@ -173,6 +177,15 @@ public:
   scheduler::EventId m_unsatisfyTimer;
   scheduler::EventId m_stragglerTimer;
 
+  /** \brief effective strategy cached by Forwarder in fixed strategy dispatch mode
+   *
+   *  Valid only while m_strategyVersion equals StrategyChoice::getVersion().
+   *  \sa Forwarder::setFixedStrategyDispatch
+   */
+  fw::Strategy* m_strategy;
+  uint64_t m_strategyVersion;
+  int m_strategyKind;
+
 private:
   shared_ptr<const Interest> m_interest;
   InRecordCollection m_inRecords;
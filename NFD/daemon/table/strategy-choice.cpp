@@ -39,6 +39,7 @@ NFD_LOG_INIT("StrategyChoice");
 StrategyChoice::StrategyChoice(NameTree& nameTree, shared_ptr<Strategy> defaultStrategy)
   : m_nameTree(nameTree)
   , m_nItems(0)
+  , m_version(0)
 {
   this->setDefaultStrategy(defaultStrategy);
 }
@@ -255,6 +256,7 @@ StrategyChoice::changeStrategy(strategy_choice::Entry& entry,
   NFD_LOG_INFO("changeStrategy(" << entry.getPrefix() << ")"
                << " from " << oldStrategy.getName()
                << " to " << newStrategy.getName());
+  ++m_version;
 
   // reset StrategyInfo on a portion of NameTree,
   // where entry's effective strategy is covered by the changing StrategyChoice entry
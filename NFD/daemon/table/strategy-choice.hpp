@@ -103,6 +103,14 @@ public: // effective strategy
   fw::Strategy&
   findEffectiveStrategy(const measurements::Entry& measurementsEntry) const;
 
+  /** \brief get a counter that increments whenever the effective strategy of some prefix changes
+   *
+   *  An effective strategy looked up when the counter had a certain value
+   *  remains effective as long as the counter keeps that value.
+   */
+  uint64_t
+  getVersion() const;
+
 public: // enumeration
   class const_iterator
     : public std::iterator<std::forward_iterator_tag, const strategy_choice::Entry>
@@ -166,6 +174,7 @@ private:
 private:
   NameTree& m_nameTree;
   size_t m_nItems;
+  uint64_t m_version;
 
   typedef std::map<Name, shared_ptr<fw::Strategy> > StrategyInstanceTable;
   StrategyInstanceTable m_strategyInstances;
@@ -177,6 +186,12 @@ StrategyChoice::size() const
   return m_nItems;
 }
 
+inline uint64_t
+StrategyChoice::getVersion() const
+{
+  return m_version;
+}
+
 inline StrategyChoice::const_iterator
 StrategyChoice::end() const
 {
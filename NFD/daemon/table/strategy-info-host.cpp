@@ -30,7 +30,39 @@ namespace nfd {
 void
 StrategyInfoHost::clearStrategyInfo()
 {
-  m_items.clear();
+  m_firstItem.second.reset();
+  m_otherItems.clear();
+}
+
+void
+StrategyInfoHost::setItem(int typeId, shared_ptr<fw::StrategyInfo> item)
+{
+  Item* existing = const_cast<Item*>(this->findItem(typeId));
+
+  if (item != nullptr) {
+    if (existing != nullptr) {
+      existing->second = std::move(item);
+    }
+    else if (m_firstItem.second == nullptr) {
+      m_firstItem = Item(typeId, std::move(item));
+    }
+    else {
+      m_otherItems.emplace_back(typeId, std::move(item));
+    }
+    return;
+  }
+
+  if (existing == nullptr) {
+    return;
+  }
+  // fill the hole with the last item, so that m_firstItem stays occupied while there are items
+  if (m_otherItems.empty()) {
+    existing->second.reset();
+  }
+  else {
+    *existing = std::move(m_otherItems.back());
+    m_otherItems.pop_back();
+  }
 }
 
 } // namespace nfd
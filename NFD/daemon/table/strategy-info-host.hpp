@@ -66,9 +66,46 @@ public:
   clearStrategyInfo();
 
 private:
-  std::map<int, shared_ptr<fw::StrategyInfo>> m_items;
+  typedef std::pair<int, shared_ptr<fw::StrategyInfo>> Item;
+
+  /** \return the item of typeId, or nullptr if it does not exist
+   */
+  const Item*
+  findItem(int typeId) const;
+
+  /** \brief insert, replace, or erase (if item is nullptr) the item of typeId
+   */
+  void
+  setItem(int typeId, shared_ptr<fw::StrategyInfo> item);
+
+private:
+  /** \brief the first item, stored inline
+   *
+   *  Most hosts carry StrategyInfo of only one strategy, so that looking it up
+   *  does not involve a container.
+   *  m_firstItem.second is nullptr if there is no item; m_otherItems is empty in that case.
+   */
+  Item m_firstItem;
+  std::vector<Item> m_otherItems;
 };
 
+inline const StrategyInfoHost::Item*
+StrategyInfoHost::findItem(int typeId) const
+{
+  if (m_firstItem.second == nullptr) {
+    return nullptr;
+  }
+  if (m_firstItem.first == typeId) {
+    return &m_firstItem;
+  }
+  for (const Item& item : m_otherItems) {
+    if (item.first == typeId) {
+      return &item;
+    }
+  }
+  return nullptr;
+}
+
 
 template<typename T>
 shared_ptr<T>
@@ -77,11 +114,11 @@ StrategyInfoHost::getStrategyInfo() const
   static_assert(std::is_base_of<fw::StrategyInfo, T>::value,
                 "T must inherit from StrategyInfo");
 
-  auto it = m_items.find(T::getTypeId());
-  if (it == m_items.end()) {
+  const Item* item = this->findItem(T::getTypeId());
+  if (item == nullptr) {
     return nullptr;
   }
-  return static_pointer_cast<T, fw::StrategyInfo>(it->second);
+  return static_pointer_cast<T, fw::StrategyInfo>(item->second);
 }
 
 template<typename T>
@@ -91,12 +128,7 @@ StrategyInfoHost::setStrategyInfo(shared_ptr<T> item)
   static_assert(std::is_base_of<fw::StrategyInfo, T>::value,
                 "T must inherit from StrategyInfo");
 
-  if (item == nullptr) {
-    m_items.erase(T::getTypeId());
-  }
-  else {
-    m_items[T::getTypeId()] = item;
-  }
+  this->setItem(T::getTypeId(), item);
 }
 
 template<typename T, typename ...A>
@@ -685,7 +685,7 @@ BOOST_FIXTURE_TEST_CASE(PitLeak, UnitTestTimeFixture) // Bug 3484
   interest->setNonce(61883075);
   interest->setInterestLifetime(time::seconds(2));
 
-  DeadNonceList& dnl = forwarder.getDeadNonceList();
+  Forwarder::DeadNonceTable& dnl = forwarder.getDeadNonceList();
   dnl.add(interest->getName(), interest->getNonce());
   Pit& pit = forwarder.getPit();
   BOOST_REQUIRE_EQUAL(pit.size(), 0);
@@ -88,6 +88,7 @@ SyncLogic::SyncLogic (const Name& syncPrefix,
   , m_rangeUniformRandom (m_randomGenerator, boost::uniform_int<> (200,1000))
   , m_reexpressionJitter (m_randomGenerator, boost::uniform_int<> (100,500))
   , m_recoveryRetransmissionInterval (m_defaultRecoveryRetransmitInterval)
+  , m_isSuspended (false)
 #ifdef NS3_NLSR_SIM
   , m_tracer(ns3::ndn::NlsrTracer::Instance())
 #endif
@@ -103,6 +104,7 @@ SyncLogic::SyncLogic (const Name& syncPrefix,
 
   m_reexpressingInterestId = m_scheduler.scheduleEvent (ndn::time::seconds (0),
                                                         bind (&SyncLogic::sendSyncInterest, this));
+  m_nextSyncInterestTime = ndn::time::steady_clock::now ();
 
   m_instanceId = string("Instance " + boost::lexical_cast<string>(m_instanceCounter++) + " ");
 
@@ -116,6 +118,7 @@ SyncLogic::SyncLogic (const Name& syncPrefix,
   m_outSyncData = 0;
   m_inRecovInterest = 0;
   m_outRecovData = 0;
+  m_suppressedSyncInterest = 0;
 }
 
 SyncLogic::SyncLogic (const Name& syncPrefix,
@@ -135,6 +138,7 @@ SyncLogic::SyncLogic (const Name& syncPrefix,
   , m_rangeUniformRandom (m_randomGenerator, boost::uniform_int<> (200,1000))
   , m_reexpressionJitter (m_randomGenerator, boost::uniform_int<> (100,500))
   , m_recoveryRetransmissionInterval (m_defaultRecoveryRetransmitInterval)
+  , m_isSuspended (false)
 #ifdef NS3_NLSR_SIM
   , m_tracer(ns3::ndn::NlsrTracer::Instance())
 #endif
@@ -149,6 +153,7 @@ SyncLogic::SyncLogic (const Name& syncPrefix,
 
   m_reexpressingInterestId = m_scheduler.scheduleEvent (ndn::time::seconds (0),
                                                         bind (&SyncLogic::sendSyncInterest, this));
+  m_nextSyncInterestTime = ndn::time::steady_clock::now ();
 
   m_outSyncInterest = 0;
   m_inSyncData = 0;
@@ -160,6 +165,7 @@ SyncLogic::SyncLogic (const Name& syncPrefix,
   m_outSyncData = 0;
   m_inRecovInterest = 0;
   m_outRecovData = 0;
+  m_suppressedSyncInterest = 0;
 }
 
 SyncLogic::~SyncLogic ()
@@ -221,7 +227,7 @@ SyncLogic::onSyncInterest (const Name& prefix, const ndn::Interest& interest)
           processSyncInterest (name, digest);
 #ifdef NS3_NLSR_SIM
           if (m_tracer.IsEnabled()) {
-            m_tracer.NsyncTrace(interest.getName().toUri(), "inSyncInterest", std::to_string(++m_inSyncInterest), std::to_string(interest.wireEncode().size()));
+            m_tracer.Trace(ns3::ndn::NlsrTracer::IN_SYNC_INTEREST, interest.getName(), ++m_inSyncInterest, interest.wireEncode().size());
           }
 #endif
         }
@@ -230,7 +236,7 @@ SyncLogic::onSyncInterest (const Name& prefix, const ndn::Interest& interest)
           processSyncRecoveryInterest (name, digest);
 #ifdef NS3_NLSR_SIM
           if (m_tracer.IsEnabled()) {
-            m_tracer.NsyncTrace(interest.getName().toUri(), "inRecovInterest", std::to_string(++m_inRecovInterest), std::to_string(interest.wireEncode().size()));
+            m_tracer.Trace(ns3::ndn::NlsrTracer::IN_RECOV_INTEREST, interest.getName(), ++m_inRecovInterest, interest.wireEncode().size());
           }
 #endif
         }
@@ -260,10 +266,10 @@ SyncLogic::onSyncData(const ndn::Interest& interest, Data& data)
 {
 #ifdef NS3_NLSR_SIM
   if (m_tracer.IsEnabled() && data.getName().size() > 4 && data.getName().get(3).toUri().compare("recovery") == 0)
-    m_tracer.NsyncTrace(data.getName().toUri(), "inRecovData", std::to_string(++m_inRecovData), std::to_string(data.wireEncode().size()));
+    m_tracer.Trace(ns3::ndn::NlsrTracer::IN_RECOV_DATA, data.getName(), ++m_inRecovData, data.wireEncode().size());
   else
     if (m_tracer.IsEnabled()) {
-      m_tracer.NsyncTrace(data.getName().toUri(), "inSyncData", std::to_string(++m_inSyncData), std::to_string(data.wireEncode().size()));
+      m_tracer.Trace(ns3::ndn::NlsrTracer::IN_SYNC_DATA, data.getName(), ++m_inSyncData, data.wireEncode().size());
     }
 #endif
   OnDataValidated onValidated = bind(&SyncLogic::onSyncDataValidated, this, _1);
@@ -277,10 +283,10 @@ SyncLogic::onSyncTimeout(const ndn::Interest& interest)
   // It is OK. Others will handle the time out situation.
 #ifdef NS3_NLSR_SIM
   if (m_tracer.IsEnabled() && interest.getName().size() > 4 && interest.getName().get(3).toUri().compare("recovery") == 0)
-    m_tracer.NsyncTrace(interest.getName().toUri(), "timedOutRecovInterest", std::to_string(++m_timedOutRecovInterest), std::to_string(interest.wireEncode().size()));
+    m_tracer.Trace(ns3::ndn::NlsrTracer::TIMED_OUT_RECOV_INTEREST, interest.getName(), ++m_timedOutRecovInterest, interest.wireEncode().size());
   else
     if (m_tracer.IsEnabled()) {
-      m_tracer.NsyncTrace(interest.getName().toUri(), "timedOutSyncInterest", std::to_string(++m_timedOutSyncInterest), std::to_string(interest.wireEncode().size()));
+      m_tracer.Trace(ns3::ndn::NlsrTracer::TIMED_OUT_SYNC_INTEREST, interest.getName(), ++m_timedOutSyncInterest, interest.wireEncode().size());
     }
 #endif
 }
@@ -521,7 +527,8 @@ SyncLogic::processSyncData (const Name &name, DigestConstPtr digest,
         ndn::time::milliseconds(GET_RANDOM (m_reexpressionJitter));
       // cout << "------------ reexpress interest after: " << after << endl;
       EventId eventId = m_scheduler.scheduleEvent (after,
-                                                   bind (&SyncLogic::sendSyncInterest, this));  //发送更新后的sync interest
+                                                   bind (&SyncLogic::sendSyncInterest, this));
+      m_nextSyncInterestTime = ndn::time::steady_clock::now () + after;  //发送更新后的sync interest
 
       m_scheduler.cancelEvent (m_reexpressingInterestId);
       m_reexpressingInterestId = eventId;
@@ -626,6 +633,15 @@ SyncLogic::addLocalNames (const Name &prefix, uint64_t session, uint64_t seq)  /
   satisfyPendingSyncInterests (diff);   //state digest变化，满足sync interest table中的sync interest
 }
 
+void
+SyncLogic::restoreName (const Name &prefix, uint64_t session, uint64_t seq)
+{
+  NameInfoConstPtr info = StdNameInfo::FindOrCreate(prefix.toUri());
+  m_state->update(info, SeqNo (session, seq));
+
+  _LOG_DEBUG_ID ("restoreName (): new state " << *m_state->getDigest ());
+}
+
 void
 SyncLogic::remove(const Name &prefix)   //移除某内容
 {
@@ -671,10 +687,11 @@ SyncLogic::sendSyncInterest ()
 
   _LOG_DEBUG_ID("sendSyncInterest: " << m_outstandingInterestName);
 
-  EventId eventId =
-    m_scheduler.scheduleEvent(ndn::time::seconds(m_syncInterestReexpress) +
-                              ndn::time::milliseconds(GET_RANDOM(m_reexpressionJitter)),
-                              bind (&SyncLogic::sendSyncInterest, this));
+  ndn::time::steady_clock::Duration after =
+    ndn::time::seconds(m_syncInterestReexpress) +
+    ndn::time::milliseconds(GET_RANDOM(m_reexpressionJitter));
+  EventId eventId = m_scheduler.scheduleEvent(after, bind (&SyncLogic::sendSyncInterest, this));
+  m_nextSyncInterestTime = ndn::time::steady_clock::now () + after;
   m_scheduler.cancelEvent (m_reexpressingInterestId);
   m_reexpressingInterestId = eventId;
 
@@ -686,7 +703,7 @@ SyncLogic::sendSyncInterest ()
                           bind(&SyncLogic::onSyncTimeout, this, _1));
 #ifdef NS3_NLSR_SIM
   if (m_tracer.IsEnabled()) {
-    m_tracer.NsyncTrace(interest.getName().toUri(), "outSyncInterest", std::to_string(++m_outSyncInterest), std::to_string(interest.wireEncode().size()));
+    m_tracer.Trace(ns3::ndn::NlsrTracer::OUT_SYNC_INTEREST, interest.getName(), ++m_outSyncInterest, interest.wireEncode().size());
   }
 #endif
 }
@@ -719,7 +736,7 @@ SyncLogic::sendSyncRecoveryInterests (DigestConstPtr digest)
                           bind(&SyncLogic::onSyncTimeout, this, _1));
 #ifdef NS3_NLSR_SIM
   if (m_tracer.IsEnabled()) {
-    m_tracer.NsyncTrace(interest.getName().toUri(), "outRecovInterest", std::to_string(++m_outRecovInterest), std::to_string(interest.wireEncode().size()));
+    m_tracer.Trace(ns3::ndn::NlsrTracer::OUT_RECOV_INTEREST, interest.getName(), ++m_outRecovInterest, interest.wireEncode().size());
   }
 #endif
 }
@@ -755,10 +772,10 @@ SyncLogic::sendSyncData (const Name &name, DigestConstPtr digest, SyncStateMsg &
   m_face->put(*syncData);
 #ifdef NS3_NLSR_SIM
   if (m_tracer.IsEnabled() && syncData->getName().size() > 4 && syncData->getName().get(3).toUri().compare("recovery") == 0)
-    m_tracer.NsyncTrace(syncData->getName().toUri(), "outRecovData", std::to_string(++m_outRecovData), std::to_string(syncData->wireEncode().size()));
+    m_tracer.Trace(ns3::ndn::NlsrTracer::OUT_RECOV_DATA, syncData->getName(), ++m_outRecovData, syncData->wireEncode().size());
   else
     if (m_tracer.IsEnabled()) {
-      m_tracer.NsyncTrace(syncData->getName().toUri(), "outSyncData", std::to_string(++m_outSyncData), std::to_string(syncData->wireEncode().size()));
+      m_tracer.Trace(ns3::ndn::NlsrTracer::OUT_SYNC_DATA, syncData->getName(), ++m_outSyncData, syncData->wireEncode().size());
     }
 #endif
 
@@ -779,6 +796,7 @@ SyncLogic::sendSyncData (const Name &name, DigestConstPtr digest, SyncStateMsg &
       // cout << "------------ reexpress interest after: " << after << endl;
       EventId eventId = m_scheduler.scheduleEvent (after,
                                                    bind (&SyncLogic::sendSyncInterest, this));
+      m_nextSyncInterestTime = ndn::time::steady_clock::now () + after;
       m_scheduler.cancelEvent (m_reexpressingInterestId);
       m_reexpressingInterestId = eventId;
     }
@@ -792,6 +810,46 @@ SyncLogic::getRootDigest()
   return os.str();
 }
 
+void
+SyncLogic::suspend ()
+{
+  _LOG_DEBUG_ID ("suspend ()");
+  m_scheduler.cancelEvent (m_reexpressingInterestId);
+  m_isSuspended = true;
+}
+
+uint64_t
+SyncLogic::resume ()
+{
+  if (!m_isSuspended)
+    return 0;
+  m_isSuspended = false;
+
+  // keep the phase of the re-expressions that would have happened meanwhile, each
+  // delayed by the mean jitter
+  ndn::time::steady_clock::Duration period =
+    ndn::time::seconds (m_syncInterestReexpress) + ndn::time::milliseconds (300);
+  ndn::time::steady_clock::TimePoint now = ndn::time::steady_clock::now ();
+  uint64_t nSuppressed = 0;
+  while (m_nextSyncInterestTime < now)
+    {
+      m_nextSyncInterestTime += period;
+      ++nSuppressed;
+    }
+  _LOG_DEBUG_ID ("resume (): " << nSuppressed << " sync interests were not sent");
+
+#ifdef NS3_NLSR_SIM
+  m_suppressedSyncInterest += nSuppressed;
+  if (nSuppressed > 0 && m_tracer.IsEnabled()) {
+    m_tracer.Trace(ns3::ndn::NlsrTracer::SUPPRESSED_SYNC_INTEREST, m_suppressedSyncInterest);
+  }
+#endif
+
+  m_reexpressingInterestId = m_scheduler.scheduleEvent (m_nextSyncInterestTime - now,
+                                                        bind (&SyncLogic::sendSyncInterest, this));
+  return nSuppressed;
+}
+
 size_t
 SyncLogic::getNumberOfBranches () const
 {
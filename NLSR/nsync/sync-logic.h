@@ -103,9 +103,33 @@ public:
    */
   void remove (const ndn::Name &prefix);
 
+  /**
+   * @brief set the sequence number of a participant without notifying others
+   *
+   * Used to restore a previously converged sync tree: when all participants restore the
+   * same state, their root digests agree and no sync data needs to be exchanged.
+   */
+  void restoreName (const ndn::Name &prefix, uint64_t session, uint64_t seq);
+
   std::string
   getRootDigest();
 
+  /**
+   * @brief stop re-expressing the sync interest periodically
+   *
+   * Only meant for a quiescent sync tree, where re-expressed interests would not learn
+   * anything new.
+   */
+  void
+  suspend ();
+
+  /**
+   * @brief resume re-expressing the sync interest as if it had been re-expressed meanwhile
+   * @returns the number of sync interests that were not sent
+   */
+  uint64_t
+  resume ();
+
 #ifdef _DEBUG
   ndn::Scheduler &
   getScheduler () { return m_scheduler; }
@@ -216,6 +240,8 @@ private:
   ndn::EventId m_delayedInterestProcessingId;
   ndn::EventId m_reexpressingInterestId;
   ndn::EventId m_reexpressingRecoveryInterestId;
+  ndn::time::steady_clock::TimePoint m_nextSyncInterestTime;
+  bool m_isSuspended;
 
   std::string m_instanceId;
   static int m_instanceCounter;
@@ -232,6 +258,7 @@ private:
   long m_outSyncData;
   long m_inRecovInterest;
   long m_outRecovData;
+  long m_suppressedSyncInterest;
 #endif
 };
 
@@ -100,6 +100,15 @@ SyncSocket::publishDataInternal(shared_ptr<Data> data,
   m_syncLogic.addLocalNames (prefix, session, sequence);
 }
 
+void
+SyncSocket::restoreState(const Name &prefix, uint64_t session, uint64_t seq, bool isLocal)
+{
+  if (isLocal)
+    m_sequenceLog[prefix] = SeqNo(session, seq + 1);
+
+  m_syncLogic.restoreName (prefix, session, seq);
+}
+
 void
 SyncSocket::fetchData(const Name &prefix, const SeqNo &seq,
                       const OnDataValidated& onValidated, int retry)
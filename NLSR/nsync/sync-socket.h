@@ -74,6 +74,14 @@ public:
   remove (const ndn::Name &prefix)
   { m_syncLogic.remove(prefix); }
 
+  /**
+   * @brief Restore the sequence number of @p prefix without publishing data
+   *
+   * For the local prefix, the next sequence number is also restored.
+   */
+  void
+  restoreState (const ndn::Name &prefix, uint64_t session, uint64_t seq, bool isLocal);
+
   void
   fetchData(const ndn::Name &prefix, const SeqNo &seq,
             const ndn::OnDataValidated& onValidated, int retry = 0);
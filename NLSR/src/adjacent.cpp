@@ -42,8 +42,8 @@ using namespace std;
 const float Adjacent::DEFAULT_LINK_COST = 10.0;
 
 Adjacent::Adjacent()
-    : m_name()
-    , m_connectingFaceUri()
+    : m_name(util::NamePool::get(ndn::Name()))
+    , m_connectingFaceUri(util::StringPool::get(std::string()))
     , m_linkCost(DEFAULT_LINK_COST)
     , m_status(STATUS_INACTIVE)
     , m_interestTimedOutNo(0)
@@ -52,8 +52,8 @@ Adjacent::Adjacent()
 }
 
 Adjacent::Adjacent(const ndn::Name& an)
-    : m_name(an)
-    , m_connectingFaceUri()
+    : m_name(util::NamePool::get(an))
+    , m_connectingFaceUri(util::StringPool::get(std::string()))
     , m_linkCost(DEFAULT_LINK_COST)
     , m_status(STATUS_INACTIVE)
     , m_interestTimedOutNo(0)
@@ -63,8 +63,8 @@ Adjacent::Adjacent(const ndn::Name& an)
 
 Adjacent::Adjacent(const ndn::Name& an, const std::string& cfu,  double lc,
                    Status s, uint32_t iton, uint64_t faceId)
-    : m_name(an)
-    , m_connectingFaceUri(cfu)
+    : m_name(util::NamePool::get(an))
+    , m_connectingFaceUri(util::StringPool::get(cfu))
     , m_linkCost(lc)
     , m_status(s)
     , m_interestTimedOutNo(iton)
@@ -78,8 +78,8 @@ Adjacent::Adjacent(const std::string& simName, const ndn::Name& an,
 		   const std::string& cfu,  double lc, Status s, 
 		   uint32_t iton, uint64_t faceId)
     : m_simName(simName)
-    , m_name(an)
-    , m_connectingFaceUri(cfu)
+    , m_name(util::NamePool::get(an))
+    , m_connectingFaceUri(util::StringPool::get(cfu))
     , m_linkCost(lc)
     , m_status(s)
     , m_interestTimedOutNo(iton)
@@ -93,8 +93,9 @@ Adjacent::Adjacent(const std::string& simName, const ndn::Name& an,
 bool
 Adjacent::operator==(const Adjacent& adjacent) const
 {
-  return (m_name == adjacent.getName()) &&
-         (m_connectingFaceUri == adjacent.getConnectingFaceUri()) &&
+  // pooled values are equal only if they are the same
+  return (m_name == adjacent.m_name) &&
+         (m_connectingFaceUri == adjacent.m_connectingFaceUri) &&
          (std::abs(m_linkCost - adjacent.getLinkCost()) <
           std::numeric_limits<double>::epsilon()) ;
 }
@@ -105,8 +106,8 @@ Adjacent::writeLog()
 #ifdef NS3_NLSR_SIM
   _LOG_DEBUG("Simulated Node Name: " << m_simName);
 #endif
-  _LOG_DEBUG("Adjacent : " << m_name);
-  _LOG_DEBUG("Connecting FaceUri: " << m_connectingFaceUri);
+  _LOG_DEBUG("Adjacent : " << *m_name);
+  _LOG_DEBUG("Connecting FaceUri: " << *m_connectingFaceUri);
   _LOG_DEBUG("Link Cost: " << m_linkCost);
   _LOG_DEBUG("Status: " << m_status);
   _LOG_DEBUG("Interest Timed out: " << m_interestTimedOutNo);
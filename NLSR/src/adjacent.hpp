@@ -25,6 +25,8 @@
 #include <boost/cstdint.hpp>
 #include <ndn-cxx/face.hpp>
 
+#include "utility/shared-pool.hpp"
+
 #ifndef NLSR_ADJACENT_HPP
 #define NLSR_ADJACENT_HPP
 
@@ -61,25 +63,25 @@ public:
   const ndn::Name&
   getName() const
   {
-    return m_name;
+    return *m_name;
   }
 
   void
   setName(const ndn::Name& an)
   {
-    m_name = an;
+    m_name = util::NamePool::get(an);
   }
 
   const std::string&
   getConnectingFaceUri() const
   {
-    return m_connectingFaceUri;
+    return *m_connectingFaceUri;
   }
 
   void
   setConnectingFaceUri(const std::string& cfu)
   {
-    m_connectingFaceUri = cfu;
+    m_connectingFaceUri = util::StringPool::get(cfu);
   }
 
   uint64_t
@@ -137,7 +139,7 @@ public:
   inline bool
   compare(const ndn::Name& adjacencyName)
   {
-    return m_name == adjacencyName;
+    return *m_name == adjacencyName;
   }
 
   inline bool
@@ -149,7 +151,7 @@ public:
   inline bool
   compareFaceUri(std::string& faceUri)
   {
-    return m_connectingFaceUri == faceUri;
+    return *m_connectingFaceUri == faceUri;
   }
 
   void
@@ -162,8 +164,10 @@ private:
 #ifdef NS3_NLSR_SIM
   std::string m_simName;
 #endif
-  ndn::Name m_name;
-  std::string m_connectingFaceUri;
+  // names and face URIs of adjacents are in the adjacency LSAs held by all routers,
+  // so they are pooled
+  util::NamePool::ValuePtr m_name;
+  util::StringPool::ValuePtr m_connectingFaceUri;
   double m_linkCost;
   Status m_status;
   uint32_t m_interestTimedOutNo;
@@ -333,6 +333,49 @@ SyncLogicHandler::publishRoutingUpdate()
   publishSyncUpdate(m_updatePrefix, m_sequencingManager.getCombinedSeqNo());
 }
 
+void
+SyncLogicHandler::restoreSyncState(const ndn::Name& originRouter, uint64_t seqNo)
+{
+  if (m_syncSocket == nullptr) {
+    throw SyncLogicHandler::Error("Cannot restore sync state; SyncSocket does not exist");
+  }
+
+  // Same structure as the update prefix of this router: <network>/NLSR/LSA/<site>/<router>
+  ndn::Name updatePrefix = m_confParam.getLsaPrefix();
+  updatePrefix.append(originRouter.getSubName(m_confParam.getNetwork().size()));
+
+  _LOG_DEBUG("Restoring sync state. Prefix: " << updatePrefix << " Seq No: " << seqNo);
+
+  m_syncSocket->restoreState(updatePrefix, 0, seqNo,
+                             originRouter == m_confParam.getRouterPrefix());
+}
+
+std::string
+SyncLogicHandler::getRootDigest()
+{
+  if (m_syncSocket == nullptr) {
+    return "";
+  }
+  return m_syncSocket->getRootDigest();
+}
+
+void
+SyncLogicHandler::suspend()
+{
+  if (m_syncSocket != nullptr) {
+    m_syncSocket->getLogic().suspend();
+  }
+}
+
+uint64_t
+SyncLogicHandler::resume()
+{
+  if (m_syncSocket == nullptr) {
+    return 0;
+  }
+  return m_syncSocket->getLogic().resume();
+}
+
 void
 SyncLogicHandler::buildUpdatePrefix()
 {
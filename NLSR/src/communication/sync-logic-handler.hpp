@@ -71,6 +71,30 @@ public:
   void
   createSyncSocket(const ndn::Name& syncPrefix);
 
+  /** \brief Restores the sync state of a router without publishing an update
+
+      \param originRouter the router prefix (network, site and router name)
+      \param seqNo the combined sequence number of the router's LSAs
+   */
+  void
+  restoreSyncState(const ndn::Name& originRouter, uint64_t seqNo);
+
+  /** \brief Digest of the sync tree, equal on all routers that know the same LSAs
+   */
+  std::string
+  getRootDigest();
+
+  /** \brief Stops re-expressing sync Interests while the network is quiescent
+   */
+  void
+  suspend();
+
+  /** \brief Resumes sync Interests
+      \return the number of sync Interests that were not sent
+   */
+  uint64_t
+  resume();
+
 private:
   void
   buildUpdatePrefix();
@@ -161,7 +161,6 @@ bool
 ConfFileProcessor::load(istream& input)
 {
   ConfigSection pt;
-  bool ret = true;
   try {
     boost::property_tree::read_info(input, pt);
   }
@@ -172,8 +171,15 @@ ConfFileProcessor::load(istream& input)
     return false;
   }
 
-  for (ConfigSection::const_iterator tn = pt.begin();
-       tn != pt.end(); ++tn) {
+  return processConfTree(pt);
+}
+
+bool
+ConfFileProcessor::processConfTree(const ConfigSection& tree)
+{
+  bool ret = true;
+  for (ConfigSection::const_iterator tn = tree.begin();
+       tn != tree.end(); ++tn) {
     ret = processSection(tn->first, tn->second);
     if (ret == false) {
       break;
@@ -210,6 +216,12 @@ ConfFileProcessor::processSection(const std::string& sectionName, const ConfigSe
   {
     ret = processConfSectionSecurity(section);
   }
+#ifdef NS3_NLSR_SIM
+  else if (sectionName == "sim-crypto")
+  {
+    ret = processConfSectionSimCrypto(section);
+  }
+#endif
   else
   {
     std::cerr << "Wrong configuration section: " << sectionName << std::endl;
@@ -474,6 +486,17 @@ ConfFileProcessor::processConfSectionNeighbors(const ConfigSection& section)
     return false;
   }
 
+  // face-down-hold-down
+  ConfigurationVariable<uint32_t> faceDownHoldDown("face-down-hold-down",
+                                                   bind(&ConfParameter::setFaceDownHoldDown,
+                                                   &m_nlsr.getConfParameter(), _1));
+  faceDownHoldDown.setMinAndMaxValue(FACE_DOWN_HOLD_DOWN_MIN, FACE_DOWN_HOLD_DOWN_MAX);
+  faceDownHoldDown.setOptional(FACE_DOWN_HOLD_DOWN_DEFAULT);
+
+  if (!faceDownHoldDown.parseFromConfigSection(section)) {
+    return false;
+  }
+
   for (ConfigSection::const_iterator tn =
            section.begin(); tn != section.end(); ++tn) {
 
@@ -665,4 +688,33 @@ ConfFileProcessor::processConfSectionSecurity(const ConfigSection& section)
   return true;
 }
 
+#ifdef NS3_NLSR_SIM
+bool
+ConfFileProcessor::processConfSectionSimCrypto(const ConfigSection& section)
+{
+  security::CryptoProfile& profile = m_nlsr.getCryptoProfile();
+
+  std::string modeStr = section.get<std::string>("mode", "real");
+  security::CryptoProfile::Mode mode;
+  if (!security::CryptoProfile::parseMode(modeStr, mode)) {
+    std::cerr << "Wrong value for mode: " << modeStr << ". ";
+    std::cerr << "Valid values: real, digest-sha256, null" << std::endl;
+    return false;
+  }
+  profile.setMode(mode);
+
+  // signing-delay and validation-delay, in microseconds
+  ConfigurationVariable<uint32_t> signingDelay("signing-delay",
+    [&profile] (uint32_t delay) { profile.setSigningDelay(ndn::time::microseconds(delay)); });
+  signingDelay.setOptional(0);
+
+  ConfigurationVariable<uint32_t> validationDelay("validation-delay",
+    [&profile] (uint32_t delay) { profile.setValidationDelay(ndn::time::microseconds(delay)); });
+  validationDelay.setOptional(0);
+
+  return signingDelay.parseFromConfigSection(section) &&
+         validationDelay.parseFromConfigSection(section);
+}
+#endif
+
 } // namespace nlsr
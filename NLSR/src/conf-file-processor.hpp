@@ -35,6 +35,8 @@ namespace nlsr {
 class ConfFileProcessor
 {
 public:
+  typedef boost::property_tree::ptree ConfigSection;
+
   ConfFileProcessor(Nlsr& nlsr, const std::string& cfile)
     : m_confFileName(cfile)
     , m_nlsr(nlsr)
@@ -44,9 +46,15 @@ public:
   bool
   processConfFile();
 
-private:
-  typedef boost::property_tree::ptree ConfigSection;
+  /*! \brief Process a configuration that has already been parsed, e.g., by a simulation
+   *         topology reader
+   *
+   * The configuration file name is still used to resolve relative paths.
+   */
+  bool
+  processConfTree(const ConfigSection& tree);
 
+private:
   bool
   load(std::istream& input);
 
@@ -71,6 +79,11 @@ private:
   bool
   processConfSectionSecurity(const ConfigSection& section);
 
+#ifdef NS3_NLSR_SIM
+  bool
+  processConfSectionSimCrypto(const ConfigSection& section);
+#endif
+
 private:
   std::string m_confFileName;
   Nlsr& m_nlsr;
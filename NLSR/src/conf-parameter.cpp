@@ -57,6 +57,7 @@ ConfParameter::writeLog()
   // Event Intervals
   _LOG_DEBUG("Adjacency LSA build interval:  " << m_adjLsaBuildInterval);
   _LOG_DEBUG("First Hello Interest interval: " << m_firstHelloInterval);
+  _LOG_DEBUG("Face down hold-down:           " << m_faceDownHoldDown);
   _LOG_DEBUG("Routing calculation interval:  " << m_routingCalcInterval);
 }
 
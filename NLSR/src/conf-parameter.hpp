@@ -60,6 +60,12 @@ enum {
   FIRST_HELLO_INTERVAL_MAX = 10
 };
 
+enum {
+  FACE_DOWN_HOLD_DOWN_MIN = 0,
+  FACE_DOWN_HOLD_DOWN_DEFAULT = 0,
+  FACE_DOWN_HOLD_DOWN_MAX = 60
+};
+
 enum {
   ROUTING_CALC_INTERVAL_MIN = 0,
   ROUTING_CALC_INTERVAL_DEFAULT = 15,
@@ -115,6 +121,7 @@ public:
     : m_lsaRefreshTime(LSA_REFRESH_TIME_DEFAULT)
     , m_adjLsaBuildInterval(ADJ_LSA_BUILD_INTERVAL_DEFAULT)
     , m_firstHelloInterval(FIRST_HELLO_INTERVAL_DEFAULT)
+    , m_faceDownHoldDown(FACE_DOWN_HOLD_DOWN_DEFAULT)
     , m_routingCalcInterval(ROUTING_CALC_INTERVAL_DEFAULT)
     , m_lsaInterestLifetime(ndn::time::seconds(static_cast<int>(LSA_INTEREST_LIFETIME_DEFAULT)))
     , m_routerDeadInterval(2 * LSA_REFRESH_TIME_DEFAULT)
@@ -247,6 +254,18 @@ public:
     return m_firstHelloInterval;
   }
 
+  void
+  setFaceDownHoldDown(uint32_t holdDown)
+  {
+    m_faceDownHoldDown = holdDown;
+  }
+
+  uint32_t
+  getFaceDownHoldDown() const
+  {
+    return m_faceDownHoldDown;
+  }
+
   void
   setRoutingCalcInterval(uint32_t interval)
   {
@@ -432,6 +451,7 @@ private:
 
   uint32_t m_adjLsaBuildInterval;
   uint32_t m_firstHelloInterval;
+  uint32_t m_faceDownHoldDown;
   uint32_t m_routingCalcInterval;
 
   ndn::time::seconds m_lsaInterestLifetime;
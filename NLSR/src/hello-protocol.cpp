@@ -59,7 +59,7 @@ HelloProtocol::expressInterest(const ndn::Name& interestName, uint32_t seconds)
                                                  this, _1));
 #ifdef NS3_NLSR_SIM
   if (m_tracer.IsEnabled()) {
-    m_tracer.HelloTrace(interestName.toUri(), "outHelloInterest", std::to_string(++m_outInterest), std::to_string(i.wireEncode().size()));
+    m_tracer.Trace(ns3::ndn::NlsrTracer::OUT_HELLO_INTEREST, interestName, ++m_outInterest, i.wireEncode().size());
   }
 #endif
 }
@@ -71,13 +71,7 @@ HelloProtocol::sendScheduledInterest(uint32_t seconds) //发送第一个hello之
   for (std::list<Adjacent>::iterator it = adjList.begin(); it != adjList.end();
        ++it) {
     if((*it).getFaceId() != 0) {
-      /* interest name: /<neighbor>/NLSR/INFO/<router> */
-      ndn::Name interestName = (*it).getName() ;
-      interestName.append(NLSR_COMPONENT);
-      interestName.append(INFO_COMPONENT);
-      interestName.append(m_nlsr.getConfParameter().getRouterPrefix().wireEncode());
-      expressInterest(interestName,
-                      m_nlsr.getConfParameter().getInterestResendTime());
+      sendHelloInterest((*it).getName());
     }
     else {
       registerPrefixes((*it).getName(), (*it).getConnectingFaceUri(),
@@ -88,19 +82,20 @@ HelloProtocol::sendScheduledInterest(uint32_t seconds) //发送第一个hello之
   scheduleInterest_ymz(m_nlsr.getConfParameter().getInfoInterestInterval());
 }
 
+void
+HelloProtocol::sendHelloInterest(const ndn::Name& neighbor)
+{
+  /* interest name: /<neighbor>/NLSR/INFO/<router> */
+  ndn::Name interestName = neighbor;
+  interestName.append(NLSR_COMPONENT);
+  interestName.append(INFO_COMPONENT);
+  interestName.append(m_nlsr.getConfParameter().getRouterPrefix().wireEncode());
+  expressInterest(interestName,
+                  m_nlsr.getConfParameter().getInterestResendTime());
+}
+
 void HelloProtocol::scheduleInterest_ymz(uint32_t infoInterestInterval)
 {
-  cout << ns3::ndn::Consumer::numTimeOutInterests << "/" << ns3::ndn::Consumer::numOutInterests << endl;
-  /* if ((double)ns3::ndn::Consumer::numInData/ns3::ndn::Consumer::numOutInterests < 0.5)
-  {
-    if(infoInterestInterval > 5) {
-      infoInterestInterval--;
-    }
-  }
-  if ((double)ns3::ndn::Consumer::numInData/ns3::ndn::Consumer::numOutInterests > 0.9)
-  {
-    infoInterestInterval++;
-  } */
   m_nlsr.getConfParameter().setInfoInterestInterval(infoInterestInterval);
   scheduleInterest(m_nlsr.getConfParameter().getInfoInterestInterval());
 }
@@ -110,8 +105,57 @@ HelloProtocol::scheduleInterest(uint32_t seconds)
 {
   //_LOG_DEBUG_YMZ("Scheduling HELLO Interests in " << ndn::time::seconds(seconds));
 
-  m_scheduler.scheduleEvent(ndn::time::seconds(seconds),
-                            ndn::bind(&HelloProtocol::sendScheduledInterest, this, seconds));
+  m_nextHelloTime = ndn::time::steady_clock::now() + ndn::time::seconds(seconds);
+  m_helloEventId = m_scheduler.scheduleEvent(ndn::time::seconds(seconds),
+                                             ndn::bind(&HelloProtocol::sendScheduledInterest,
+                                                       this, seconds));
+}
+
+void
+HelloProtocol::suspend()
+{
+  _LOG_DEBUG("Suspending HELLO Interests");
+  m_scheduler.cancelEvent(m_helloEventId);
+  m_isSuspended = true;
+}
+
+uint64_t
+HelloProtocol::resume()
+{
+  if (!m_isSuspended) {
+    return 0;
+  }
+  m_isSuspended = false;
+
+  // Keep the phase of the HELLO rounds that would have been sent meanwhile
+  uint32_t interval = m_nlsr.getConfParameter().getInfoInterestInterval();
+  ndn::time::steady_clock::TimePoint now = ndn::time::steady_clock::now();
+  uint64_t nRounds = 0;
+  while (m_nextHelloTime < now) {
+    m_nextHelloTime += ndn::time::seconds(interval);
+    ++nRounds;
+  }
+
+  uint64_t nNeighbors = 0;
+  for (Adjacent& adjacent : m_nlsr.getAdjacencyList().getAdjList()) {
+    if (adjacent.getFaceId() != 0) {
+      ++nNeighbors;
+    }
+  }
+  uint64_t nSuppressed = nRounds * nNeighbors;
+  _LOG_DEBUG("Resuming HELLO Interests, " << nSuppressed << " were not sent");
+
+#ifdef NS3_NLSR_SIM
+  m_suppressedInterest += nSuppressed;
+  if (nSuppressed > 0 && m_tracer.IsEnabled()) {
+    m_tracer.Trace(ns3::ndn::NlsrTracer::SUPPRESSED_HELLO_INTEREST, m_suppressedInterest);
+  }
+#endif
+
+  m_helloEventId = m_scheduler.scheduleEvent(m_nextHelloTime - now,
+                                             ndn::bind(&HelloProtocol::sendScheduledInterest,
+                                                       this, interval));
+  return nSuppressed;
 }
 
 void
@@ -126,7 +170,7 @@ HelloProtocol::processInterest(const ndn::Name& name,
   }
 #ifdef NS3_NLSR_SIM
   if (m_tracer.IsEnabled()) {
-    m_tracer.HelloTrace(interestName.toUri(), "inHelloInterest", std::to_string(++m_inInterest), std::to_string(interest.wireEncode().size()));
+    m_tracer.Trace(ns3::ndn::NlsrTracer::IN_HELLO_INTEREST, interestName, ++m_inInterest, interest.wireEncode().size());
   }
 #endif
   ndn::Name neighbor;
@@ -138,12 +182,19 @@ HelloProtocol::processInterest(const ndn::Name& name,
     data->setFreshnessPeriod(ndn::time::seconds(10)); // 10 sec
     data->setContent(reinterpret_cast<const uint8_t*>(INFO_COMPONENT.c_str()),
                     INFO_COMPONENT.size());
+#ifdef NS3_NLSR_SIM
+    m_nlsr.getCryptoProfile().sign(*data,
+                                   ndn::security::signingByCertificate(m_nlsr.getDefaultCertName()));
+    _LOG_DEBUG("Sending out data for name: " << interest.getName());
+    m_nlsr.getCryptoProfile().put(m_nlsr.getNlsrFace(), data);
+#else
     m_nlsr.getKeyChain().sign(*data, m_nlsr.getDefaultCertName());
     _LOG_DEBUG("Sending out data for name: " << interest.getName());
     m_nlsr.getNlsrFace().put(*data);
+#endif
 #ifdef NS3_NLSR_SIM
     if (m_tracer.IsEnabled()) {
-      m_tracer.HelloTrace(interestName.toUri(), "outHelloData", std::to_string(++m_outData), std::to_string(data->wireEncode().size()));
+      m_tracer.Trace(ns3::ndn::NlsrTracer::OUT_HELLO_DATA, interestName, ++m_outData, data->wireEncode().size());
     }
 #endif
     Adjacent *adjacent = m_nlsr.getAdjacencyList().findAdjacent(neighbor);
@@ -176,7 +227,7 @@ HelloProtocol::processInterestTimedOut(const ndn::Interest& interest)
   }
 #ifdef NS3_NLSR_SIM
   if (m_tracer.IsEnabled()) {
-    m_tracer.HelloTrace(interestName.toUri(), "timedOutHelloInterest", std::to_string(++m_timedOutInterest), std::to_string(interest.wireEncode().size()));
+    m_tracer.Trace(ns3::ndn::NlsrTracer::TIMED_OUT_HELLO_INTEREST, interestName, ++m_timedOutInterest, interest.wireEncode().size());
   }
 #endif
   ndn::Name neighbor = interestName.getPrefix(-3);
@@ -223,7 +274,7 @@ HelloProtocol::onContent(const ndn::Interest& interest, const ndn::Data& data)
 
 #ifdef NS3_NLSR_SIM
   if (m_tracer.IsEnabled()) {
-    m_tracer.HelloTrace(data.getName().toUri(), "inHelloData", std::to_string(++m_inData), std::to_string(data.wireEncode().size()));
+    m_tracer.Trace(ns3::ndn::NlsrTracer::IN_HELLO_DATA, data.getName(), ++m_inData, data.wireEncode().size());
   }
 #endif
 }
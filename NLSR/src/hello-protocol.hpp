@@ -75,6 +75,7 @@ public:
   HelloProtocol(Nlsr& nlsr, ndn::Scheduler& scheduler)
     : m_nlsr(nlsr)
     , m_scheduler(scheduler)
+    , m_isSuspended(false)
 #ifdef NS3_NLSR_SIM
     , m_tracer(ns3::ndn::NlsrTracer::Instance())
 #endif
@@ -84,6 +85,7 @@ public:
     m_timedOutInterest = 0;
     m_inInterest = 0;
     m_outData = 0;
+    m_suppressedInterest = 0;
 
     m_instanceId = string("Instance " + boost::lexical_cast<string>(m_instanceCounter++) + " ");  //ymz
   }
@@ -100,12 +102,31 @@ public:
   void
   sendScheduledInterest(uint32_t seconds);
 
+  /** \brief Sends a HELLO Interest to \p neighbor right away
+   */
+  void
+  sendHelloInterest(const ndn::Name& neighbor);
+
   void
   processInterest(const ndn::Name& name, const ndn::Interest& interest);
 
   void
   registerAdjacentPrefixes();
 
+  /** \brief Stops sending periodic HELLO Interests
+
+      Only meant for a quiescent network, where all neighbors keep their status.
+   */
+  void
+  suspend();
+
+  /** \brief Resumes periodic HELLO Interests as if they had been sent while suspended
+
+      \return the number of HELLO Interests that were not sent
+   */
+  uint64_t
+  resume();
+
 private:
   void
   processInterestTimedOut(const ndn::Interest& interest);
@@ -151,6 +172,10 @@ private:
   std::string m_instanceId;
   static int m_instanceCounter;  //ymz
 
+  ndn::EventId m_helloEventId;
+  ndn::time::steady_clock::TimePoint m_nextHelloTime;
+  bool m_isSuspended;
+
 
 #ifdef NS3_NLSR_SIM
   ns3::ndn::NlsrTracer &m_tracer;
@@ -159,6 +184,7 @@ private:
   long m_timedOutInterest;
   long m_inInterest;
   long m_outData;
+  long m_suppressedInterest;
 #endif
 };
 
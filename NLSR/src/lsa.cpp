@@ -52,7 +52,7 @@ const std::string CoordinateLsa::TYPE_STRING = "coordinate";
 const ndn::Name
 NameLsa::getKey() const
 {
-  ndn::Name key = m_origRouter;
+  ndn::Name key = getOrigRouter();
   key.append(NameLsa::TYPE_STRING);
   return key;
 }
@@ -62,7 +62,7 @@ NameLsa::NameLsa(const ndn::Name& origR, uint32_t lsn,
                  NamePrefixList& npl)
   : Lsa(NameLsa::TYPE_STRING)
 {
-  m_origRouter = origR;
+  setOrigRouter(origR);
   m_lsSeqNo = lsn;
   m_expirationTimePoint = lt;
   std::list<ndn::Name>& nl = npl.getNameList();
@@ -75,7 +75,7 @@ string
 NameLsa::getData()
 {
   string nameLsaData;
-  nameLsaData = m_origRouter.toUri() + "|" + NameLsa::TYPE_STRING + "|"
+  nameLsaData = getOrigRouter().toUri() + "|" + NameLsa::TYPE_STRING + "|"
                 + boost::lexical_cast<std::string>(m_lsSeqNo) + "|"
                 + ndn::time::toIsoString(m_expirationTimePoint);
   nameLsaData += "|";
@@ -96,8 +96,8 @@ NameLsa::initializeFromContent(const std::string& content)
   boost::tokenizer<boost::char_separator<char> >tokens(content, sep);
   boost::tokenizer<boost::char_separator<char> >::iterator tok_iter =
                                                tokens.begin();
-  m_origRouter = ndn::Name(*tok_iter++);
-  if (!(m_origRouter.size() > 0)) {
+  setOrigRouter(ndn::Name(*tok_iter++));
+  if (!(getOrigRouter().size() > 0)) {
     return false;
   }
   try {
@@ -124,7 +124,7 @@ void
 NameLsa::writeLog()
 {
   _LOG_DEBUG("Name Lsa: ");
-  _LOG_DEBUG("  Origination Router: " << m_origRouter);
+  _LOG_DEBUG("  Origination Router: " << getOrigRouter());
   _LOG_DEBUG("  Ls Type: " << m_lsType);
   _LOG_DEBUG("  Ls Seq No: " << m_lsSeqNo);
   _LOG_DEBUG("  Ls Lifetime: " << m_expirationTimePoint);
@@ -143,7 +143,7 @@ CoordinateLsa::CoordinateLsa(const ndn::Name& origR, uint32_t lsn,
                              double r, double theta)
   : Lsa(CoordinateLsa::TYPE_STRING)
 {
-  m_origRouter = origR;
+  setOrigRouter(origR);
   m_lsSeqNo = lsn;
   m_expirationTimePoint = lt;
   m_corRad = r;
@@ -153,7 +153,7 @@ CoordinateLsa::CoordinateLsa(const ndn::Name& origR, uint32_t lsn,
 const ndn::Name
 CoordinateLsa::getKey() const
 {
-  ndn::Name key = m_origRouter;
+  ndn::Name key = getOrigRouter();
   key.append(CoordinateLsa::TYPE_STRING);
   return key;
 }
@@ -171,7 +171,7 @@ string
 CoordinateLsa::getData()
 {
   string corLsaData;
-  corLsaData = m_origRouter.toUri() + "|";
+  corLsaData = getOrigRouter().toUri() + "|";
   corLsaData += CoordinateLsa::TYPE_STRING;
   corLsaData += "|";
   corLsaData += (boost::lexical_cast<std::string>(m_lsSeqNo) + "|");
@@ -188,8 +188,8 @@ CoordinateLsa::initializeFromContent(const std::string& content)
   boost::tokenizer<boost::char_separator<char> >tokens(content, sep);
   boost::tokenizer<boost::char_separator<char> >::iterator tok_iter =
                                                tokens.begin();
-  m_origRouter = ndn::Name(*tok_iter++);
-  if (!(m_origRouter.size() > 0)) {
+  setOrigRouter(ndn::Name(*tok_iter++));
+  if (!(getOrigRouter().size() > 0)) {
     return false;
   }
   try {
@@ -213,7 +213,7 @@ void
 CoordinateLsa::writeLog()
 {
   _LOG_DEBUG("Cor Lsa: ");
-  _LOG_DEBUG("  Origination Router: " << m_origRouter);
+  _LOG_DEBUG("  Origination Router: " << getOrigRouter());
   _LOG_DEBUG("  Ls Type: " << m_lsType);
   _LOG_DEBUG("  Ls Seq No: " << m_lsSeqNo);
   _LOG_DEBUG("  Ls Lifetime: " << m_expirationTimePoint);
@@ -226,7 +226,7 @@ AdjLsa::AdjLsa(const ndn::Name& origR, uint32_t lsn,
                uint32_t nl , AdjacencyList& adl)
   : Lsa(AdjLsa::TYPE_STRING)
 {
-  m_origRouter = origR;
+  setOrigRouter(origR);
   m_lsSeqNo = lsn;
   m_expirationTimePoint = lt;
   m_noLink = nl;
@@ -241,7 +241,7 @@ AdjLsa::AdjLsa(const ndn::Name& origR, uint32_t lsn,
 const ndn::Name
 AdjLsa::getKey() const
 {
-  ndn::Name key = m_origRouter;
+  ndn::Name key = getOrigRouter();
   key.append(AdjLsa::TYPE_STRING);
   return key;
 }
@@ -257,7 +257,7 @@ string
 AdjLsa::getData()
 {
   string adjLsaData;
-  adjLsaData = m_origRouter.toUri() + "|" + AdjLsa::TYPE_STRING + "|"
+  adjLsaData = getOrigRouter().toUri() + "|" + AdjLsa::TYPE_STRING + "|"
                + boost::lexical_cast<std::string>(m_lsSeqNo) + "|"
                + ndn::time::toIsoString(m_expirationTimePoint);
   adjLsaData += "|";
@@ -282,8 +282,8 @@ AdjLsa::initializeFromContent(const std::string& content)
   boost::tokenizer<boost::char_separator<char> >tokens(content, sep);
   boost::tokenizer<boost::char_separator<char> >::iterator tok_iter =
                                                tokens.begin();
-  m_origRouter = ndn::Name(*tok_iter++);
-  if (!(m_origRouter.size() > 0)) {
+  setOrigRouter(ndn::Name(*tok_iter++));
+  if (!(getOrigRouter().size() > 0)) {
     return false;
   }
   try {
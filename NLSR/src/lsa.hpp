@@ -29,6 +29,7 @@
 #include "adjacent.hpp"
 #include "name-prefix-list.hpp"
 #include "adjacency-list.hpp"
+#include "utility/shared-pool.hpp"
 
 namespace nlsr {
 
@@ -38,7 +39,7 @@ class Lsa
 {
 public:
   Lsa(const std::string& lsaType)
-    : m_origRouter()
+    : m_origRouter(util::NamePool::get(ndn::Name()))
     , m_lsType(lsaType)
     , m_lsSeqNo()
     , m_expirationTimePoint()
@@ -67,13 +68,15 @@ public:
   const ndn::Name&
   getOrigRouter() const
   {
-    return m_origRouter;
+    return *m_origRouter;
   }
 
+  /** \brief Sets the originating router, shared with all LSAs of the router in the process
+   */
   void
   setOrigRouter(const ndn::Name& org)
   {
-    m_origRouter = org;
+    m_origRouter = util::NamePool::get(org);
   }
 
   const ndn::time::system_clock::TimePoint&
@@ -101,7 +104,7 @@ public:
   }
 
 protected:
-  ndn::Name m_origRouter;
+  util::NamePool::ValuePtr m_origRouter;
   const std::string m_lsType;
   uint32_t m_lsSeqNo;
   ndn::time::system_clock::TimePoint m_expirationTimePoint;
@@ -0,0 +1,324 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "lsdb-snapshot.hpp"
+
+#include "adjacency-list.hpp"
+#include "lsdb.hpp"
+#include "name-prefix-list.hpp"
+#include "nlsr.hpp"
+#include "sequencing-manager.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <set>
+
+#include <boost/algorithm/string.hpp>
+#include <boost/property_tree/info_parser.hpp>
+#ifdef NS3_NLSR_SIM
+#include "nlsr-logger.hpp"
+#else
+#include "logger.hpp"
+#endif
+
+namespace nlsr {
+
+INIT_LOGGER("LsdbSnapshot");
+
+void
+LsdbSnapshot::capture(Lsdb& lsdb)
+{
+  const std::list<NameLsa>& nameLsdb = lsdb.getNameLsdb();
+  m_nameLsas.insert(m_nameLsas.end(), nameLsdb.begin(), nameLsdb.end());
+
+  const std::list<AdjLsa>& adjLsdb = lsdb.getAdjLsdb();
+  m_adjLsas.insert(m_adjLsas.end(), adjLsdb.begin(), adjLsdb.end());
+
+  const std::list<CoordinateLsa>& corLsdb = lsdb.getCoordinateLsdb();
+  m_corLsas.insert(m_corLsas.end(), corLsdb.begin(), corLsdb.end());
+}
+
+void
+LsdbSnapshot::addRouter(const ConfigSection& config)
+{
+  // No expiration: LSAs get a full lifetime when they are restored
+  const ndn::time::system_clock::TimePoint expirationTimePoint;
+
+  try {
+    const ConfigSection& general = config.get_child("general");
+    ndn::Name routerPrefix(general.get<std::string>("network"));
+    routerPrefix.append(ndn::Name(general.get<std::string>("site")));
+    routerPrefix.append(ndn::Name(general.get<std::string>("router")));
+
+    NamePrefixList npl;
+    boost::optional<const ConfigSection&> advertising = config.get_child_optional("advertising");
+    if (advertising) {
+      for (const auto& prefix : *advertising) {
+        if (prefix.first == "prefix") {
+          npl.insert(ndn::Name(prefix.second.data()));
+        }
+      }
+    }
+    m_nameLsas.push_back(NameLsa(routerPrefix, 1, expirationTimePoint, npl));
+
+    std::string state = config.get<std::string>("hyperbolic.state", "off");
+
+    if (!boost::iequals(state, "on")) {
+      AdjacencyList adl;
+      boost::optional<const ConfigSection&> neighbors = config.get_child_optional("neighbors");
+      if (neighbors) {
+        for (const auto& neighbor : *neighbors) {
+          if (neighbor.first != "neighbor") {
+            continue;
+          }
+          Adjacent adjacent(neighbor.second.get<std::string>("name"),
+                            neighbor.second.get<std::string>("face-uri"),
+                            neighbor.second.get<double>("link-cost",
+                                                        Adjacent::DEFAULT_LINK_COST),
+                            Adjacent::STATUS_ACTIVE, 0, 0);
+          adl.insert(adjacent);
+        }
+      }
+      // A router without neighbors has no adjacency LSA
+      if (adl.getNumOfActiveNeighbor() > 0) {
+        m_adjLsas.push_back(AdjLsa(routerPrefix, 1, expirationTimePoint,
+                                   adl.getNumOfActiveNeighbor(), adl));
+      }
+    }
+
+    if (!boost::iequals(state, "off")) {
+      m_corLsas.push_back(CoordinateLsa(routerPrefix, 1, expirationTimePoint,
+                                        config.get<double>("hyperbolic.radius"),
+                                        config.get<double>("hyperbolic.angle")));
+    }
+  }
+  catch (const boost::property_tree::ptree_error& e) {
+    throw Error(std::string("Invalid router configuration: ") + e.what());
+  }
+}
+
+void
+LsdbSnapshot::load(std::istream& input)
+{
+  const ndn::time::system_clock::TimePoint expirationTimePoint;
+
+  ConfigSection tree;
+  try {
+    boost::property_tree::read_info(input, tree);
+
+    for (const auto& section : tree) {
+      if (section.first != "router") {
+        throw Error("Unexpected section in LSDB snapshot: " + section.first);
+      }
+      const ConfigSection& router = section.second;
+      ndn::Name routerPrefix(router.get<std::string>("prefix"));
+
+      boost::optional<const ConfigSection&> nameLsa = router.get_child_optional("name-lsa");
+      if (nameLsa) {
+        NamePrefixList npl;
+        for (const auto& prefix : *nameLsa) {
+          if (prefix.first == "prefix") {
+            npl.insert(ndn::Name(prefix.second.data()));
+          }
+        }
+        m_nameLsas.push_back(NameLsa(routerPrefix, nameLsa->get<uint32_t>("seq-no"),
+                                     expirationTimePoint, npl));
+      }
+
+      boost::optional<const ConfigSection&> adjLsa = router.get_child_optional("adjacency-lsa");
+      if (adjLsa) {
+        AdjacencyList adl;
+        for (const auto& neighbor : *adjLsa) {
+          if (neighbor.first != "neighbor") {
+            continue;
+          }
+          Adjacent adjacent(neighbor.second.get<std::string>("name"),
+                            neighbor.second.get<std::string>("face-uri"),
+                            neighbor.second.get<double>("link-cost"),
+                            Adjacent::STATUS_ACTIVE, 0, 0);
+          adl.insert(adjacent);
+        }
+        m_adjLsas.push_back(AdjLsa(routerPrefix, adjLsa->get<uint32_t>("seq-no"),
+                                   expirationTimePoint, adl.getNumOfActiveNeighbor(), adl));
+      }
+
+      boost::optional<const ConfigSection&> corLsa = router.get_child_optional("coordinate-lsa");
+      if (corLsa) {
+        m_corLsas.push_back(CoordinateLsa(routerPrefix, corLsa->get<uint32_t>("seq-no"),
+                                          expirationTimePoint,
+                                          corLsa->get<double>("radius"),
+                                          corLsa->get<double>("angle")));
+      }
+    }
+  }
+  catch (const boost::property_tree::ptree_error& e) {
+    throw Error(std::string("Invalid LSDB snapshot: ") + e.what());
+  }
+}
+
+void
+LsdbSnapshot::load(const std::string& fileName)
+{
+  std::ifstream input(fileName.c_str());
+  if (!input.is_open()) {
+    throw Error("Failed to open LSDB snapshot: " + fileName);
+  }
+  load(input);
+}
+
+void
+LsdbSnapshot::save(std::ostream& output) const
+{
+  // One section per router, in the order of the router prefixes
+  std::map<ndn::Name, ConfigSection> routers;
+  auto getRouter = [&routers] (const ndn::Name& routerPrefix) -> ConfigSection& {
+    auto inserted = routers.insert(std::make_pair(routerPrefix, ConfigSection()));
+    if (inserted.second) {
+      inserted.first->second.put("prefix", routerPrefix.toUri());
+    }
+    return inserted.first->second;
+  };
+
+  for (NameLsa lsa : m_nameLsas) {
+    ConfigSection& section = getRouter(lsa.getOrigRouter()).add_child("name-lsa",
+                                                                      ConfigSection());
+    section.put("seq-no", lsa.getLsSeqNo());
+    for (const ndn::Name& name : lsa.getNpl().getNameList()) {
+      section.add("prefix", name.toUri());
+    }
+  }
+
+  for (const AdjLsa& lsa : m_adjLsas) {
+    ConfigSection& section = getRouter(lsa.getOrigRouter()).add_child("adjacency-lsa",
+                                                                      ConfigSection());
+    section.put("seq-no", lsa.getLsSeqNo());
+    for (const Adjacent& adjacent : lsa) {
+      ConfigSection& neighbor = section.add_child("neighbor", ConfigSection());
+      neighbor.put("name", adjacent.getName().toUri());
+      neighbor.put("face-uri", adjacent.getConnectingFaceUri());
+      neighbor.put("link-cost", adjacent.getLinkCost());
+    }
+  }
+
+  for (const CoordinateLsa& lsa : m_corLsas) {
+    ConfigSection& section = getRouter(lsa.getOrigRouter()).add_child("coordinate-lsa",
+                                                                      ConfigSection());
+    section.put("seq-no", lsa.getLsSeqNo());
+    section.put("radius", lsa.getCorRadius());
+    section.put("angle", lsa.getCorTheta());
+  }
+
+  ConfigSection tree;
+  for (const auto& router : routers) {
+    tree.add_child("router", router.second);
+  }
+  boost::property_tree::write_info(output, tree);
+}
+
+void
+LsdbSnapshot::save(const std::string& fileName) const
+{
+  std::ofstream output(fileName.c_str());
+  if (!output.is_open()) {
+    throw Error("Failed to write LSDB snapshot: " + fileName);
+  }
+  save(output);
+}
+
+void
+LsdbSnapshot::restore(Nlsr& nlsr) const
+{
+  ConfParameter& conf = nlsr.getConfParameter();
+  const ndn::Name& routerPrefix = conf.getRouterPrefix();
+  Lsdb& lsdb = nlsr.getLsdb();
+
+  if (std::none_of(m_nameLsas.begin(), m_nameLsas.end(),
+                   [&routerPrefix] (const NameLsa& lsa) {
+                     return lsa.getOrigRouter() == routerPrefix;
+                   })) {
+    throw Error("LSDB snapshot has no name LSA of " + routerPrefix.toUri());
+  }
+
+  _LOG_DEBUG("Restoring LSDB snapshot: " << m_nameLsas.size() << " name, "
+             << m_adjLsas.size() << " adjacency, " << m_corLsas.size() << " coordinate LSAs");
+
+  // LSAs of other routers are restored as if they had just been fetched
+  ndn::time::system_clock::TimePoint expirationTimePoint =
+    ndn::time::system_clock::now() + ndn::time::seconds(conf.getRouterDeadInterval());
+
+  std::map<ndn::Name, SequencingManager> seqNumbers;
+  std::set<ndn::Name> activeNeighbors;
+
+  // Every installed LSA would schedule the routing table calculation, done once below instead
+  nlsr.setIsRouteCalculationScheduled(true);
+
+  for (NameLsa lsa : m_nameLsas) {
+    lsa.setExpirationTimePoint(expirationTimePoint);
+    seqNumbers[lsa.getOrigRouter()].setNameLsaSeq(lsa.getLsSeqNo());
+    lsdb.installNameLsa(lsa);
+  }
+
+  for (AdjLsa lsa : m_adjLsas) {
+    lsa.setExpirationTimePoint(expirationTimePoint);
+    seqNumbers[lsa.getOrigRouter()].setAdjLsaSeq(lsa.getLsSeqNo());
+    if (lsa.getOrigRouter() == routerPrefix) {
+      for (const Adjacent& adjacent : lsa) {
+        activeNeighbors.insert(adjacent.getName());
+      }
+    }
+    lsdb.installAdjLsa(lsa);
+  }
+
+  for (CoordinateLsa lsa : m_corLsas) {
+    lsa.setExpirationTimePoint(expirationTimePoint);
+    seqNumbers[lsa.getOrigRouter()].setCorLsaSeq(lsa.getLsSeqNo());
+    lsdb.installCoordinateLsa(lsa);
+  }
+
+  const SequencingManager& ownSeqNumbers = seqNumbers[routerPrefix];
+  nlsr.getSequencingManager().setNameLsaSeq(ownSeqNumbers.getNameLsaSeq());
+  nlsr.getSequencingManager().setAdjLsaSeq(ownSeqNumbers.getAdjLsaSeq());
+  nlsr.getSequencingManager().setCorLsaSeq(ownSeqNumbers.getCorLsaSeq());
+  nlsr.getSequencingManager().writeLog();
+
+  // Hyperbolic routing does not build adjacency LSAs, so leave neighbors to HELLOs
+  if (conf.getHyperbolicState() != HYPERBOLIC_STATE_ON) {
+    for (Adjacent& adjacent : nlsr.getAdjacencyList().getAdjList()) {
+      if (activeNeighbors.count(adjacent.getName()) > 0) {
+        adjacent.setStatus(Adjacent::STATUS_ACTIVE);
+      }
+      else {
+        // As a neighbor that did not answer the last HELLO retries
+        adjacent.setStatus(Adjacent::STATUS_INACTIVE);
+        adjacent.setInterestTimedOutNo(conf.getInterestRetryNumber());
+      }
+    }
+  }
+
+  for (const auto& router : seqNumbers) {
+    nlsr.getSyncLogicHandler().restoreSyncState(router.first, router.second.getCombinedSeqNo());
+  }
+
+  nlsr.getRoutingTable().calculate(nlsr);
+}
+
+} // namespace nlsr
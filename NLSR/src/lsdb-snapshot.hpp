@@ -0,0 +1,160 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NLSR_LSDB_SNAPSHOT_HPP
+#define NLSR_LSDB_SNAPSHOT_HPP
+
+#include <iostream>
+#include <list>
+#include <stdexcept>
+#include <string>
+
+#include <boost/property_tree/ptree.hpp>
+
+#include "lsa.hpp"
+
+namespace nlsr {
+
+class Lsdb;
+class Nlsr;
+
+/** \brief LSAs of a converged network, to start NLSR instances in steady state
+
+    All LSDBs of a converged network are identical, so one snapshot serves every router:
+    a router restores all LSAs, takes the sequence numbers of its own LSAs, and sets its
+    neighbors ACTIVE if they are in its own adjacency LSA.  The sync state of a router is
+    the combined sequence number of its LSAs, so it is restored from the LSAs as well.
+
+    A snapshot is either captured from a running, converged router, or generated from the
+    configuration files of all routers, assuming every configured link is up.
+
+    The snapshot is saved in the INFO format of the NLSR configuration, one section per
+    router:
+
+        router
+        {
+          prefix /ndn/edu/memphis/%C1.Router/cs/pollux
+          name-lsa
+          {
+            seq-no 1
+            prefix /ndn/edu/memphis/cs/netlab
+          }
+          adjacency-lsa
+          {
+            seq-no 1
+            neighbor
+            {
+              name /ndn/edu/memphis/%C1.Router/cs/castor
+              face-uri udp4://10.0.0.2
+              link-cost 20
+            }
+          }
+          coordinate-lsa        ; only if hyperbolic routing is on or in dry-run
+          {
+            seq-no 1
+            radius 123.456
+            angle 1.45
+          }
+        }
+ */
+class LsdbSnapshot
+{
+public:
+  class Error : public std::runtime_error
+  {
+  public:
+    explicit
+    Error(const std::string& what)
+      : std::runtime_error(what)
+    {
+    }
+  };
+
+  typedef boost::property_tree::ptree ConfigSection;
+
+  /** \brief Adds the LSAs of \p lsdb
+   */
+  void
+  capture(Lsdb& lsdb);
+
+  /** \brief Adds the LSAs a router originates once the network has converged
+
+      \param config parsed NLSR configuration of the router
+      \throw Error the configuration misses the general section
+
+      Every neighbor in the configuration is taken as ACTIVE, and the LSAs get
+      sequence number 1, as after their first build.
+   */
+  void
+  addRouter(const ConfigSection& config);
+
+  /** \throw Error the input is not a valid snapshot
+   */
+  void
+  load(std::istream& input);
+
+  void
+  load(const std::string& fileName);
+
+  void
+  save(std::ostream& output) const;
+
+  void
+  save(const std::string& fileName) const;
+
+  /** \brief Installs the snapshot in a router being initialized
+
+      Called by Nlsr::initialize() in place of building the router's own LSAs.  Installs
+      all LSAs with a full lifetime, restores the sequence numbers, the status of the
+      neighbors and the sync state, and calculates the routing table right away.
+
+      \throw Error the snapshot has no name LSA of the router
+   */
+  void
+  restore(Nlsr& nlsr) const;
+
+  const std::list<NameLsa>&
+  getNameLsas() const
+  {
+    return m_nameLsas;
+  }
+
+  const std::list<AdjLsa>&
+  getAdjLsas() const
+  {
+    return m_adjLsas;
+  }
+
+  const std::list<CoordinateLsa>&
+  getCoordinateLsas() const
+  {
+    return m_corLsas;
+  }
+
+private:
+  std::list<NameLsa> m_nameLsas;
+  std::list<AdjLsa> m_adjLsas;
+  std::list<CoordinateLsa> m_corLsas;
+};
+
+} // namespace nlsr
+
+#endif // NLSR_LSDB_SNAPSHOT_HPP
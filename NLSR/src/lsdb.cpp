@@ -78,6 +78,7 @@ Lsdb::Lsdb(Nlsr& nlsr, ndn::Scheduler& scheduler, SyncLogicHandler& sync)
   , m_sync(sync)
   , m_lsaRefreshTime(0)
   , m_adjLsaBuildInterval(ADJ_LSA_BUILD_INTERVAL_DEFAULT)
+  , m_isSuspended(false)
 #ifdef NS3_NLSR_SIM
   , m_tracer(ns3::ndn::NlsrTracer::Instance())
 {
@@ -791,6 +792,66 @@ Lsdb::setThisRouterPrefix(std::string trp)
   m_thisRouterPrefix = trp;
 }
 
+void
+Lsdb::suspend()
+{
+  _LOG_DEBUG("Suspending LSA refresh and expiration");
+  for (const NameLsa& nlsa : m_nameLsdb) {
+    cancelScheduleLsaExpiringEvent(nlsa.getExpiringEventId());
+  }
+  for (const AdjLsa& alsa : m_adjLsdb) {
+    cancelScheduleLsaExpiringEvent(alsa.getExpiringEventId());
+  }
+  for (const CoordinateLsa& clsa : m_corLsdb) {
+    cancelScheduleLsaExpiringEvent(clsa.getExpiringEventId());
+  }
+  m_suspendTime = ndn::time::system_clock::now();
+  m_isSuspended = true;
+}
+
+void
+Lsdb::resume()
+{
+  if (!m_isSuspended) {
+    return;
+  }
+  m_isSuspended = false;
+
+  ndn::time::system_clock::Duration suspended = ndn::time::system_clock::now() - m_suspendTime;
+  _LOG_DEBUG("Resuming LSA refresh and expiration after " << suspended);
+
+  for (NameLsa& nlsa : m_nameLsdb) {
+    nlsa.setExpirationTimePoint(nlsa.getExpirationTimePoint() + suspended);
+    nlsa.setExpiringEventId(scheduleNameLsaExpiration(nlsa.getKey(), nlsa.getLsSeqNo(),
+                                                      getTimeToExpire(nlsa)));
+  }
+  for (AdjLsa& alsa : m_adjLsdb) {
+    alsa.setExpirationTimePoint(alsa.getExpirationTimePoint() + suspended);
+    alsa.setExpiringEventId(scheduleAdjLsaExpiration(alsa.getKey(), alsa.getLsSeqNo(),
+                                                     getTimeToExpire(alsa)));
+  }
+  for (CoordinateLsa& clsa : m_corLsdb) {
+    clsa.setExpirationTimePoint(clsa.getExpirationTimePoint() + suspended);
+    clsa.setExpiringEventId(scheduleCoordinateLsaExpiration(clsa.getKey(), clsa.getLsSeqNo(),
+                                                            getTimeToExpire(clsa)));
+  }
+}
+
+ndn::time::seconds
+Lsdb::getTimeToExpire(const Lsa& lsa)
+{
+  // Own LSAs were built m_lsaRefreshTime before their refresh, with a lifetime of
+  // routerDeadInterval
+  ndn::time::system_clock::TimePoint expirationTimePoint = lsa.getExpirationTimePoint();
+  if (lsa.getOrigRouter() == m_nlsr.getConfParameter().getRouterPrefix()) {
+    expirationTimePoint = expirationTimePoint -
+                          ndn::time::seconds(m_nlsr.getConfParameter().getRouterDeadInterval()) +
+                          m_lsaRefreshTime;
+  }
+  return ndn::time::duration_cast<ndn::time::seconds>(expirationTimePoint -
+                                                      ndn::time::system_clock::now());
+}
+
 void
 Lsdb::exprireOrRefreshNameLsa(const ndn::Name& lsaKey, uint64_t seqNo)
 {
@@ -925,20 +986,24 @@ Lsdb::expressInterest(const ndn::Name& interestName, uint32_t timeoutCount,
   interest.setInterestLifetime(m_nlsr.getConfParameter().getLsaInterestLifetime());
 
   _LOG_DEBUG("Fetching Data for LSA: " << interestName << " Seq number: " << seqNo);
+  // multi-segment LSAs are fetched with a window of Interests instead of one segment per RTT
+  ndn::util::SegmentFetcher::Options options;
+  options.isPipelined = true;
+
   //在fetch函数中实现发送interest
   ndn::util::SegmentFetcher::fetch(m_nlsr.getNlsrFace(), interest,
-                                   m_nlsr.getValidator(),
+                                   m_nlsr.getValidator(), options,
                                    ndn::bind(&Lsdb::afterFetchLsa, this, _1, interestName),
                                    ndn::bind(&Lsdb::onFetchLsaError, this, _1, _2, interestName,
                                              timeoutCount, deadline, lsaName, seqNo));
 
 #ifdef NS3_NLSR_SIM
   if (m_tracer.IsEnabled() && interestName.size() > intTypeLoc && interestName.get(intTypeLoc).toUri().compare("name") == 0)
-    m_tracer.NameLsaTrace(interestName.toUri(), "outNameLsaInterest", std::to_string(++m_outNlsaInterest), std::to_string(interest.wireEncode().size()));
+    m_tracer.Trace(ns3::ndn::NlsrTracer::OUT_NAME_LSA_INTEREST, interestName, ++m_outNlsaInterest, interest.wireEncode().size());
   else if (m_tracer.IsEnabled() && interestName.size() > intTypeLoc && interestName.get(intTypeLoc).toUri().compare("adjacency") == 0)
-    m_tracer.LinkLsaTrace(interestName.toUri(), "outAdjLsaInterest", std::to_string(++m_outLlsaInterest), std::to_string(interest.wireEncode().size()));
+    m_tracer.Trace(ns3::ndn::NlsrTracer::OUT_ADJ_LSA_INTEREST, interestName, ++m_outLlsaInterest, interest.wireEncode().size());
   else if (m_tracer.IsEnabled() && interestName.size() > intTypeLoc && interestName.get(intTypeLoc).toUri().compare("coordinate") == 0)
-    m_tracer.NameLsaTrace(interestName.toUri(), "outCordLsaInterest", std::to_string(++m_outClsaInterest), std::to_string(interest.wireEncode().size()));
+    m_tracer.Trace(ns3::ndn::NlsrTracer::OUT_CORD_LSA_INTEREST, interestName, ++m_outClsaInterest, interest.wireEncode().size());
 #endif
 }
 
@@ -950,11 +1015,11 @@ Lsdb::processInterest(const ndn::Name& name, const ndn::Interest& interest)
 
 #ifdef NS3_NLSR_SIM
   if (m_tracer.IsEnabled() && interestName.size() > intTypeLoc && interestName.get(intTypeLoc).toUri().compare("name") == 0)
-    m_tracer.NameLsaTrace(interestName.toUri(), "inNameLsaInterest", std::to_string(++m_inNlsaInterest), std::to_string(interest.wireEncode().size()));
+    m_tracer.Trace(ns3::ndn::NlsrTracer::IN_NAME_LSA_INTEREST, interestName, ++m_inNlsaInterest, interest.wireEncode().size());
   else if (m_tracer.IsEnabled() && interestName.size() > intTypeLoc && interestName.get(intTypeLoc).toUri().compare("adjacency") == 0)
-    m_tracer.LinkLsaTrace(interestName.toUri(), "inAdjLsaInterest", std::to_string(++m_inLlsaInterest), std::to_string(interest.wireEncode().size()));
+    m_tracer.Trace(ns3::ndn::NlsrTracer::IN_ADJ_LSA_INTEREST, interestName, ++m_inLlsaInterest, interest.wireEncode().size());
   else if (m_tracer.IsEnabled() && interestName.size() > intTypeLoc && interestName.get(intTypeLoc).toUri().compare("coordinate") == 0)
-    m_tracer.NameLsaTrace(interestName.toUri(), "inCordLsaInterest", std::to_string(++m_inClsaInterest), std::to_string(interest.wireEncode().size()));
+    m_tracer.Trace(ns3::ndn::NlsrTracer::IN_CORD_LSA_INTEREST, interestName, ++m_inClsaInterest, interest.wireEncode().size());
 #endif
 
   std::string chkString("LSA");
@@ -993,6 +1058,9 @@ Lsdb::putLsaData(const ndn::Interest& interest, const std::string& content)
                                 m_nlsr.getKeyChain(),
                                 m_lsaRefreshTime,
                                 content);
+#ifdef NS3_NLSR_SIM
+  publisher.setCryptoProfile(&m_nlsr.getCryptoProfile());
+#endif
   publisher.publish(interest.getName(),
                     ndn::security::signingByCertificate(m_nlsr.getDefaultCertName()));
 
@@ -1080,7 +1148,7 @@ Lsdb::onContentValidated(const ndn::shared_ptr<const ndn::Data>& data)
       //_LOG_DEBUG_YMZ("Received Name LSA" + dataName.toUri());
       #ifdef NS3_NLSR_SIM
       if (m_tracer.IsEnabled())
-        m_tracer.NameLsaTrace(data->getName().toUri(), "inNameLsaData", std::to_string(++m_inNlsaData), std::to_string(data->getContent().value_size() + data->getName().toUri().size()));
+        m_tracer.Trace(ns3::ndn::NlsrTracer::IN_NAME_LSA_DATA, data->getName(), ++m_inNlsaData, data->getContent().value_size() + m_tracer.GetUriLength(data->getName()));
       #endif
       processContentNameLsa(originRouter.append(interestedLsType), seqNo, dataContent);
     }
@@ -1088,7 +1156,7 @@ Lsdb::onContentValidated(const ndn::shared_ptr<const ndn::Data>& data)
       //_LOG_DEBUG_YMZ("Received Adj LSA");
       #ifdef NS3_NLSR_SIM
       if (m_tracer.IsEnabled())
-        m_tracer.LinkLsaTrace(data->getName().toUri(), "inAdjLsaData", std::to_string(++m_inLlsaData), std::to_string(data->getContent().value_size() + data->getName().toUri().size()));
+        m_tracer.Trace(ns3::ndn::NlsrTracer::IN_ADJ_LSA_DATA, data->getName(), ++m_inLlsaData, data->getContent().value_size() + m_tracer.GetUriLength(data->getName()));
       #endif
       processContentAdjacencyLsa(originRouter.append(interestedLsType), seqNo, dataContent);
     }
@@ -1096,7 +1164,7 @@ Lsdb::onContentValidated(const ndn::shared_ptr<const ndn::Data>& data)
       //_LOG_DEBUG_YMZ("Received Coordinate LSA");
       #ifdef NS3_NLSR_SIM
       if (m_tracer.IsEnabled())
-        m_tracer.NameLsaTrace(data->getName().toUri(), "inNameLsaData", std::to_string(++m_inClsaData), std::to_string(data->getContent().value_size() + data->getName().toUri().size()));
+        m_tracer.Trace(ns3::ndn::NlsrTracer::IN_NAME_LSA_DATA, data->getName(), ++m_inClsaData, data->getContent().value_size() + m_tracer.GetUriLength(data->getName()));
       #endif
       processContentCoordinateLsa(originRouter.append(interestedLsType), seqNo, dataContent);
     }
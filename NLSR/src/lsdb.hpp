@@ -138,6 +138,19 @@ public:
   void
   setThisRouterPrefix(std::string trp);
 
+  /** \brief Freezes the lifetime of all LSAs
+
+      Own LSAs are not refreshed and other routers' LSAs do not expire until resume(),
+      which is only safe when all routers suspend together.
+   */
+  void
+  suspend();
+
+  /** \brief Resumes refresh and expiration, with lifetimes extended by the suspended time
+   */
+  void
+  resume();
+
   void
   expressInterest(const ndn::Name& interestName, uint32_t timeoutCount,
                   steady_clock::TimePoint deadline = DEFAULT_LSA_RETRIEVAL_DEADLINE);
@@ -146,6 +159,11 @@ public:
   processInterest(const ndn::Name& name, const ndn::Interest& interest);
 
 private:
+  /** \brief Time until an LSA is refreshed (own LSA) or expires (other routers' LSA)
+   */
+  ndn::time::seconds
+  getTimeToExpire(const Lsa& lsa);
+
   bool
   addNameLsa(NameLsa& nlsa);
 
@@ -291,6 +309,9 @@ private:
 
   ndn::time::seconds m_adjLsaBuildInterval;
 
+  bool m_isSuspended;
+  ndn::time::system_clock::TimePoint m_suspendTime;
+
   std::string m_instanceId;
   static int m_instanceCounter;  //ymz
 
@@ -27,6 +27,7 @@
 
 #include "nlsr.hpp"
 #include "adjacent.hpp"
+#include "lsdb-snapshot.hpp"
 #ifdef NS3_NLSR_SIM
 #include "nlsr-logger.hpp"
 #include "ns3/object.h"
@@ -86,6 +87,7 @@ Nlsr::Nlsr(boost::asio::io_service& ioService, ndn::Scheduler& scheduler, ndn::F
   , m_certificateCache(new ndn::CertificateCacheTtl(ioService))
   , m_validator(m_nlsrFace, DEFAULT_BROADCAST_PREFIX, m_certificateCache, m_certStore)
   , m_keyChain(keyChain)
+  , m_cryptoProfile(keyChain, scheduler)
   , m_prefixUpdateProcessor(m_nlsrFace,
                             m_namePrefixList,
                             m_nlsrLsdb,
@@ -97,6 +99,8 @@ Nlsr::Nlsr(boost::asio::io_service& ioService, ndn::Scheduler& scheduler, ndn::F
   , m_faceMonitor(m_nlsrFace)
   , m_firstHelloInterval(FIRST_HELLO_INTERVAL_DEFAULT)
 {
+  m_validator.setCryptoProfile(&m_cryptoProfile);
+
   m_faceMonitor.onNotification.connect(bind(&Nlsr::onFaceEventNotification, this, _1));
   m_faceMonitor.start();
 }
@@ -260,6 +264,7 @@ Nlsr::initialize()
   /* Logging end */
 #ifdef NS3_NLSR_SIM
   //initializeKey();
+  m_fib.setCommandSigningInfo(m_cryptoProfile.getCommandSigningInfo());
 #else
   initializeKey();
 #endif
@@ -273,11 +278,14 @@ Nlsr::initialize()
   m_nlsrLsdb.setAdjLsaBuildInterval(m_confParam.getAdjLsaBuildInterval());
   m_routingTable.setRoutingCalcInterval(m_confParam.getRoutingCalcInterval());
 
-  m_nlsrLsdb.buildAndInstallOwnNameLsa();
+  // With a snapshot, own LSAs are restored at the end of initialization
+  if (m_lsdbSnapshot == nullptr) {
+    m_nlsrLsdb.buildAndInstallOwnNameLsa();
 
-  // Install coordinate LSAs if using HR or dry-run HR.
-  if (m_confParam.getHyperbolicState() != HYPERBOLIC_STATE_OFF) {
-    m_nlsrLsdb.buildAndInstallOwnCoordinateLsa();
+    // Install coordinate LSAs if using HR or dry-run HR.
+    if (m_confParam.getHyperbolicState() != HYPERBOLIC_STATE_OFF) {
+      m_nlsrLsdb.buildAndInstallOwnCoordinateLsa();
+    }
   }
 
   registerKeyPrefix();
@@ -295,6 +303,10 @@ Nlsr::initialize()
       it->setLinkCost(0);
     }
   }
+
+  if (m_lsdbSnapshot != nullptr) {
+    m_lsdbSnapshot->restore(*this);
+  }
 }
 
 void
@@ -379,9 +391,14 @@ Nlsr::onKeyInterest(const ndn::Name& name, const ndn::Interest& interest)
   ndn::shared_ptr<ndn::Data> data = ndn::make_shared<ndn::Data>();
   data->setName(interestName);
   data->setContent(cert->wireEncode());
+#ifdef NS3_NLSR_SIM
+  m_cryptoProfile.sign(*data, ndn::security::signingWithSha256());
+  m_cryptoProfile.put(m_nlsrFace, data);
+#else
   m_keyChain.signWithSha256(*data);
 
   m_nlsrFace.put(*data);
+#endif
 }
 
 void
@@ -413,6 +430,45 @@ Nlsr::destroyFaces()
   }
 }
 
+bool
+Nlsr::isQuiescent()
+{
+  if (m_isBuildAdjLsaSheduled || m_isRouteCalculationScheduled || !m_faceDownEvents.empty()) {
+    return false;
+  }
+
+  for (Adjacent& adjacent : m_adjacencyList.getAdjList()) {
+    if (adjacent.getFaceId() == 0) {
+      return false;
+    }
+    if (adjacent.getStatus() == Adjacent::STATUS_ACTIVE ?
+        adjacent.getInterestTimedOutNo() != 0 :
+        adjacent.getInterestTimedOutNo() < m_confParam.getInterestRetryNumber()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void
+Nlsr::suspend()
+{
+  _LOG_DEBUG("Suspending periodic tasks");
+  m_helloProtocol.suspend();
+  m_syncLogicHandler.suspend();
+  m_nlsrLsdb.suspend();
+}
+
+uint64_t
+Nlsr::resume()
+{
+  _LOG_DEBUG("Resuming periodic tasks");
+  m_nlsrLsdb.resume();
+  uint64_t nSuppressed = m_syncLogicHandler.resume();
+  nSuppressed += m_helloProtocol.resume();
+  return nSuppressed;
+}
+
 
 
 
@@ -422,8 +478,14 @@ Nlsr::onFaceEventNotification(const ndn::nfd::FaceEventNotification& faceEventNo
   _LOG_TRACE("Nlsr::onFaceEventNotification called");
   ndn::nfd::FaceEventKind kind = faceEventNotification.getKind();
 
+  uint64_t faceId = faceEventNotification.getFaceId();
+
   if (kind == ndn::nfd::FACE_EVENT_DESTROYED) {
-    uint64_t faceId = faceEventNotification.getFaceId();
+    std::map<uint64_t, ndn::EventId>::iterator it = m_faceDownEvents.find(faceId);
+    if (it != m_faceDownEvents.end()) {
+      m_scheduler.cancelEvent(it->second);
+      m_faceDownEvents.erase(it);
+    }
 
     Adjacent* adjacent = m_adjacencyList.findAdjacent(faceId);
 
@@ -431,37 +493,87 @@ Nlsr::onFaceEventNotification(const ndn::nfd::FaceEventNotification& faceEventNo
       _LOG_DEBUG("Face to " << adjacent->getName() << " with face id: " << faceId << " destroyed");
 
       adjacent->setFaceId(0);
+      setAdjacentInactive(*adjacent);
+    }
+  }
+  else if (kind == ndn::nfd::FACE_EVENT_DOWN) {
+    Adjacent* adjacent = m_adjacencyList.findAdjacent(faceId);
 
-      // Only trigger an Adjacency LSA build if this node is changing from ACTIVE to INACTIVE
-      // since this rebuild will effectively cancel the previous Adjacency LSA refresh event
-      // and schedule a new one further in the future.
-      //
-      // Continuously scheduling the refresh in the future will block the router from refreshing
-      // its Adjacency LSA. Since other routers' Name prefixes' expiration times are updated
-      // when this router refreshes its Adjacency LSA, the other routers' prefixes will expire
-      // and be removed from the RIB.
-      //
-      // This check is required to fix Bug #2733 for now. This check would be unnecessary
-      // to fix Bug #2733 when Issue #2732 is completed, but the check also helps with
-      // optimization so it can remain even when Issue #2732 is implemented.
-      if (adjacent->getStatus() == Adjacent::STATUS_ACTIVE) {
-        adjacent->setStatus(Adjacent::STATUS_INACTIVE);
-
-        // A new adjacency LSA cannot be built until the neighbor is marked INACTIVE and
-        // has met the HELLO retry threshold
-        adjacent->setInterestTimedOutNo(m_confParam.getInterestRetryNumber());
-
-        if (m_confParam.getHyperbolicState() != HYPERBOLIC_STATE_OFF) {
-          getRoutingTable().scheduleRoutingTableCalculation(*this);
-        }
-        else {
-          m_nlsrLsdb.scheduleAdjLsaBuild();
-        }
+    if (adjacent != nullptr && m_faceDownEvents.count(faceId) == 0) {
+      _LOG_DEBUG("Face to " << adjacent->getName() << " with face id: " << faceId << " down");
+
+      // The face is kept, so that HELLOs find the neighbor again when the link comes back up
+      uint32_t holdDown = m_confParam.getFaceDownHoldDown();
+      if (holdDown == 0) {
+        setAdjacentInactive(*adjacent);
+      }
+      else {
+        m_faceDownEvents[faceId] =
+          m_scheduler.scheduleEvent(ndn::time::seconds(holdDown),
+                                    ndn::bind(&Nlsr::onFaceDownHoldDownExpired, this, faceId));
       }
     }
   }
+  else if (kind == ndn::nfd::FACE_EVENT_UP) {
+    // The neighbor was not set INACTIVE if the face comes back up during the hold-down
+    std::map<uint64_t, ndn::EventId>::iterator it = m_faceDownEvents.find(faceId);
+    if (it != m_faceDownEvents.end()) {
+      m_scheduler.cancelEvent(it->second);
+      m_faceDownEvents.erase(it);
+    }
+
+    Adjacent* adjacent = m_adjacencyList.findAdjacent(faceId);
+
+    if (adjacent != nullptr && adjacent->getStatus() == Adjacent::STATUS_INACTIVE) {
+      _LOG_DEBUG("Face to " << adjacent->getName() << " with face id: " << faceId << " up");
+
+      // The neighbor is set ACTIVE by the HELLO Data
+      m_helloProtocol.sendHelloInterest(adjacent->getName());
+    }
+  }
 }
 
+void
+Nlsr::onFaceDownHoldDownExpired(uint64_t faceId)
+{
+  m_faceDownEvents.erase(faceId);
+
+  Adjacent* adjacent = m_adjacencyList.findAdjacent(faceId);
+  if (adjacent != nullptr) {
+    setAdjacentInactive(*adjacent);
+  }
+}
+
+void
+Nlsr::setAdjacentInactive(Adjacent& adjacent)
+{
+  // Only trigger an Adjacency LSA build if this node is changing from ACTIVE to INACTIVE
+  // since this rebuild will effectively cancel the previous Adjacency LSA refresh event
+  // and schedule a new one further in the future.
+  //
+  // Continuously scheduling the refresh in the future will block the router from refreshing
+  // its Adjacency LSA. Since other routers' Name prefixes' expiration times are updated
+  // when this router refreshes its Adjacency LSA, the other routers' prefixes will expire
+  // and be removed from the RIB.
+  //
+  // This check is required to fix Bug #2733 for now. This check would be unnecessary
+  // to fix Bug #2733 when Issue #2732 is completed, but the check also helps with
+  // optimization so it can remain even when Issue #2732 is implemented.
+  if (adjacent.getStatus() == Adjacent::STATUS_ACTIVE) {
+    adjacent.setStatus(Adjacent::STATUS_INACTIVE);
+
+    // A new adjacency LSA cannot be built until the neighbor is marked INACTIVE and
+    // has met the HELLO retry threshold
+    adjacent.setInterestTimedOutNo(m_confParam.getInterestRetryNumber());
+
+    if (m_confParam.getHyperbolicState() != HYPERBOLIC_STATE_OFF) {
+      getRoutingTable().scheduleRoutingTableCalculation(*this);
+    }
+    else {
+      m_nlsrLsdb.scheduleAdjLsaBuild();
+    }
+  }
+}
 
 void
 Nlsr::startEventLoop()
@@ -23,6 +23,7 @@
 #define NLSR_HPP
 
 #include <boost/cstdint.hpp>
+#include <map>
 #include <stdexcept>
 
 #include <ndn-cxx/face.hpp>
@@ -47,6 +48,7 @@
 #include "route/name-prefix-table.hpp"
 #include "route/routing-table.hpp"
 #include "security/certificate-store.hpp"
+#include "security/crypto-profile.hpp"
 #include "update/prefix-update-processor.hpp"
 #include "utility/name-helper.hpp"
 
@@ -58,6 +60,8 @@ namespace nlsr {
 
 static ndn::Name DEFAULT_BROADCAST_PREFIX("/ndn/broadcast");
 
+class LsdbSnapshot;
+
 #ifdef NS3_NLSR_SIM
 class Nlsr : public ns3::Object
 #else
@@ -289,6 +293,14 @@ public:
     return m_keyChain;
   }
 
+#ifdef NS3_NLSR_SIM
+  security::CryptoProfile&
+  getCryptoProfile()
+  {
+    return m_cryptoProfile;
+  }
+#endif
+
   const ndn::Name&
   getDefaultCertName()
   {
@@ -321,6 +333,44 @@ public:
     return m_firstHelloInterval;
   }
 
+  /** \brief Starts from a converged LSDB instead of building it through HELLOs and sync
+
+      Must be set before initialize().  The snapshot is not modified, so one instance
+      can be shared by all routers of a simulation.
+   */
+  void
+  setLsdbSnapshot(ndn::shared_ptr<const LsdbSnapshot> snapshot)
+  {
+    m_lsdbSnapshot = snapshot;
+  }
+
+  /** \brief Whether no change of the routing state of this router is under way
+
+      True when no adjacency LSA build, routing calculation or face hold-down is pending,
+      and every neighbor has a face and is either ACTIVE without timed out HELLOs, or
+      INACTIVE after all HELLO retries.  LSAs being fetched are not taken into account: the network is
+      quiescent when, in addition, all routers have had the same sync digest for a while.
+   */
+  bool
+  isQuiescent();
+
+  /** \brief Stops periodic HELLOs, sync Interests, and LSA refresh and expiration
+
+      Used by simulations to skip quiescent periods: all routers suspend together, and all
+      resume before an event that may change the topology.
+   */
+  void
+  suspend();
+
+  /** \brief Resumes periodic tasks as if they had run while suspended
+
+      LSA lifetimes are extended by the suspended time.
+
+      \return the number of HELLO and sync Interests that were not sent
+   */
+  uint64_t
+  resume();
+
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   void
   addCertificateToCache(ndn::shared_ptr<ndn::IdentityCertificate> certificate)
@@ -358,6 +408,17 @@ private:
   void
   onFaceEventNotification(const ndn::nfd::FaceEventNotification& faceEventNotification);
 
+  /** \brief Sets the neighbor on face \p faceId INACTIVE, after its face went DOWN
+   */
+  void
+  onFaceDownHoldDownExpired(uint64_t faceId);
+
+  /** \brief Sets \p adjacent INACTIVE as if all its HELLO retries had timed out, and
+              updates the adjacency LSA or the routing table
+   */
+  void
+  setAdjacentInactive(Adjacent& adjacent);
+
   void
   setFirstHelloInterval(uint32_t interval)
   {
@@ -396,6 +457,7 @@ private:
   Validator m_validator;
 #ifdef NS3_NLSR_SIM
   ndn::KeyChain& m_keyChain;
+  security::CryptoProfile m_cryptoProfile;
 #else
   ndn::KeyChain m_keyChain;
 #endif
@@ -404,8 +466,11 @@ private:
   update::PrefixUpdateProcessor m_prefixUpdateProcessor;
 
   ndn::nfd::FaceMonitor m_faceMonitor;
+  // faces that went DOWN, during their hold-down
+  std::map<uint64_t, ndn::EventId> m_faceDownEvents;
 
   uint32_t m_firstHelloInterval;
+  ndn::shared_ptr<const LsdbSnapshot> m_lsdbSnapshot;
 };
 
 } //namespace nlsr
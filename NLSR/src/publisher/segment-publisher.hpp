@@ -29,6 +29,10 @@
 #include <ndn-cxx/encoding/encoding-buffer.hpp>
 #include <ndn-cxx/security/key-chain.hpp>
 
+#ifdef NS3_NLSR_SIM
+#include "security/crypto-profile.hpp"
+#endif
+
 namespace nlsr {
 
 /** \brief provides a publisher of Status Dataset or other segmented octet stream
@@ -44,6 +48,9 @@ public:
     : m_face(face)
     , m_keyChain(keyChain)
     , m_freshnessPeriod(freshnessPeriod)
+#ifdef NS3_NLSR_SIM
+    , m_cryptoProfile(nullptr)
+#endif
   {
   }
 
@@ -52,6 +59,16 @@ public:
   {
   }
 
+#ifdef NS3_NLSR_SIM
+  /** \brief signs and sends segments through \p cryptoProfile instead of the KeyChain
+   */
+  void
+  setCryptoProfile(security::CryptoProfile* cryptoProfile)
+  {
+    m_cryptoProfile = cryptoProfile;
+  }
+#endif
+
   static size_t
   getMaxSegmentSize()
   {
@@ -115,6 +132,13 @@ private:
   void
   publishSegment(ndn::shared_ptr<ndn::Data>& data, const ndn::security::SigningInfo& signingInfo)
   {
+#ifdef NS3_NLSR_SIM
+    if (m_cryptoProfile != nullptr) {
+      m_cryptoProfile->sign(*data, signingInfo);
+      m_cryptoProfile->put(m_face, data);
+      return;
+    }
+#endif
     m_keyChain.sign(*data, signingInfo);
     m_face.put(*data);
   }
@@ -123,6 +147,9 @@ private:
   FaceBase& m_face;
   ndn::KeyChain& m_keyChain;
   const ndn::time::milliseconds m_freshnessPeriod;
+#ifdef NS3_NLSR_SIM
+  security::CryptoProfile* m_cryptoProfile;
+#endif
 };
 
 } // namespace nlsr
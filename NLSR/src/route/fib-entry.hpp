@@ -32,6 +32,7 @@
 
 #include "nexthop.hpp"
 #include "nexthop-list.hpp"
+#include "utility/shared-pool.hpp"
 
 namespace nlsr {
 
@@ -39,7 +40,7 @@ class FibEntry
 {
 public:
   FibEntry()
-    : m_name()
+    : m_name(util::NamePool::get(ndn::Name()))
     , m_expirationTimePoint()
     , m_seqNo(0)
     , m_nexthopList()
@@ -47,17 +48,17 @@ public:
   }
 
   FibEntry(const ndn::Name& name)
-    : m_expirationTimePoint()
+    : m_name(util::NamePool::get(name))
+    , m_expirationTimePoint()
     , m_seqNo(0)
     , m_nexthopList()
   {
-    m_name = name;
   }
 
   const ndn::Name&
   getName() const
   {
-    return m_name;
+    return *m_name;
   }
 
   NexthopList&
@@ -66,6 +67,12 @@ public:
     return m_nexthopList;
   }
 
+  const NexthopList&
+  getNexthopList() const
+  {
+    return m_nexthopList;
+  }
+
   const ndn::time::system_clock::TimePoint&
   getExpirationTimePoint() const
   {
@@ -106,7 +113,7 @@ public:
   writeLog();
 
 private:
-  ndn::Name m_name;
+  util::NamePool::ValuePtr m_name;
   ndn::time::system_clock::TimePoint m_expirationTimePoint;
   ndn::EventId m_expiringEventId;
   int32_t m_seqNo;
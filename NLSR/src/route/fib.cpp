@@ -322,7 +322,8 @@ Fib::destroyFaceInNfd(const ndn::nfd::ControlParameters& faceDestroyResult,
     .setFaceId(faceDestroyResult.getFaceId());
   m_controller.start<ndn::nfd::FaceDestroyCommand>(faceParameters,
                                                    onSuccess,
-                                                   onFailure);
+                                                   onFailure,
+                                                   m_commandOptions);
 }
 
 void
@@ -392,7 +393,8 @@ Fib::registerPrefixInNfd(ndn::nfd::ControlParameters& parameters,
                                                              this, _1, _2,
                                                              "Failed in name registration",
                                                              parameters,
-                                                             faceUri, times));
+                                                             faceUri, times),
+                                                   m_commandOptions);
 }
 
 void
@@ -412,7 +414,8 @@ Fib::registerPrefixInNfd(const ndn::nfd::ControlParameters& faceCreateResult,
     .setOrigin(128);
   m_controller.start<ndn::nfd::RibRegisterCommand>(controlParameters,
                                                    onSuccess,
-                                                   onFailure);
+                                                   onFailure,
+                                                   m_commandOptions);
 }
 
 void
@@ -431,7 +434,8 @@ Fib::unregisterPrefix(const ndn::Name& namePrefix, const std::string& faceUri)
                                                                "Successful in unregistering name"),
                                                      ndn::bind(&Fib::onUnregistrationFailure,
                                                                this, _1, _2,
-                                                               "Failed in unregistering name"));
+                                                               "Failed in unregistering name"),
+                                                     m_commandOptions);
   }
 }
 
@@ -449,7 +453,8 @@ Fib::setStrategy(const ndn::Name& name, const std::string& strategy, uint32_t co
                                                          bind(&Fib::onSetStrategyFailure, this, _1, _2,
                                                               parameters,
                                                               count,
-                                                              "Failed to set strategy choice"));
+                                                              "Failed to set strategy choice"),
+                                                         m_commandOptions);
 }
 
 void
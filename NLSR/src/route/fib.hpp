@@ -50,6 +50,7 @@ public:
     , m_table()
     , m_refreshTime(0)
     , m_controller(face, keyChain)
+    , m_commandOptions()
     , m_faceController(face.getIoService(), m_controller)
     , m_faceMap()
     , m_adjacencyList(adjacencyList)
@@ -76,6 +77,23 @@ public:
     m_refreshTime = fert;
   }
 
+  /** \brief returns the entries currently installed by NLSR, e.g., to compare them against
+   *         reference routes in simulations
+   */
+  const std::list<FibEntry>&
+  getTable() const
+  {
+    return m_table;
+  }
+
+  /** \brief sets how RIB and strategy-choice commands are signed
+   */
+  void
+  setCommandSigningInfo(const ndn::security::SigningInfo& signingInfo)
+  {
+    m_commandOptions.setSigningInfo(signingInfo);
+  }
+
 private:
   bool
   isPrefixUpdatable(const ndn::Name& name);
@@ -189,6 +207,7 @@ private:
   std::list<FibEntry> m_table;
   int32_t m_refreshTime;
   ndn::nfd::Controller m_controller;
+  ndn::nfd::CommandOptions m_commandOptions;
   util::FaceController m_faceController;
 
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
@@ -26,13 +26,15 @@
 #include <boost/cstdint.hpp>
 #include <ndn-cxx/name.hpp>
 
+#include "utility/shared-pool.hpp"
+
 namespace nlsr {
 
 class MapEntry
 {
 public:
   MapEntry()
-    : m_router()
+    : m_router(util::NamePool::get(ndn::Name()))
     , m_mappingNumber(-1)
   {
   }
@@ -43,14 +45,14 @@ public:
 
   MapEntry(const ndn::Name& rtr, int32_t mn)
   {
-    m_router = rtr;
+    m_router = util::NamePool::get(rtr);
     m_mappingNumber = mn;
   }
 
   const ndn::Name&
   getRouter() const
   {
-    return m_router;
+    return *m_router;
   }
 
   int32_t
@@ -60,7 +62,7 @@ public:
   }
 
 private:
-  ndn::Name m_router;
+  util::NamePool::ValuePtr m_router;
   int32_t m_mappingNumber;
 };
 
@@ -93,7 +93,7 @@ NamePrefixTableEntry::addRoutingTableEntry(RoutingTableEntry& rte)
 void
 NamePrefixTableEntry::writeLog()
 {
-  _LOG_DEBUG("Name: " << m_namePrefix);
+  _LOG_DEBUG("Name: " << *m_namePrefix);
   for (std::list<RoutingTableEntry>::iterator it = m_rteList.begin();
        it != m_rteList.end(); ++it) {
     _LOG_DEBUG("Destination: " << (*it).getDestination());
@@ -33,11 +33,12 @@ class NamePrefixTableEntry
 {
 public:
   NamePrefixTableEntry()
+    : m_namePrefix(util::NamePool::get(ndn::Name()))
   {
   }
 
   NamePrefixTableEntry(const ndn::Name& namePrefix)
-    : m_namePrefix(namePrefix)
+    : m_namePrefix(util::NamePool::get(namePrefix))
     , m_nexthopList()
   {
   }
@@ -45,7 +46,7 @@ public:
   const ndn::Name&
   getNamePrefix() const
   {
-    return m_namePrefix;
+    return *m_namePrefix;
   }
 
   const std::list<RoutingTableEntry>&
@@ -90,7 +91,7 @@ public:
   writeLog();
 
 private:
-  ndn::Name m_namePrefix;
+  util::NamePool::ValuePtr m_namePrefix;
   std::list<RoutingTableEntry> m_rteList;
   NexthopList m_nexthopList;
 };
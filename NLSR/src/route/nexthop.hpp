@@ -24,6 +24,7 @@
 #define NLSR_NEXTHOP_HPP
 
 #include "test-access-control.hpp"
+#include "utility/shared-pool.hpp"
 
 #include <iostream>
 #include <cmath>
@@ -34,29 +35,29 @@ class NextHop
 {
 public:
   NextHop()
-    : m_connectingFaceUri()
+    : m_connectingFaceUri(util::StringPool::get(std::string()))
     , m_routeCost(0)
     , m_isHyperbolic(false)
   {
   }
 
   NextHop(const std::string& cfu, double rc)
-    : m_isHyperbolic(false)
+    : m_connectingFaceUri(util::StringPool::get(cfu))
+    , m_isHyperbolic(false)
   {
-    m_connectingFaceUri = cfu;
     m_routeCost = rc;
   }
 
   const std::string&
   getConnectingFaceUri() const
   {
-    return m_connectingFaceUri;
+    return *m_connectingFaceUri;
   }
 
   void
   setConnectingFaceUri(const std::string& cfu)
   {
-    m_connectingFaceUri = cfu;
+    m_connectingFaceUri = util::StringPool::get(cfu);
   }
 
   uint64_t
@@ -98,7 +99,7 @@ public:
   }
 
 private:
-  std::string m_connectingFaceUri;
+  util::StringPool::ValuePtr m_connectingFaceUri;
   double m_routeCost;
   bool m_isHyperbolic;
 
@@ -226,7 +226,7 @@ LinkStateRoutingTableCalculator::calculatePath(Map& pMap,
     addAllLsNextHopsToRoutingTable(pnlsr, rt, pMap, sourceRouter);
 #ifdef NS3_NLSR_SIM
     if (m_tracer.IsEnabled()) {
-      m_tracer.FibTrace("-", "dijkSinglePath", std::to_string(++m_dijkSinglePath));
+      m_tracer.Trace(ns3::ndn::NlsrTracer::DIJK_SINGLE_PATH, ++m_dijkSinglePath);
     }
 #endif
   }
@@ -246,7 +246,7 @@ LinkStateRoutingTableCalculator::calculatePath(Map& pMap,
     }
 #ifdef NS3_NLSR_SIM
     if (m_tracer.IsEnabled()) {
-      m_tracer.FibTrace("-", "dijkMultiPath", std::to_string(++m_dijkMultiPath));
+      m_tracer.Trace(ns3::ndn::NlsrTracer::DIJK_MULTI_PATH, ++m_dijkMultiPath);
     }
 #endif
     freeLinks();
@@ -455,10 +455,10 @@ HyperbolicRoutingCalculator::calculatePaths(Map& map, RoutingTable& rt,
   }
 #ifdef NS3_NLSR_SIM
   if(m_tracer.IsEnabled() && !m_isDryRun) {
-    m_tracer.FibTrace("-", "hyperbolRouting", std::to_string(++m_hyperbolRouting));
+    m_tracer.Trace(ns3::ndn::NlsrTracer::HYPERBOL_ROUTING, ++m_hyperbolRouting);
   } else  {
     if (m_tracer.IsEnabled()) {
-      m_tracer.FibTrace("-", "hyperDryRouting", std::to_string(++m_hyperDryRouting));
+      m_tracer.Trace(ns3::ndn::NlsrTracer::HYPER_DRY_ROUTING, ++m_hyperDryRouting);
     }
   }
 #endif
@@ -26,6 +26,7 @@
 #include <iostream>
 #include <ndn-cxx/name.hpp>
 #include "nexthop-list.hpp"
+#include "utility/shared-pool.hpp"
 
 namespace nlsr {
 
@@ -33,6 +34,7 @@ class RoutingTableEntry
 {
 public:
   RoutingTableEntry()
+    : m_destination(util::NamePool::get(ndn::Name()))
   {
   }
 
@@ -42,13 +44,13 @@ public:
 
   RoutingTableEntry(const ndn::Name& dest)
   {
-    m_destination = dest;
+    m_destination = util::NamePool::get(dest);
   }
 
   const ndn::Name&
   getDestination() const
   {
-    return m_destination;
+    return *m_destination;
   }
 
   NexthopList&
@@ -58,7 +60,7 @@ public:
   }
 
 private:
-  ndn::Name m_destination;
+  util::NamePool::ValuePtr m_destination;
   NexthopList m_nexthopList;
 };
 
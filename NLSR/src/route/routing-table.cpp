@@ -79,6 +79,7 @@ RoutingTable::calculate(Nlsr& pnlsr)
         clearDryRoutingTable();
 
         _LOG_DEBUG("Calculating routing table");
+        ++m_nCalculations;
 
         // calculate Link State routing
         if ((pnlsr.getConfParameter().getHyperbolicState() == HYPERBOLIC_STATE_OFF)
@@ -48,6 +48,7 @@ public:
     : m_scheduler(scheduler)
     , m_NO_NEXT_HOP(-12345)
     , m_routingCalcInterval(static_cast<uint32_t>(ROUTING_CALC_INTERVAL_DEFAULT))
+    , m_nCalculations(0)
   {
     m_instanceId = string("Instance " + boost::lexical_cast<string>(m_instanceCounter++) + " ");  //ymz
   }
@@ -85,6 +86,14 @@ public:
     return m_routingCalcInterval;
   }
 
+  /** \brief returns how many times the routing table has been recalculated
+   */
+  uint64_t
+  getNCalculations() const
+  {
+    return m_nCalculations;
+  }
+
 private:
   void
   calculateLsRoutingTable(Nlsr& pnlsr);
@@ -113,6 +122,7 @@ private:
   std::list<RoutingTableEntry> m_dryTable;
 
   ndn::time::seconds m_routingCalcInterval;
+  uint64_t m_nCalculations;
 
   std::string m_instanceId;
   static int m_instanceCounter;  //ymz
@@ -0,0 +1,126 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "crypto-profile.hpp"
+
+#include <ndn-cxx/encoding/block-helpers.hpp>
+#include <ndn-cxx/security/digest-sha256.hpp>
+
+namespace nlsr {
+namespace security {
+
+static const uint8_t NULL_SIGNATURE_VALUE[32] = {0};
+
+CryptoProfile::CryptoProfile(ndn::KeyChain& keyChain, ndn::Scheduler& scheduler)
+  : m_keyChain(keyChain)
+  , m_scheduler(scheduler)
+  , m_mode(MODE_REAL)
+  , m_signingDelay(ndn::time::nanoseconds::zero())
+  , m_validationDelay(ndn::time::nanoseconds::zero())
+  , m_cpuBusyUntil(ndn::time::steady_clock::TimePoint::min())
+  , m_nSignatures(0)
+  , m_nVerifications(0)
+{
+}
+
+bool
+CryptoProfile::parseMode(const std::string& str, Mode& mode)
+{
+  if (str == "real") {
+    mode = MODE_REAL;
+  }
+  else if (str == "digest-sha256") {
+    mode = MODE_DIGEST_SHA256;
+  }
+  else if (str == "null") {
+    mode = MODE_NULL;
+  }
+  else {
+    return false;
+  }
+  return true;
+}
+
+void
+CryptoProfile::sign(ndn::Data& data, const ndn::security::SigningInfo& signingInfo)
+{
+  switch (m_mode) {
+  case MODE_REAL:
+    m_keyChain.sign(data, signingInfo);
+    break;
+  case MODE_DIGEST_SHA256:
+    m_keyChain.sign(data, ndn::security::signingWithSha256());
+    break;
+  case MODE_NULL: {
+    static const ndn::Block signatureValue =
+      ndn::makeBinaryBlock(ndn::tlv::SignatureValue,
+                           NULL_SIGNATURE_VALUE, sizeof(NULL_SIGNATURE_VALUE));
+    data.setSignature(ndn::DigestSha256());
+    data.setSignatureValue(signatureValue);
+    data.wireEncode();
+    break;
+  }
+  }
+
+  ++m_nSignatures;
+  chargeCpu(m_signingDelay);
+}
+
+ndn::security::SigningInfo
+CryptoProfile::getCommandSigningInfo(const ndn::security::SigningInfo& signingInfo) const
+{
+  if (m_mode == MODE_REAL) {
+    return signingInfo;
+  }
+  // command Interests cannot carry a null signature
+  return ndn::security::signingWithSha256();
+}
+
+void
+CryptoProfile::verify(const std::function<void()>& onVerified)
+{
+  ++m_nVerifications;
+  chargeCpu(m_validationDelay);
+  runAfterCpu(onVerified);
+}
+
+void
+CryptoProfile::chargeCpu(const ndn::time::nanoseconds& delay)
+{
+  if (delay <= ndn::time::nanoseconds::zero()) {
+    return;
+  }
+  m_cpuBusyUntil = std::max(m_cpuBusyUntil, ndn::time::steady_clock::now()) + delay;
+}
+
+void
+CryptoProfile::runAfterCpu(const std::function<void()>& callback)
+{
+  ndn::time::steady_clock::TimePoint now = ndn::time::steady_clock::now();
+  if (m_cpuBusyUntil <= now) {
+    callback();
+    return;
+  }
+  m_scheduler.scheduleEvent(m_cpuBusyUntil - now, callback);
+}
+
+} // namespace security
+} // namespace nlsr
@@ -0,0 +1,175 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NLSR_SECURITY_CRYPTO_PROFILE_HPP
+#define NLSR_SECURITY_CRYPTO_PROFILE_HPP
+
+#include "../common.hpp"
+
+#include <ndn-cxx/data.hpp>
+#include <ndn-cxx/security/key-chain.hpp>
+#include <ndn-cxx/security/signing-helpers.hpp>
+#include <ndn-cxx/security/signing-info.hpp>
+#include <ndn-cxx/util/scheduler.hpp>
+#include <ndn-cxx/util/time.hpp>
+
+#include <functional>
+
+namespace nlsr {
+namespace security {
+
+/** \brief how NLSR signs and verifies its packets in simulation
+ *
+ *  In MODE_REAL, packets are signed with the KeyChain as requested and validated by the
+ *  configured validator.  MODE_DIGEST_SHA256 signs with a SHA-256 digest, and MODE_NULL
+ *  attaches a fixed DigestSha256 signature without hashing.  In both of these modes the
+ *  validator accepts packets without checking their signatures.
+ *
+ *  Each signature and verification is counted and costs a modeled amount of router CPU
+ *  time.  The CPU processes work in order: a signed packet is sent, and a validated packet
+ *  is delivered, once all signatures and verifications before it have been paid for.
+ */
+class CryptoProfile : ndn::noncopyable
+{
+public:
+  enum Mode {
+    MODE_REAL,
+    MODE_DIGEST_SHA256,
+    MODE_NULL
+  };
+
+  CryptoProfile(ndn::KeyChain& keyChain, ndn::Scheduler& scheduler);
+
+  /** \brief parses "real", "digest-sha256" or "null"
+   *  \return false if \p str is not a known mode
+   */
+  static bool
+  parseMode(const std::string& str, Mode& mode);
+
+  void
+  setMode(Mode mode)
+  {
+    m_mode = mode;
+  }
+
+  Mode
+  getMode() const
+  {
+    return m_mode;
+  }
+
+  void
+  setSigningDelay(const ndn::time::nanoseconds& delay)
+  {
+    m_signingDelay = delay;
+  }
+
+  const ndn::time::nanoseconds&
+  getSigningDelay() const
+  {
+    return m_signingDelay;
+  }
+
+  void
+  setValidationDelay(const ndn::time::nanoseconds& delay)
+  {
+    m_validationDelay = delay;
+  }
+
+  const ndn::time::nanoseconds&
+  getValidationDelay() const
+  {
+    return m_validationDelay;
+  }
+
+  /** \return whether validators should accept packets without checking their signatures
+   */
+  bool
+  isValidationBypassed() const
+  {
+    return m_mode != MODE_REAL;
+  }
+
+  /** \brief signs \p data according to the mode and charges the signing delay
+   *  \param signingInfo signer used in MODE_REAL
+   */
+  void
+  sign(ndn::Data& data,
+       const ndn::security::SigningInfo& signingInfo = ndn::KeyChain::DEFAULT_SIGNING_INFO);
+
+  /** \brief returns the signing info for command Interests, such as RIB commands
+   */
+  ndn::security::SigningInfo
+  getCommandSigningInfo(const ndn::security::SigningInfo& signingInfo =
+                          ndn::KeyChain::DEFAULT_SIGNING_INFO) const;
+
+  /** \brief sends \p data on \p face once the CPU has finished signing it
+   */
+  template<class FaceBase>
+  void
+  put(FaceBase& face, const ndn::shared_ptr<const ndn::Data>& data)
+  {
+    runAfterCpu([&face, data] { face.put(*data); });
+  }
+
+  /** \brief counts a verification, charges the validation delay, and invokes
+   *         \p onVerified when the CPU has finished it
+   */
+  void
+  verify(const std::function<void()>& onVerified);
+
+  uint64_t
+  getNSignatures() const
+  {
+    return m_nSignatures;
+  }
+
+  uint64_t
+  getNVerifications() const
+  {
+    return m_nVerifications;
+  }
+
+private:
+  void
+  chargeCpu(const ndn::time::nanoseconds& delay);
+
+  void
+  runAfterCpu(const std::function<void()>& callback);
+
+private:
+  ndn::KeyChain& m_keyChain;
+  ndn::Scheduler& m_scheduler;
+  Mode m_mode;
+  ndn::time::nanoseconds m_signingDelay;
+  ndn::time::nanoseconds m_validationDelay;
+
+  /// when the modeled CPU finishes the work charged so far
+  ndn::time::steady_clock::TimePoint m_cpuBusyUntil;
+
+  uint64_t m_nSignatures;
+  uint64_t m_nVerifications;
+};
+
+} // namespace security
+} // namespace nlsr
+
+#endif // NLSR_SECURITY_CRYPTO_PROFILE_HPP
@@ -0,0 +1,121 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NLSR_SHARED_POOL_HPP
+#define NLSR_SHARED_POOL_HPP
+
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include <ndn-cxx/name.hpp>
+
+namespace nlsr {
+namespace util {
+
+/** \brief Process-wide pool of immutable values, shared by all NLSR instances
+
+    Every router keeps the names of all other routers, in its LSDB, routing map and
+    neighbor list.  With all routers of a simulation in one process, these are N copies of
+    the same N names.  get() returns the pooled copy of a value instead, found by its hash,
+    so that each distinct value is stored once however many routers hold it.
+
+    Pooled values are reference-counted: a value leaves the pool when its last holder
+    releases it.  The pool is not thread-safe; all NLSR instances run on the simulator
+    thread.
+ */
+template<typename T, typename Hash = std::hash<T>>
+class SharedPool
+{
+public:
+  typedef ndn::shared_ptr<const T> ValuePtr;
+
+  /** \return the pooled value equal to \p value, added to the pool if missing
+   */
+  static ValuePtr
+  get(const T& value)
+  {
+    Entries& entries = getEntries();
+
+    typename Entries::iterator it = entries.find(&value);
+    if (it != entries.end()) {
+      return it->second.lock();
+    }
+
+    ValuePtr pooled(new T(value), &release);
+    entries.insert(std::make_pair(pooled.get(), ndn::weak_ptr<const T>(pooled)));
+    return pooled;
+  }
+
+  /** \return the number of distinct values in the pool
+   */
+  static size_t
+  size()
+  {
+    return getEntries().size();
+  }
+
+private:
+  // entries are keyed by the pooled value itself, so that it is not stored twice
+  struct ValueHash
+  {
+    size_t
+    operator()(const T* value) const
+    {
+      return Hash()(*value);
+    }
+  };
+
+  struct ValueEqual
+  {
+    bool
+    operator()(const T* a, const T* b) const
+    {
+      return *a == *b;
+    }
+  };
+
+  typedef std::unordered_map<const T*, ndn::weak_ptr<const T>, ValueHash, ValueEqual> Entries;
+
+  static Entries&
+  getEntries()
+  {
+    // never destroyed, as pooled values may outlive static objects
+    static Entries* entries = new Entries;
+    return *entries;
+  }
+
+  static void
+  release(const T* value)
+  {
+    getEntries().erase(value);
+    delete value;
+  }
+};
+
+typedef SharedPool<ndn::Name> NamePool;
+typedef SharedPool<std::string> StringPool;
+
+} // namespace util
+} // namespace nlsr
+
+#endif // NLSR_SHARED_POOL_HPP
@@ -24,6 +24,7 @@
 
 #include "common.hpp"
 #include "security/certificate-store.hpp"
+#include "security/crypto-profile.hpp"
 
 #include <ndn-cxx/security/validator-config.hpp>
 
@@ -51,6 +52,7 @@ public:
     : ndn::ValidatorConfig(face, cache, ndn::ValidatorConfig::DEFAULT_GRACE_INTERVAL, stepLimit)
     , m_broadcastPrefix(broadcastPrefix)
     , m_certStore(certStore)
+    , m_cryptoProfile(nullptr)
   {
     m_broadcastPrefix.append("KEYS");
   }
@@ -72,9 +74,69 @@ public:
     m_broadcastPrefix = broadcastPrefix;
   }
 
+  /** \brief counts and delays verifications through \p cryptoProfile, and accepts packets
+   *         without checking them if the profile bypasses validation
+   */
+  void
+  setCryptoProfile(security::CryptoProfile* cryptoProfile)
+  {
+    m_cryptoProfile = cryptoProfile;
+  }
+
 protected:
   typedef std::vector<ndn::shared_ptr<ndn::ValidationRequest>> NextSteps;
 
+  virtual void
+  checkPolicy(const ndn::Data& data,
+              int nSteps,
+              const ndn::OnDataValidated& onValidated,
+              const ndn::OnDataValidationFailed& onValidationFailed,
+              NextSteps& nextSteps)
+  {
+    if (m_cryptoProfile == nullptr) {
+      ndn::ValidatorConfig::checkPolicy(data, nSteps, onValidated, onValidationFailed, nextSteps);
+      return;
+    }
+
+    security::CryptoProfile* profile = m_cryptoProfile;
+    ndn::OnDataValidated onVerified = [profile, onValidated] (const shared_ptr<const ndn::Data>& d) {
+      profile->verify([onValidated, d] { onValidated(d); });
+    };
+
+    if (profile->isValidationBypassed()) {
+      onVerified(data.shared_from_this());
+      return;
+    }
+    ndn::ValidatorConfig::checkPolicy(data, nSteps, onVerified, onValidationFailed, nextSteps);
+  }
+
+  virtual void
+  checkPolicy(const ndn::Interest& interest,
+              int nSteps,
+              const ndn::OnInterestValidated& onValidated,
+              const ndn::OnInterestValidationFailed& onValidationFailed,
+              NextSteps& nextSteps)
+  {
+    if (m_cryptoProfile == nullptr) {
+      ndn::ValidatorConfig::checkPolicy(interest, nSteps, onValidated, onValidationFailed,
+                                        nextSteps);
+      return;
+    }
+
+    security::CryptoProfile* profile = m_cryptoProfile;
+    ndn::OnInterestValidated onVerified =
+      [profile, onValidated] (const shared_ptr<const ndn::Interest>& i) {
+        profile->verify([onValidated, i] { onValidated(i); });
+      };
+
+    if (profile->isValidationBypassed()) {
+      onVerified(interest.shared_from_this());
+      return;
+    }
+    ndn::ValidatorConfig::checkPolicy(interest, nSteps, onVerified, onValidationFailed,
+                                      nextSteps);
+  }
+
   virtual void
   afterCheckPolicy(const NextSteps& nextSteps,
                    const OnFailure& onFailure)
@@ -126,6 +188,7 @@ protected:
 private:
   ndn::Name m_broadcastPrefix;
   security::CertificateStore& m_certStore;
+  security::CryptoProfile* m_cryptoProfile;
 };
 
 } // namespace nlsr
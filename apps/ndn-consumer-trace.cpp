@@ -0,0 +1,258 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-consumer-trace.hpp"
+
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/string.h"
+
+#include <cctype>
+#include <cstring>
+#include <limits>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+NS_LOG_COMPONENT_DEFINE("ndn.ConsumerTrace");
+
+namespace ns3 {
+namespace ndn {
+
+NS_OBJECT_ENSURE_REGISTERED(ConsumerTrace);
+
+TypeId
+ConsumerTrace::GetTypeId(void)
+{
+  static TypeId tid =
+    TypeId("ns3::ndn::ConsumerTrace")
+      .SetGroupName("Ndn")
+      .SetParent<Consumer>()
+      .AddConstructor<ConsumerTrace>()
+
+      .AddAttribute("TraceFile", "Trace of requests to replay", StringValue(""),
+                    MakeStringAccessor(&ConsumerTrace::m_traceFile), MakeStringChecker());
+
+  return tid;
+}
+
+ConsumerTrace::ConsumerTrace()
+  : m_trace(nullptr)
+  , m_traceSize(0)
+  , m_traceCursor(nullptr)
+  , m_nRequests(0)
+{
+}
+
+ConsumerTrace::~ConsumerTrace()
+{
+  UnmapTrace();
+}
+
+void
+ConsumerTrace::StartApplication()
+{
+  NS_LOG_FUNCTION_NOARGS();
+
+  int fd = open(m_traceFile.c_str(), O_RDONLY);
+  if (fd < 0) {
+    NS_FATAL_ERROR("Cannot open file " << m_traceFile << " for reading");
+  }
+
+  struct stat status;
+  if (fstat(fd, &status) == 0 && status.st_size > 0) {
+    void* trace = mmap(nullptr, status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (trace == MAP_FAILED) {
+      close(fd);
+      NS_FATAL_ERROR("Cannot map file " << m_traceFile);
+    }
+    // the trace is read once, from start to end
+    madvise(trace, status.st_size, MADV_SEQUENTIAL);
+
+    m_trace = static_cast<const char*>(trace);
+    m_traceSize = status.st_size;
+  }
+  close(fd);
+
+  m_traceCursor = m_trace;
+  m_traceStart = Simulator::Now();
+
+  Consumer::StartApplication();
+  ScheduleNextRequest();
+}
+
+void
+ConsumerTrace::StopApplication()
+{
+  NS_LOG_FUNCTION_NOARGS();
+
+  Simulator::Cancel(m_requestEvent);
+  UnmapTrace();
+  NS_LOG_INFO("Replayed " << m_nRequests << " requests");
+
+  Consumer::StopApplication();
+}
+
+void
+ConsumerTrace::ScheduleNextPacket()
+{
+  // only retransmissions, requests are scheduled as they are read from the trace
+  if (!m_retxSeqs.empty() && !m_sendEvent.IsRunning()) {
+    m_sendEvent = Simulator::ScheduleNow(&ConsumerTrace::SendRetransmission, this);
+  }
+}
+
+void
+ConsumerTrace::ScheduleNextRequest()
+{
+  double offset;
+  uint32_t seq;
+  if (!ReadRequest(offset, seq)) {
+    NS_LOG_INFO("End of trace after " << m_nRequests << " requests");
+    UnmapTrace();
+    return;
+  }
+
+  Time delay = m_traceStart + Seconds(offset) - Simulator::Now();
+  if (delay.IsStrictlyNegative()) {
+    delay = Seconds(0);
+  }
+  m_requestEvent = Simulator::Schedule(delay, &ConsumerTrace::SendRequest, this, seq);
+}
+
+void
+ConsumerTrace::SendRequest(uint32_t seq)
+{
+  if (!m_active)
+    return;
+
+  ++m_nRequests;
+  SendInterest(seq);
+  ScheduleNextRequest();
+}
+
+void
+ConsumerTrace::SendRetransmission()
+{
+  if (!m_active || m_retxSeqs.empty())
+    return;
+
+  uint32_t seq = *m_retxSeqs.begin();
+  m_retxSeqs.erase(m_retxSeqs.begin());
+  SendInterest(seq);
+  ScheduleNextPacket();
+}
+
+void
+ConsumerTrace::SendInterest(uint32_t seq)
+{
+  shared_ptr<Name> nameWithSequence = make_shared<Name>(m_interestName);
+  nameWithSequence->appendSequenceNumber(seq);
+
+  shared_ptr<Interest> interest = make_shared<Interest>();
+  interest->setNonce(m_rand->GetValue(0, std::numeric_limits<uint32_t>::max()));
+  interest->setName(*nameWithSequence);
+  time::milliseconds interestLifeTime(m_interestLifeTime.GetMilliSeconds());
+  interest->setInterestLifetime(interestLifeTime);
+
+  NS_LOG_INFO("> Interest for " << seq);
+
+  WillSendOutInterest(seq);
+
+  m_transmittedInterests(interest, this, m_face);
+  m_appLink->onReceiveInterest(*interest);
+}
+
+bool
+ConsumerTrace::ReadRequest(double& offset, uint32_t& seq)
+{
+  const char* end = m_trace + m_traceSize;
+  const char*& p = m_traceCursor;
+
+  while (p != nullptr && p < end) {
+    const char* line = p;
+    const char* lineEnd = static_cast<const char*>(memchr(p, '\n', end - p));
+    if (lineEnd == nullptr) {
+      lineEnd = end;
+    }
+    p = lineEnd + 1;
+
+    while (line < lineEnd && isspace(*line)) {
+      ++line;
+    }
+    if (line == lineEnd || *line == '#') {
+      continue;
+    }
+    const char* request = line;
+
+    // offset, as [digits][.digits]
+    bool hasTime = false;
+    offset = 0;
+    for (; line < lineEnd && isdigit(*line); ++line) {
+      offset = offset * 10 + (*line - '0');
+      hasTime = true;
+    }
+    if (line < lineEnd && *line == '.') {
+      double scale = 0.1;
+      for (++line; line < lineEnd && isdigit(*line); ++line) {
+        offset += scale * (*line - '0');
+        scale /= 10;
+        hasTime = true;
+      }
+    }
+
+    bool hasSeparator = false;
+    for (; line < lineEnd && (*line == ' ' || *line == '\t'); ++line) {
+      hasSeparator = true;
+    }
+
+    bool hasSeq = false;
+    seq = 0;
+    for (; line < lineEnd && isdigit(*line); ++line) {
+      seq = seq * 10 + (*line - '0');
+      hasSeq = true;
+    }
+
+    while (line < lineEnd && isspace(*line)) {
+      ++line;
+    }
+    if (!hasTime || !hasSeparator || !hasSeq || line != lineEnd) {
+      NS_FATAL_ERROR("Invalid request in trace " << m_traceFile << ": "
+                     << std::string(request, lineEnd));
+    }
+    return true;
+  }
+  return false;
+}
+
+void
+ConsumerTrace::UnmapTrace()
+{
+  if (m_trace != nullptr) {
+    munmap(const_cast<char*>(m_trace), m_traceSize);
+    m_trace = nullptr;
+    m_traceSize = 0;
+    m_traceCursor = nullptr;
+  }
+}
+
+} // namespace ndn
+} // namespace ns3
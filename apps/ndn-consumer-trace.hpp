@@ -0,0 +1,106 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_CONSUMER_TRACE_H
+#define NDN_CONSUMER_TRACE_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ndn-consumer.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-apps
+ * @brief Ndn application replaying the requests of a trace file
+ *
+ * Each line of the trace is a request, as the time in seconds since the start of the
+ * application and the sequence number of the requested content, separated by whitespace:
+ *
+ *     0.000125 17
+ *     0.000250 3
+ *
+ * Requests must be sorted by time.  Empty lines and lines starting with '#' are ignored.
+ *
+ * The trace is memory-mapped and read one request ahead, so only one event is scheduled at a
+ * time however long the trace is.  Interests that time out are retransmitted as soon as
+ * possible.
+ */
+class ConsumerTrace : public Consumer {
+public:
+  static TypeId
+  GetTypeId();
+
+  ConsumerTrace();
+  virtual ~ConsumerTrace();
+
+protected:
+  // from App
+  virtual void
+  StartApplication();
+
+  virtual void
+  StopApplication();
+
+  // from Consumer
+  virtual void
+  ScheduleNextPacket();
+
+private:
+  void
+  SendRequest(uint32_t seq);
+
+  void
+  SendRetransmission();
+
+  void
+  SendInterest(uint32_t seq);
+
+  /**
+   * @brief Read the next request of the trace and schedule it
+   */
+  void
+  ScheduleNextRequest();
+
+  /**
+   * @brief Parse the next request from the trace
+   * @return false at the end of the trace
+   */
+  bool
+  ReadRequest(double& offset, uint32_t& seq);
+
+  void
+  UnmapTrace();
+
+private:
+  std::string m_traceFile;
+
+  const char* m_trace;       ///< mapped trace file
+  size_t m_traceSize;
+  const char* m_traceCursor; ///< start of the next line to read
+  Time m_traceStart;         ///< time of the start of the replay
+  EventId m_requestEvent;
+  uint64_t m_nRequests;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_CONSUMER_TRACE_H
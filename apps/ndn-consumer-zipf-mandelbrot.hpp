@@ -37,6 +37,8 @@
 #include "ns3/double.h"
 #include "ns3/random-variable-stream.h"
 
+#include "ns3/ndnSIM/utils/ndn-zipf-mandelbrot-sampler.hpp"
+
 namespace ns3 {
 namespace ndn {
 
@@ -93,7 +95,7 @@ private:
   uint32_t m_N;               // number of the contents
   double m_q;                 // q in (k+q)^s
   double m_s;                 // s in (k+q)^s
-  std::vector<double> m_Pcum; // cumulative probability
+  shared_ptr<const ZipfMandelbrotSampler> m_sampler; // built on first use, for the final parameters
 
   Ptr<UniformRandomVariable> m_seqRng; // RNG
 };
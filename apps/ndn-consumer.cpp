@@ -28,6 +28,7 @@
 #include "ns3/uinteger.h"
 #include "ns3/integer.h"
 #include "ns3/double.h"
+#include "ns3/node-list.h"
 
 #include "utils/ndn-ns3-packet-tag.hpp"
 #include "utils/ndn-rtt-mean-deviation.hpp"
@@ -42,6 +43,17 @@ namespace ndn {
 
 NS_OBJECT_ENSURE_REGISTERED(Consumer);
 
+/**
+ * @brief Increment a counter that is only modified by the simulation thread
+ *
+ * With a single writer, no atomic read-modify-write is needed for readers to see whole values.
+ */
+static inline void
+increment(std::atomic<uint64_t>& counter)
+{
+  counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
 TypeId
 Consumer::GetTypeId(void)
 {
@@ -80,6 +92,9 @@ Consumer::Consumer()
   : m_rand(CreateObject<UniformRandomVariable>())
   , m_seq(0)
   , m_seqMax(0) // don't request anything
+  , m_nOutInterests(0)
+  , m_nInData(0)
+  , m_nTimedOutInterests(0)
 {
   NS_LOG_FUNCTION_NOARGS();
 
@@ -113,13 +128,12 @@ Consumer::CheckRetxTimeout()
   Time rto = m_rtt->RetransmitTimeout();
   // NS_LOG_DEBUG ("Current RTO: " << rto.ToDouble (Time::S) << "s");
 
-  while (!m_seqTimeouts.empty()) {
-    SeqTimeoutsContainer::index<i_timestamp>::type::iterator entry =
-      m_seqTimeouts.get<i_timestamp>().begin();
-    if (entry->time + rto <= now) // timeout expired?
+  while (!m_pendingSeqs.empty()) {
+    const SeqState& state = m_pendingSeqs.front();
+    if (state.pendingTime + rto <= now) // timeout expired?
     {
-      uint32_t seqNo = entry->seq;
-      m_seqTimeouts.get<i_timestamp>().erase(entry);
+      uint32_t seqNo = state.seq;
+      m_pendingSeqs.pop_front();
       OnTimeout(seqNo);
     }
     else
@@ -199,9 +213,6 @@ Consumer::SendPacket()
   m_transmittedInterests(interest, this, m_face);
   m_appLink->onReceiveInterest(*interest);
 
-  numOutInterests++;
-  // std::cout<<numOutInterests<<std::endl;
-
   ScheduleNextPacket();
 }
 
@@ -235,26 +246,28 @@ Consumer::OnData(shared_ptr<const Data> data)
     }
   }
 
-  SeqTimeoutsContainer::iterator entry = m_seqLastDelay.find(seq);
-  if (entry != m_seqLastDelay.end()) {
-    m_lastRetransmittedInterestDataDelay(this, seq, Simulator::Now() - entry->time, hopCount);
-  }
+  auto entry = m_seqStates.find(seq);
+  if (entry != m_seqStates.end()) {
+    SeqState& state = entry->second;
+    Time now = Simulator::Now();
 
-  entry = m_seqFullDelay.find(seq);
-  if (entry != m_seqFullDelay.end()) {
-    m_firstInterestDataDelay(this, seq, Simulator::Now() - entry->time, m_seqRetxCounts[seq], hopCount);
-  }
+    m_lastRetransmittedInterestDataDelay(this, seq, now - state.lastTime, hopCount);
+    m_firstInterestDataDelay(this, seq, now - state.firstTime, state.retxCount, hopCount);
 
-  m_seqRetxCounts.erase(seq);
-  m_seqFullDelay.erase(seq);
-  m_seqLastDelay.erase(seq);
+    if (state.pendingHook.is_linked()) {
+      // only Interests sent once and not timed out are valid RTT samples
+      if (state.retxCount == 1) {
+        m_rtt->Measurement(now - state.lastTime);
+        m_rtt->ResetMultiplier();
+      }
+      m_pendingSeqs.erase(m_pendingSeqs.iterator_to(state));
+    }
+    m_seqStates.erase(entry);
+  }
 
-  m_seqTimeouts.erase(seq);
   m_retxSeqs.erase(seq);
 
-  m_rtt->AckSeq(SequenceNumber32(seq));
-
-  numInData++;
+  increment(m_nInData);
 }
 
 void
@@ -265,11 +278,9 @@ Consumer::OnTimeout(uint32_t sequenceNumber)
   // m_rtt->RetransmitTimeout ().ToDouble (Time::S) << "s\n";
 
   m_rtt->IncreaseMultiplier(); // Double the next RTO
-  m_rtt->SentSeq(SequenceNumber32(sequenceNumber),
-                 1); // make sure to disable RTT calculation for this sample
   m_retxSeqs.insert(sequenceNumber);
 
-  numTimeOutInterests++;
+  increment(m_nTimedOutInterests);
 
   ScheduleNextPacket();
 }
@@ -278,22 +289,50 @@ void
 Consumer::WillSendOutInterest(uint32_t sequenceNumber)
 {
   NS_LOG_DEBUG("Trying to add " << sequenceNumber << " with " << Simulator::Now() << ". already "
-                                << m_seqTimeouts.size() << " items");
-
-  m_seqTimeouts.insert(SeqTimeout(sequenceNumber, Simulator::Now()));
-  m_seqFullDelay.insert(SeqTimeout(sequenceNumber, Simulator::Now()));
+                                << m_pendingSeqs.size() << " items");
 
-  m_seqLastDelay.erase(sequenceNumber);
-  m_seqLastDelay.insert(SeqTimeout(sequenceNumber, Simulator::Now()));
+  Time now = Simulator::Now();
+  SeqState& state =
+    m_seqStates.emplace(sequenceNumber, SeqState(sequenceNumber, now)).first->second;
+  state.lastTime = now;
+  state.retxCount++;
+
+  // an Interest already waiting keeps its timeout
+  if (!state.pendingHook.is_linked()) {
+    state.pendingTime = now;
+    m_pendingSeqs.push_back(state);
+  }
 
-  m_seqRetxCounts[sequenceNumber]++;
+  increment(m_nOutInterests);
+}
 
-  m_rtt->SentSeq(SequenceNumber32(sequenceNumber), 1);
+Consumer::Stats
+Consumer::GetStats() const
+{
+  Stats stats;
+  stats.nOutInterests = m_nOutInterests.load(std::memory_order_relaxed);
+  stats.nInData = m_nInData.load(std::memory_order_relaxed);
+  stats.nTimedOutInterests = m_nTimedOutInterests.load(std::memory_order_relaxed);
+  return stats;
 }
 
-int Consumer::numOutInterests = 0;
-int Consumer::numInData = 0;
-int Consumer::numTimeOutInterests = 0;
+Consumer::Stats
+Consumer::GetTotalStats()
+{
+  Stats total = {0, 0, 0};
+  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); ++node) {
+    for (uint32_t i = 0; i < (*node)->GetNApplications(); ++i) {
+      Ptr<Consumer> consumer = DynamicCast<Consumer>((*node)->GetApplication(i));
+      if (consumer != nullptr) {
+        Stats stats = consumer->GetStats();
+        total.nOutInterests += stats.nOutInterests;
+        total.nInData += stats.nInData;
+        total.nTimedOutInterests += stats.nTimedOutInterests;
+      }
+    }
+  }
+  return total;
+}
 
 } // namespace ndn
 } // namespace ns3
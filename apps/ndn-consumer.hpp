@@ -32,13 +32,11 @@
 #include "ns3/ndnSIM/utils/ndn-rtt-estimator.hpp"
 #include "ns3/ndnSIM/utils/ndn-fw-hop-count-tag.hpp"
 
+#include <atomic>
 #include <set>
-#include <map>
+#include <unordered_map>
 
-#include <boost/multi_index_container.hpp>
-#include <boost/multi_index/tag.hpp>
-#include <boost/multi_index/ordered_index.hpp>
-#include <boost/multi_index/member.hpp>
+#include <boost/intrusive/list.hpp>
 
 namespace ns3 {
 namespace ndn {
@@ -89,9 +87,28 @@ public:
   virtual void
   WillSendOutInterest(uint32_t sequenceNumber);
 
-  static int numOutInterests;
-  static int numInData;
-  static int numTimeOutInterests;
+  /**
+   * @brief Counters of a consumer
+   */
+  struct Stats {
+    uint64_t nOutInterests;      ///< @brief Interests sent, including retransmissions
+    uint64_t nInData;            ///< @brief Data received
+    uint64_t nTimedOutInterests; ///< @brief Interests timed out
+  };
+
+  /**
+   * @brief Get the counters of this consumer
+   *
+   * Counters can be read from any thread while the simulation runs.
+   */
+  Stats
+  GetStats() const;
+
+  /**
+   * @brief Get the sum of the counters of all consumers in the simulation
+   */
+  static Stats
+  GetTotalStats();
 
 public:
   typedef void (*LastRetransmittedInterestDataDelayCallback)(Ptr<App> app, uint32_t seqno, Time delay, int32_t hopCount);
@@ -157,59 +174,56 @@ protected:
   RetxSeqsContainer m_retxSeqs; ///< \brief ordered set of sequence numbers to be retransmitted
 
   /**
-   * \struct This struct contains a pair of packet sequence number and its timeout
+   * \struct This struct contains the state of a sequence number, from its first Interest until
+   * its Data is received
    */
-  struct SeqTimeout {
-    SeqTimeout(uint32_t _seq, Time _time)
+  struct SeqState {
+    SeqState(uint32_t _seq, Time _time)
       : seq(_seq)
-      , time(_time)
+      , firstTime(_time)
+      , lastTime(_time)
+      , retxCount(0)
     {
     }
 
     uint32_t seq;
-    Time time;
-  };
-  /// @endcond
+    Time firstTime;     ///< \brief time the first Interest was sent
+    Time lastTime;      ///< \brief time the last Interest was sent
+    Time pendingTime;   ///< \brief time the Interest waiting for Data or timeout was sent
+    uint32_t retxCount; ///< \brief number of Interests sent
 
-  /// @cond include_hidden
-  class i_seq {
-  };
-  class i_timestamp {
+    boost::intrusive::list_member_hook<> pendingHook; ///< \brief linked while waiting for Data
   };
   /// @endcond
 
   /// @cond include_hidden
   /**
-   * \struct This struct contains a multi-index for the set of SeqTimeout structs
+   * \struct This struct contains the sequence numbers waiting for Data or timeout
+   *
+   * All Interests time out after the same RTO, so they expire in the order they were sent:
+   * sequence numbers are appended when sent and the ones timed out are taken from the front.
    */
-  struct SeqTimeoutsContainer
-    : public boost::multi_index::
-        multi_index_container<SeqTimeout,
-                              boost::multi_index::
-                                indexed_by<boost::multi_index::
-                                             ordered_unique<boost::multi_index::tag<i_seq>,
-                                                            boost::multi_index::
-                                                              member<SeqTimeout, uint32_t,
-                                                                     &SeqTimeout::seq>>,
-                                           boost::multi_index::
-                                             ordered_non_unique<boost::multi_index::
-                                                                  tag<i_timestamp>,
-                                                                boost::multi_index::
-                                                                  member<SeqTimeout, Time,
-                                                                         &SeqTimeout::time>>>> {
+  struct PendingSeqsContainer
+    : public boost::intrusive::list<SeqState,
+                                    boost::intrusive::member_hook<SeqState,
+                                                                  boost::intrusive::
+                                                                    list_member_hook<>,
+                                                                  &SeqState::pendingHook>> {
   };
 
-  SeqTimeoutsContainer m_seqTimeouts; ///< \brief multi-index for the set of SeqTimeout structs
-
-  SeqTimeoutsContainer m_seqLastDelay;
-  SeqTimeoutsContainer m_seqFullDelay;
-  std::map<uint32_t, uint32_t> m_seqRetxCounts;
+  /// \brief states of the sequence numbers requested and not received yet
+  std::unordered_map<uint32_t, SeqState> m_seqStates;
+  PendingSeqsContainer m_pendingSeqs; ///< \brief sequence numbers waiting for Data or timeout
 
   TracedCallback<Ptr<App> /* app */, uint32_t /* seqno */, Time /* delay */, int32_t /*hop count*/>
     m_lastRetransmittedInterestDataDelay;
   TracedCallback<Ptr<App> /* app */, uint32_t /* seqno */, Time /* delay */,
                  uint32_t /*retx count*/, int32_t /*hop count*/> m_firstInterestDataDelay;
 
+  std::atomic<uint64_t> m_nOutInterests;
+  std::atomic<uint64_t> m_nInData;
+  std::atomic<uint64_t> m_nTimedOutInterests;
+
   /// @endcond
 };
 
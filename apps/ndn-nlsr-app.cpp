@@ -51,6 +51,14 @@ NlsrApp::~NlsrApp() {
 void
 NlsrApp::Initialize(std::string& nodeConfig) {
   m_nodeConfigFile = nodeConfig;
+  m_parsedConfig.reset();
+}
+
+void
+NlsrApp::Initialize(const std::string& nodeConfig,
+                    std::shared_ptr<const boost::property_tree::ptree> parsedConfig) {
+  m_nodeConfigFile = nodeConfig;
+  m_parsedConfig = parsedConfig;
 }
 
 void
@@ -58,7 +66,9 @@ NlsrApp::StartApplication ()
 {
   cout << "进入NlsrApp::StartApplication ()" << endl;
   NS_LOG_FUNCTION_NOARGS ();
-  m_instance.reset(new ndn::NlsrExec(ndn::StackHelper::getKeyChain(), m_nodeConfigFile));
+  m_instance.reset(new ndn::NlsrExec(ndn::StackHelper::getKeyChain(), m_nodeConfigFile,
+                                     m_parsedConfig));
+  m_instance->GetNlsr().setLsdbSnapshot(m_lsdbSnapshot);
   //std::cout << "ZhangYu 2019-6-1, ndn::StackHelper::getKeyChain():" << m_nodeConfigFile << std::endl;
   m_instance->run();
 }
@@ -70,24 +80,19 @@ NlsrApp::StopApplication ()
   m_instance.reset();
 }
 
-void
-NlsrApp::SetNodeNameToIdMapping(std::string name, uint32_t id)
-{
-  m_ndn_node_map[name] = id;
-}
-
 Ptr<Node>
 NlsrApp::GetNode (std::string nodeName)
 {
-  uint32_t id = m_ndn_node_map[nodeName];
-  uint32_t size = ns3::NodeList::GetNNodes();
-  for (uint32_t i = 0; i < size; i++) {
-    ns3::Ptr<ns3::Node> node = ns3::NodeList::GetNode(i);
-    if (node->GetId() == id) {
-      return node;
-    }
+  if (m_nodeMap == nullptr) {
+    return NULL;
+  }
+
+  auto it = m_nodeMap->find(nodeName);
+  if (it == m_nodeMap->end()) {
+    return NULL;
   }
-  return NULL;
+  // ns-3 node ids are indices in NodeList
+  return ns3::NodeList::GetNode(it->second);
 }
 
 } // namespace ndn
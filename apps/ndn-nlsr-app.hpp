@@ -31,6 +31,11 @@ namespace ndn {
 class NlsrApp: public Application {
 
 public:
+  /**
+   * @brief Simulated node name to ns-3 node id, shared by all NLSR instances of a topology
+   */
+  typedef std::map<std::string, uint32_t> NodeNameToIdMap;
+
   static TypeId GetTypeId (void);
 
   NlsrApp();
@@ -41,6 +46,15 @@ public:
   void
   Initialize(std::string& nodeConfig);
 
+  /**
+   * @brief Use an already parsed configuration instead of reading @p nodeConfig on start
+   *
+   * @p nodeConfig is still used to resolve relative paths in the configuration.
+   */
+  void
+  Initialize(const std::string& nodeConfig,
+             std::shared_ptr<const boost::property_tree::ptree> parsedConfig);
+
   nlsr::ConfParameter&
   GetConfParameter()
   {
@@ -66,7 +80,19 @@ public:
   }
 
   void
-  SetNodeNameToIdMapping(std::string name, uint32_t id);
+  SetNodeNameToIdMap(std::shared_ptr<const NodeNameToIdMap> nodeMap)
+  {
+    m_nodeMap = nodeMap;
+  }
+
+  /**
+   * @brief Start NLSR from a converged LSDB snapshot, shared by all NLSR instances
+   */
+  void
+  SetLsdbSnapshot(std::shared_ptr<const nlsr::LsdbSnapshot> snapshot)
+  {
+    m_lsdbSnapshot = snapshot;
+  }
 
   Ptr<Node>
   GetNode(std::string name);
@@ -82,10 +108,11 @@ protected:
 private:
   std::unique_ptr<ndn::NlsrExec> m_instance;
   std::string m_nodeConfigFile;
+  std::shared_ptr<const boost::property_tree::ptree> m_parsedConfig;
   std::string m_nodeName;
   NodeContainer *m_nodes;
-  typedef std::map<std::string, uint32_t> NDN_NODE_MAP;
-  NDN_NODE_MAP m_ndn_node_map;
+  std::shared_ptr<const NodeNameToIdMap> m_nodeMap;
+  std::shared_ptr<const nlsr::LsdbSnapshot> m_lsdbSnapshot;
 };
 
 } // namespace ndn
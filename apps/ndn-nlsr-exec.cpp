@@ -38,7 +38,8 @@ namespace ndn {
 
 INIT_LOGGER("NlsrExec");
 
-NlsrExec::NlsrExec(::ndn::KeyChain& keyChain, std::string& nlsrConf)
+NlsrExec::NlsrExec(::ndn::KeyChain& keyChain, std::string& nlsrConf,
+                   std::shared_ptr<const boost::property_tree::ptree> parsedConf)
   : m_ioService(m_face.getIoService())
   , m_scheduler(m_ioService)
   , m_keyChain(keyChain)
@@ -46,7 +47,9 @@ NlsrExec::NlsrExec(::ndn::KeyChain& keyChain, std::string& nlsrConf)
 {
   m_nlsr.setConfFileName(nlsrConf);
   nlsr::ConfFileProcessor configProcessor(m_nlsr, m_nlsr.getConfFileName());
-  if (!configProcessor.processConfFile()) {
+  bool isProcessed = parsedConf != nullptr ? configProcessor.processConfTree(*parsedConf) :
+                                             configProcessor.processConfFile();
+  if (!isProcessed) {
     throw Error("Error in configuration file processing! Exiting from NLSR");
   }
 }
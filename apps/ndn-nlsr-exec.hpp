@@ -31,6 +31,7 @@
 
 // boost needs to be included after ndn-cxx, otherwise there will be conflict with _1, _2, ...
 #include <boost/asio.hpp>
+#include <boost/property_tree/ptree.hpp>
 
 #include "conf-parameter.hpp"
 
@@ -51,7 +52,13 @@ class NlsrExec
   };
 
 public:
-  NlsrExec(::ndn::KeyChain& keyChain, std::string& nlsrConf);
+  /**
+   * @brief Create NLSR instance configured from @p nlsrConf
+   *
+   * If @p parsedConf is given, it is used instead of reading and parsing @p nlsrConf again.
+   */
+  NlsrExec(::ndn::KeyChain& keyChain, std::string& nlsrConf,
+           std::shared_ptr<const boost::property_tree::ptree> parsedConf = nullptr);
 
   void
   run();
@@ -28,6 +28,7 @@
 #include "model/ndn-l3-protocol.hpp"
 #include "helper/ndn-fib-helper.hpp"
 
+#include <map>
 #include <memory>
 
 NS_LOG_COMPONENT_DEFINE("ndn.Producer");
@@ -52,7 +53,8 @@ Producer::GetTypeId(void)
          "Postfix that is added to the output data (e.g., for adding producer-uniqueness)",
          StringValue("/"), MakeNameAccessor(&Producer::m_postfix), MakeNameChecker())
       .AddAttribute("PayloadSize", "Virtual payload size for Content packets", UintegerValue(1024),
-                    MakeUintegerAccessor(&Producer::m_virtualPayloadSize),
+                    MakeUintegerAccessor(&Producer::SetVirtualPayloadSize,
+                                         &Producer::GetVirtualPayloadSize),
                     MakeUintegerChecker<uint32_t>())
       .AddAttribute("Freshness", "Freshness of data packets, if 0, then unlimited freshness",
                     TimeValue(Seconds(0)), MakeTimeAccessor(&Producer::m_freshness),
@@ -60,11 +62,13 @@ Producer::GetTypeId(void)
       .AddAttribute(
          "Signature",
          "Fake signature, 0 valid signature (default), other values application-specific",
-         UintegerValue(0), MakeUintegerAccessor(&Producer::m_signature),
+         UintegerValue(0), MakeUintegerAccessor(&Producer::SetSignature, &Producer::GetSignature),
          MakeUintegerChecker<uint32_t>())
       .AddAttribute("KeyLocator",
                     "Name to be used for key locator.  If root, then key locator is not used",
-                    NameValue(), MakeNameAccessor(&Producer::m_keyLocator), MakeNameChecker());
+                    NameValue(),
+                    MakeNameAccessor(&Producer::SetKeyLocator, &Producer::GetKeyLocator),
+                    MakeNameChecker());
   return tid;
 }
 
@@ -73,6 +77,59 @@ Producer::Producer()
   NS_LOG_FUNCTION_NOARGS();
 }
 
+const ::ndn::Block&
+Producer::GetVirtualPayload(uint32_t size)
+{
+  // payloads are never modified, so all producers share one per size
+  static std::map<uint32_t, ::ndn::Block> payloads;
+
+  ::ndn::Block& payload = payloads[size];
+  if (!payload.hasWire()) {
+    payload = ::ndn::Block(::ndn::tlv::Content, make_shared< ::ndn::Buffer>(size));
+    payload.encode();
+  }
+  return payload;
+}
+
+void
+Producer::SetVirtualPayloadSize(uint32_t size)
+{
+  m_virtualPayloadSize = size;
+  m_payload.reset();
+}
+
+uint32_t
+Producer::GetVirtualPayloadSize() const
+{
+  return m_virtualPayloadSize;
+}
+
+void
+Producer::SetSignature(uint32_t signature)
+{
+  m_signature = signature;
+  m_dataSignature = Signature();
+}
+
+uint32_t
+Producer::GetSignature() const
+{
+  return m_signature;
+}
+
+void
+Producer::SetKeyLocator(const Name& keyLocator)
+{
+  m_keyLocator = keyLocator;
+  m_dataSignature = Signature();
+}
+
+Name
+Producer::GetKeyLocator() const
+{
+  return m_keyLocator;
+}
+
 // inherited from Application base class.
 void
 Producer::StartApplication()
@@ -109,19 +166,25 @@ Producer::OnInterest(shared_ptr<const Interest> interest)
   data->setName(dataName);
   data->setFreshnessPeriod(::ndn::time::milliseconds(m_freshness.GetMilliSeconds()));
 
-  data->setContent(make_shared< ::ndn::Buffer>(m_virtualPayloadSize));
-
-  Signature signature;
-  SignatureInfo signatureInfo(static_cast< ::ndn::tlv::SignatureTypeValue>(255));
-
-  if (m_keyLocator.size() > 0) {
-    signatureInfo.setKeyLocator(m_keyLocator);
+  // payload and signature are encoded once and only copied into the wire encoding of each Data
+  if (!m_payload.hasWire()) {
+    m_payload = GetVirtualPayload(m_virtualPayloadSize);
   }
+  data->setContent(m_payload);
+
+  if (!m_dataSignature) {
+    SignatureInfo signatureInfo(static_cast< ::ndn::tlv::SignatureTypeValue>(255));
 
-  signature.setInfo(signatureInfo);
-  signature.setValue(::ndn::nonNegativeIntegerBlock(::ndn::tlv::SignatureValue, m_signature));
+    if (m_keyLocator.size() > 0) {
+      signatureInfo.setKeyLocator(m_keyLocator);
+    }
 
-  data->setSignature(signature);
+    m_dataSignature.setInfo(signatureInfo);
+    m_dataSignature.setValue(::ndn::nonNegativeIntegerBlock(::ndn::tlv::SignatureValue,
+                                                            m_signature));
+    m_dataSignature.getInfo(); // encode SignatureInfo now
+  }
+  data->setSignature(m_dataSignature);
 
   NS_LOG_INFO("node(" << GetNode()->GetId() << ") responding with Data: " << data->getName());
 
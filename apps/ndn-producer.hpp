@@ -59,6 +59,31 @@ protected:
   virtual void
   StopApplication(); // Called at time specified by Stop
 
+  /**
+   * @brief Get the Content block of @p size zero bytes shared by all producers
+   */
+  static const ::ndn::Block&
+  GetVirtualPayload(uint32_t size);
+
+private:
+  void
+  SetVirtualPayloadSize(uint32_t size);
+
+  uint32_t
+  GetVirtualPayloadSize() const;
+
+  void
+  SetSignature(uint32_t signature);
+
+  uint32_t
+  GetSignature() const;
+
+  void
+  SetKeyLocator(const Name& keyLocator);
+
+  Name
+  GetKeyLocator() const;
+
 private:
   Name m_prefix;
   Name m_postfix;
@@ -67,6 +92,9 @@ private:
 
   uint32_t m_signature;
   Name m_keyLocator;
+
+  ::ndn::Block m_payload;     ///< shared Content block, empty until the first Data
+  Signature m_dataSignature; ///< pre-encoded signature, invalid until the first Data
 };
 
 } // namespace ndn
@@ -0,0 +1,148 @@
+#!/usr/bin/env python
+# -*- Mode: python; py-indent-offset: 4; indent-tabs-mode: nil; coding: utf-8; -*-
+
+"""
+Convert output of ns3::ndn::L3RateBinaryTracer into the row layout of ns3::ndn::L3RateTracer,
+including EWMA-smoothed rates.
+
+Usage: l3-rate-binary-to-csv.py [-d DELIMITER] rate-trace.bin > rate-trace.csv
+"""
+
+from __future__ import print_function
+
+import argparse
+import struct
+import sys
+
+ALPHA = 0.8
+NODE_TOTALS = 0xFFFFFFFF
+
+COUNTERS = ["InInterests", "OutInterests", "InData", "OutData",
+            "InSatisfiedInterests", "InTimedOutInterests",
+            "OutSatisfiedInterests", "OutTimedOutInterests"]
+N_BYTE_COUNTERS = 4
+
+# rows printed for node-wide totals: (counter index, type name)
+TOTALS = [(4, "SatisfiedInterests"), (5, "TimedOutInterests")]
+
+
+class Reader(object):
+    def __init__(self, f):
+        self.f = f
+
+    def read(self, fmt):
+        size = struct.calcsize(fmt)
+        buf = self.f.read(size)
+        if len(buf) != size:
+            raise EOFError()
+        return struct.unpack(fmt, buf)
+
+    def read_string(self):
+        (length,) = self.read("=H")
+        return self.f.read(length).decode("utf-8", "replace")
+
+
+class Converter(object):
+    def __init__(self, period, out, delimiter):
+        self.period = period / 1e9
+        self.out = out
+        self.delimiter = delimiter
+        self.nodes = []          # node ids in installation order
+        self.names = {}          # node id => name
+        self.faces = {}          # node id => {face id => uri}
+        self.ewma = {}           # (node, face, counter) => [packets, kilobytes]
+        self.time = None
+        self.counts = {}         # (node, face) => (packets list, bytes list)
+
+        self.write(["Time", "Node", "FaceId", "FaceDescr", "Type",
+                    "Packets", "Kilobytes", "PacketRaw", "KilobytesRaw"])
+
+    def write(self, columns):
+        self.out.write(self.delimiter.join(str(c) for c in columns) + "\n")
+
+    def row(self, node, face, counter, typeName):
+        packets, nBytes = self.counts.get((node, face), (None, None))
+        rawPackets = packets[counter] if packets else 0
+        rawKilobytes = (nBytes[counter] if nBytes and counter < N_BYTE_COUNTERS else 0) / 1024.0
+
+        state = self.ewma.setdefault((node, face, counter), [0.0, 0.0])
+        state[0] = ALPHA * rawPackets / self.period + (1 - ALPHA) * state[0]
+        state[1] = ALPHA * rawKilobytes / self.period + (1 - ALPHA) * state[1]
+
+        if face == NODE_TOTALS:
+            faceColumns = [-1, "all"]
+        else:
+            faceColumns = [face, self.faces[node][face]]
+        self.write(["%g" % self.time, self.names[node]] + faceColumns +
+                   [typeName, "%g" % state[0], "%g" % state[1], rawPackets, "%g" % rawKilobytes])
+
+    def flush_period(self):
+        if self.time is None:
+            return
+        for node in self.nodes:
+            faces = self.faces.get(node, {})
+            for face in sorted(f for f in faces if f != NODE_TOTALS):
+                for counter, typeName in enumerate(COUNTERS):
+                    self.row(node, face, counter, typeName)
+            if NODE_TOTALS in faces:
+                for counter, typeName in TOTALS:
+                    self.row(node, NODE_TOTALS, counter, typeName)
+        self.counts = {}
+
+    def on_node(self, r):
+        (node,) = r.read("=I")
+        self.names[node] = r.read_string()
+        self.nodes.append(node)
+
+    def on_time(self, r):
+        self.flush_period()
+        (timeNs,) = r.read("=q")
+        self.time = timeNs / 1e9
+
+    def on_face(self, r):
+        node, face = r.read("=II")
+        self.faces.setdefault(node, {})[face] = r.read_string()
+
+    def on_stats(self, r):
+        node, nRows = r.read("=II")
+        faces = r.read("=%dI" % nRows)
+        packets = [r.read("=%dI" % nRows) for _ in COUNTERS]
+        nBytes = [r.read("=%dQ" % nRows) for _ in range(N_BYTE_COUNTERS)]
+        for row, face in enumerate(faces):
+            if face == NODE_TOTALS:
+                self.faces.setdefault(node, {})[face] = "all"
+            self.counts[(node, face)] = ([c[row] for c in packets], [c[row] for c in nBytes])
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("-d", "--delimiter", default=",",
+                        help="column delimiter (default: ','; use $'\\t' for TSV)")
+    parser.add_argument("input", help="file written by L3RateBinaryTracer")
+    args = parser.parse_args()
+
+    with open(args.input, "rb") as f:
+        r = Reader(f)
+        magic = f.read(8)
+        if magic != b"NDNL3RB1":
+            sys.exit("%s: not an L3RateBinaryTracer file" % args.input)
+        (period,) = r.read("=q")
+
+        conv = Converter(period, sys.stdout, args.delimiter)
+        handlers = {b"N": conv.on_node, b"T": conv.on_time, b"F": conv.on_face, b"S": conv.on_stats}
+        try:
+            while True:
+                tag = f.read(1)
+                if not tag:
+                    break
+                if tag not in handlers:
+                    sys.exit("%s: unknown record type %r" % (args.input, tag))
+                handlers[tag](r)
+        except EOFError:
+            sys.stderr.write("%s: truncated record at end of file\n" % args.input)
+        conv.flush_period()
+
+
+if __name__ == "__main__":
+    main()
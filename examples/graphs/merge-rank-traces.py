@@ -0,0 +1,64 @@
+#!/usr/bin/env python
+# -*- Mode: python; py-indent-offset: 4; indent-tabs-mode: nil; coding: utf-8; -*-
+
+"""
+Merge text traces written by the ranks of a distributed (MPI) simulation into one file
+ordered by time, e.g. the TEXT output of ns3::ndn::NlsrTracer or ns3::ndn::L3RateTracer.
+
+Every input must start with the same header line and have the time in its first column;
+rows of one input are expected in time order (as written by the tracers).  Rows with equal
+time keep the order of the inputs on the command line.
+
+Usage: merge-rank-traces.py [-d DELIMITER] [-o OUTPUT] trace-rank0.txt trace-rank1.txt ...
+
+For example, for the hello trace of NlsrTracer (including rolled-over files):
+
+    merge-rank-traces.py -o 100-node-nlsr-hello-trace.txt 100-rank*-node-nlsr-hello-trace-*.txt
+"""
+
+from __future__ import print_function
+
+import argparse
+import heapq
+import sys
+
+
+def rows(path, index, delimiter, header):
+    with open(path) as f:
+        first = f.readline()
+        if first.rstrip("\n") != header:
+            sys.exit("%s: header differs from the first input" % path)
+        for seq, line in enumerate(f):
+            if not line.strip():
+                continue
+            time = line.split(delimiter, 1)[0]
+            try:
+                time = float(time)
+            except ValueError:
+                sys.exit("%s:%d: no time in the first column" % (path, seq + 2))
+            yield (time, index, seq, line)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("-d", "--delimiter", default="\t",
+                        help="column delimiter (default: tab; use ',' for CSV)")
+    parser.add_argument("-o", "--output", help="output file (default: standard output)")
+    parser.add_argument("inputs", nargs="+", help="per-rank trace files")
+    args = parser.parse_args()
+
+    with open(args.inputs[0]) as f:
+        header = f.readline().rstrip("\n")
+
+    out = open(args.output, "w") if args.output else sys.stdout
+    out.write(header + "\n")
+    for _, _, _, line in heapq.merge(*[rows(path, index, args.delimiter, header)
+                                       for index, path in enumerate(args.inputs)]):
+        out.write(line if line.endswith("\n") else line + "\n")
+    if args.output:
+        out.close()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,219 @@
+#!/usr/bin/env python
+# -*- Mode: python; py-indent-offset: 4; indent-tabs-mode: nil; coding: utf-8; -*-
+
+"""
+Convert the BINARY output of ns3::ndn::NlsrTracer into the per-category tab-separated
+files written by its TEXT format:
+
+    <prefix>-node-nlsr-{hello,sync,nlsa,llsa,fib}-trace-<n>.txt
+
+Usage: nlsr-trace-to-tsv.py [-o PREFIX] [-r ROLL_OVER] <prefix>-node-nlsr-trace.bin
+
+The binary traces of all ranks of a distributed simulation
+(<prefix>-rank<N>-node-nlsr-trace.bin) can be given at once; their events are merged by time.
+"""
+
+from __future__ import print_function
+
+import argparse
+import heapq
+import re
+import struct
+import sys
+
+SUFFIX = "-node-nlsr-trace.bin"
+NO_NAME = 0xFFFFFFFF
+NO_SIZE = 0xFFFFFFFFFFFFFFFF
+
+# category => (file infix, header)
+PACKET_HEADER = ["Time", "Node", "Name", "Type", "Packets", "KBytes", "-", "-"]
+CATEGORIES = {
+    "hello": ("-node-nlsr-hello-trace-", PACKET_HEADER),
+    "nlsa": ("-node-nlsr-nlsa-trace-", PACKET_HEADER),
+    "llsa": ("-node-nlsr-llsa-trace-", ["Time", "Node", "FaceId", "FaceDescr", "Type",
+                                        "Packets", "KBytes", "PacketRaw"]),
+    "sync": ("-node-nlsr-sync-trace-", PACKET_HEADER),
+    "fib": ("-node-nlsr-fib-trace-", ["Time", "Node", "Name", "Type", "Attempt", "-", "-", "-"]),
+}
+
+# indexed by NlsrTracer::Event
+EVENTS = [
+    ("hello", "outHelloInterest"),
+    ("hello", "inHelloInterest"),
+    ("hello", "outHelloData"),
+    ("hello", "inHelloData"),
+    ("hello", "timedOutHelloInterest"),
+    ("nlsa", "outNameLsaInterest"),
+    ("nlsa", "inNameLsaInterest"),
+    ("nlsa", "outNameLsaData"),
+    ("nlsa", "inNameLsaData"),
+    ("nlsa", "timedoutNameLsaInterest"),
+    ("nlsa", "outCordLsaInterest"),
+    ("nlsa", "inCordLsaInterest"),
+    ("nlsa", "outCordLsaData"),
+    ("nlsa", "inCordLsaData"),
+    ("nlsa", "timedoutCordLsaInterest"),
+    ("llsa", "outAdjLsaInterest"),
+    ("llsa", "inAdjLsaInterest"),
+    ("llsa", "outAdjLsaData"),
+    ("llsa", "inAdjLsaData"),
+    ("llsa", "timedoutAdjLsaInterest"),
+    ("sync", "outSyncInterest"),
+    ("sync", "inSyncInterest"),
+    ("sync", "outSyncData"),
+    ("sync", "inSyncData"),
+    ("sync", "timedOutSyncInterest"),
+    ("sync", "outRecovInterest"),
+    ("sync", "inRecovInterest"),
+    ("sync", "outRecovData"),
+    ("sync", "inRecovData"),
+    ("sync", "timedOutRecovInterest"),
+    ("fib", "dijkSinglePath"),
+    ("fib", "dijkMultiPath"),
+    ("fib", "hyperbolRouting"),
+    ("fib", "hyperDryRouting"),
+    ("hello", "suppressedHelloInterest"),
+    ("sync", "suppressedSyncInterest"),
+]
+
+
+class Reader(object):
+    def __init__(self, f):
+        self.f = f
+
+    def read(self, fmt):
+        size = struct.calcsize(fmt)
+        buf = self.f.read(size)
+        if len(buf) != size:
+            raise EOFError()
+        return struct.unpack(fmt, buf)
+
+    def read_string(self):
+        (length,) = self.read("=H")
+        buf = self.f.read(length)
+        if len(buf) != length:
+            raise EOFError()
+        return buf.decode("utf-8", "replace")
+
+
+class Output(object):
+    """One category of the TEXT format, rolled over every rollOver rows like NlsrTracer"""
+
+    def __init__(self, prefix, infix, header, rollOver):
+        self.prefix = prefix
+        self.infix = infix
+        self.header = header
+        self.rollOver = rollOver
+        self.nFiles = 0
+        self.nRows = 0
+        self.f = None
+        self.open()
+
+    def open(self):
+        if self.f:
+            self.f.close()
+        self.f = open("%s%s%d.txt" % (self.prefix, self.infix, self.nFiles), "w")
+        self.nFiles += 1
+        self.f.write("\t".join(self.header) + "\n")
+
+    def write(self, columns):
+        self.f.write("\t".join(columns) + "\n")
+        self.nRows += 1
+        if self.rollOver > 0 and self.nRows == self.rollOver:
+            self.nRows = 0
+            self.open()
+
+    def close(self):
+        if self.f:
+            self.f.close()
+
+
+class Input(object):
+    """Events of one binary trace; each rank of a distributed simulation writes its own"""
+
+    def __init__(self, path):
+        self.path = path
+        self.nodes = {}  # node id => name
+        self.names = {}  # name id => uri
+
+    def on_node(self, r):
+        (node,) = r.read("=I")
+        self.nodes[node] = r.read_string()
+
+    def on_name(self, r):
+        (nameId,) = r.read("=I")
+        self.names[nameId] = r.read_string()
+
+    def on_reset(self, r):
+        # the tracer forgot its names; ids are never reused, so only memory is released
+        self.names.clear()
+
+    def events(self, index):
+        """Yield (time, input index, sequence number, category, columns) in file order"""
+        with open(self.path, "rb") as f:
+            r = Reader(f)
+            magic = f.read(8)
+            if magic != b"NLSRTRB1":
+                sys.exit("%s: not an NlsrTracer binary file" % self.path)
+
+            handlers = {b"N": self.on_node, b"S": self.on_name, b"R": self.on_reset}
+            seq = 0
+            try:
+                while True:
+                    tag = f.read(1)
+                    if not tag:
+                        break
+                    if tag != b"E":
+                        if tag not in handlers:
+                            sys.exit("%s: unknown record type %r" % (self.path, tag))
+                        handlers[tag](r)
+                        continue
+
+                    timeNs, node, event, nameId, count, size = r.read("=qIBIQQ")
+                    category, typeName = EVENTS[event]
+                    yield (timeNs, index, seq, category, [
+                        "%g" % (timeNs / 1e9),
+                        self.nodes.get(node, ""),
+                        "-" if nameId == NO_NAME else self.names[nameId],
+                        typeName,
+                        str(count),
+                        "-" if size == NO_SIZE else str(size),
+                        "-",
+                        "-"])
+                    seq += 1
+            except EOFError:
+                sys.stderr.write("%s: truncated record at end of file\n" % self.path)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("-o", "--prefix",
+                        help="prefix of output files (default: first input file name without "
+                             "%s and -rank<N>)" % SUFFIX)
+    parser.add_argument("-r", "--roll-over", type=int, default=0,
+                        help="start a new file every ROLL_OVER rows, like LOG_ROLL_OVER "
+                             "(default: 0, no roll-over)")
+    parser.add_argument("inputs", nargs="+",
+                        help="file(s) written by NlsrTracer in BINARY format; the files of all "
+                             "ranks of a distributed simulation are merged by time")
+    args = parser.parse_args()
+
+    prefix = args.prefix
+    if prefix is None:
+        first = args.inputs[0]
+        prefix = first[:-len(SUFFIX)] if first.endswith(SUFFIX) else first
+        prefix = re.sub(r"-rank[0-9]+$", "", prefix)
+
+    outputs = dict((category, Output(prefix, infix, header, args.roll_over))
+                   for category, (infix, header) in CATEGORIES.items())
+    streams = [Input(path).events(index) for index, path in enumerate(args.inputs)]
+    for _, _, _, category, columns in heapq.merge(*streams):
+        outputs[category].write(columns)
+
+    for output in outputs.values():
+        output.close()
+
+
+if __name__ == "__main__":
+    main()
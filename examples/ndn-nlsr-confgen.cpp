@@ -685,10 +685,13 @@ main (int argc, char *argv[])
   //std::string topo_file = std::string(homeDir) + "/sandbox/creepyCode/networkx/scalefree_topo.dot";
 
   opterr = 0;
-  while ((c = getopt (argc, argv, "at:")) != -1)
+  while ((c = getopt (argc, argv, "at:f:")) != -1)
     switch (c) {
       case 'a':
         break;
+      case 'f':
+        topo_file = std::string(optarg);
+        break;
       case 't':
         type = std::string(optarg);
 	if (type.compare("ls") == 0 || type.compare("hb") == 0) {
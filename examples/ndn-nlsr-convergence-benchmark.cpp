@@ -0,0 +1,628 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-nlsr-convergence-benchmark.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/ndnSIM-module.h"
+#include "ns3/log.h"
+
+#include "apps/ndn-nlsr-app.hpp"
+#include "utils/tracers/ndn-nlsr-tracer.hpp"
+#include "utils/topology/nlsr-conf-reader.hpp"
+#include "utils/mem-usage.hpp"
+#include "utils/ndn-nlsr-fast-forward.hpp"
+
+#include "ns3/ndnSIM/helper/ndn-link-control-helper.hpp"
+#include "ns3/ndnSIM/helper/ndn-global-routing-helper.hpp"
+#include "ns3/ndnSIM/model/ndn-global-router.hpp"
+#include "ns3/ndnSIM/model/ndn-l3-protocol.hpp"
+#include "ns3/ndnSIM/model/ndn-net-device-link-service.hpp"
+
+#include "daemon/fw/forwarder.hpp"
+
+#include <chrono>
+#include <ctime>
+#include <fstream>
+#include <limits>
+#include <memory>
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("NdnNlsrConvergenceBenchmark");
+
+/**
+ * This scenario measures how fast NLSR converges after link and node failures.
+ *
+ * The topology is built from NLSR configuration files, which can be generated for any BRITE
+ * topology in src/ndnSIM/examples/ndn-nlsr-conf/ with ndn-nlsr-confgen:
+ *
+ *     ./waf --run "ndn-nlsr-confgen -f src/ndnSIM/examples/ndn-nlsr-conf/50_node_router.brite"
+ *     ./waf --run "ndn-nlsr-convergence-benchmark --failures=10 --output=50-nodes.json"
+ *
+ * After an initial warm-up, the scenario fails a random link (or, with probability
+ * --nodeFailureRatio, all links of a random node) every --interval seconds and brings it back
+ * up half an interval later.  Every --checkInterval seconds the FIB of each NLSR instance is
+ * compared with routes calculated by GlobalRoutingHelper on the current topology: a node agrees
+ * with the oracle when it has an entry for exactly the reachable prefixes, and the cheapest
+ * next hop of each entry is one of the shortest-path next hops.  Since the oracle uses face
+ * metrics, link costs in NLSR configuration are expected to be uniform, as generated by
+ * ndn-nlsr-confgen.
+ *
+ * The report is a JSON object with, for each phase (initial start-up, each failure, and each
+ * recovery), the time until all nodes last started to agree with the oracle (null if they did
+ * not agree at the end of the phase), the number of NDN packets sent over links, and the number
+ * of NLSR routing table calculations; and, for the whole run, simulated, wall-clock and CPU
+ * time and the peak resident set size.
+ *
+ * With --snapshot, NLSR starts from the converged LSDB in that file instead of going through
+ * HELLOs, sync and LSA fetching; the file is first generated from the configuration files if
+ * it does not exist.  The warm-up can then be much shorter:
+ *
+ *     ./waf --run "ndn-nlsr-convergence-benchmark --snapshot=50-nodes.lsdb --warmup=10"
+ *
+ * With --fastForward, NLSR instances are suspended once the network has been quiescent for
+ * that many seconds, and resumed at the next failure or recovery (see NlsrFastForward).  The
+ * report then also gives the suspended time and the number of HELLO and sync Interests that
+ * were not sent.  Long runs with few failures finish much faster:
+ *
+ *     ./waf --run "ndn-nlsr-convergence-benchmark --failures=100 --interval=3600 --fastForward=60"
+ *
+ * Use --RngRun to get a different failure schedule.
+ */
+class ConvergenceMonitor
+{
+public:
+  ConvergenceMonitor(const NodeContainer& nodes, Time checkInterval)
+    : m_nodes(nodes)
+    , m_checkInterval(checkInterval)
+    , m_isOracleValid(false)
+    , m_fastForward(nullptr)
+    , m_nControlMessages(0)
+    , m_nSpfRuns(0)
+    , m_peakRss(0)
+  {
+    for (NodeContainer::Iterator node = m_nodes.Begin(); node != m_nodes.End(); ++node) {
+      m_nodeNames[(*node)->GetId()] = GetNlsrApp(*node)->GetNodeName();
+    }
+  }
+
+  /**
+   * @brief Start monitoring once NLSR instances, started at @p nlsrStartTime, are running
+   */
+  void
+  Start(Time nlsrStartTime)
+  {
+    Simulator::Schedule(nlsrStartTime, &ConvergenceMonitor::WaitForNlsr, this);
+  }
+
+  /**
+   * @brief Wake @p fastForward before each failure and recovery
+   */
+  void
+  SetFastForward(ndn::NlsrFastForward* fastForward)
+  {
+    m_fastForward = fastForward;
+  }
+
+  void
+  FailLink(Ptr<Node> node1, Ptr<Node> node2)
+  {
+    StartPhase("fail-link", GetLinkName(node1, node2));
+    SetLinkDown(node1, node2);
+  }
+
+  void
+  UpLink(Ptr<Node> node1, Ptr<Node> node2)
+  {
+    StartPhase("up-link", GetLinkName(node1, node2));
+    SetLinkUp(node1, node2);
+  }
+
+  void
+  FailNode(Ptr<Node> node, std::vector<Ptr<Node>> neighbors)
+  {
+    StartPhase("fail-node", m_nodeNames[node->GetId()]);
+    for (const auto& neighbor : neighbors) {
+      SetLinkDown(node, neighbor);
+    }
+  }
+
+  void
+  UpNode(Ptr<Node> node, std::vector<Ptr<Node>> neighbors)
+  {
+    StartPhase("up-node", m_nodeNames[node->GetId()]);
+    for (const auto& neighbor : neighbors) {
+      SetLinkUp(node, neighbor);
+    }
+  }
+
+  /**
+   * @brief Close the last phase and write the report
+   */
+  void
+  Report(std::ostream& os, const std::string& conf, size_t nLinks,
+         double wallTime, double cpuTime)
+  {
+    FinishPhase();
+    m_peakRss = std::max(m_peakRss, MemUsage::Get());
+
+    uint64_t nControlMessages = 0;
+    uint64_t nSpfRuns = 0;
+    for (const auto& phase : m_phases) {
+      nControlMessages += phase.nControlMessages;
+      nSpfRuns += phase.nSpfRuns;
+    }
+
+    os << "{\n"
+       << "  \"conf\": \"" << conf << "\",\n"
+       << "  \"nodes\": " << m_nodes.GetN() << ",\n"
+       << "  \"links\": " << nLinks << ",\n"
+       << "  \"seed\": " << RngSeedManager::GetSeed() << ",\n"
+       << "  \"run\": " << RngSeedManager::GetRun() << ",\n"
+       << "  \"simulatedTime\": " << Simulator::Now().ToDouble(Time::S) << ",\n"
+       << "  \"wallTime\": " << wallTime << ",\n"
+       << "  \"cpuTime\": " << cpuTime << ",\n"
+       << "  \"peakRss\": " << m_peakRss << ",\n"
+       << "  \"controlMessages\": " << nControlMessages << ",\n"
+       << "  \"spfRuns\": " << nSpfRuns << ",\n";
+    if (m_fastForward != nullptr) {
+      // up to the last recovery
+      os << "  \"suspensions\": " << m_fastForward->GetNSuspensions() << ",\n"
+         << "  \"suspendedTime\": "
+         << m_fastForward->GetSuspendedTime().ToDouble(Time::S) << ",\n"
+         << "  \"suppressedInterests\": " << m_fastForward->GetNSuppressedInterests() << ",\n";
+    }
+    os << "  \"phases\": [";
+
+    for (size_t i = 0; i < m_phases.size(); ++i) {
+      const Phase& phase = m_phases[i];
+      os << (i == 0 ? "\n" : ",\n")
+         << "    {\"event\": \"" << phase.event << "\", "
+         << "\"target\": \"" << phase.target << "\", "
+         << "\"time\": " << phase.start.ToDouble(Time::S) << ", "
+         << "\"convergenceTime\": ";
+      if (phase.isConverged) {
+        os << (phase.convergedAt - phase.start).ToDouble(Time::S);
+      }
+      else {
+        os << "null";
+      }
+      os << ", \"controlMessages\": " << phase.nControlMessages
+         << ", \"spfRuns\": " << phase.nSpfRuns << "}";
+    }
+    os << "\n  ]\n}\n";
+  }
+
+private:
+  struct Phase
+  {
+    std::string event;
+    std::string target;
+    Time start;
+    Time convergedAt;
+    bool isConverged;
+    uint64_t nControlMessages;
+    uint64_t nSpfRuns;
+  };
+
+  /**
+   * @brief Shortest-path next hops towards a prefix
+   */
+  struct Route
+  {
+    int32_t metric;
+    std::set<std::string> neighbors;
+  };
+
+  typedef std::pair<uint32_t, uint32_t> LinkKey;
+
+  void
+  WaitForNlsr()
+  {
+    // NlsrApp creates its NLSR instance only when started, and application start events due
+    // at the same time were scheduled after this one
+    Simulator::ScheduleNow(&ConvergenceMonitor::OnNlsrStarted, this);
+  }
+
+  void
+  OnNlsrStarted()
+  {
+    AddOrigins();
+    StartPhase("start", "");
+    Check();
+  }
+
+  /**
+   * @brief Register prefixes advertised by NLSR instances as GlobalRoutingHelper origins
+   */
+  void
+  AddOrigins()
+  {
+    ndn::GlobalRoutingHelper grHelper;
+    for (NodeContainer::Iterator node = m_nodes.Begin(); node != m_nodes.End(); ++node) {
+      nlsr::Nlsr& nlsr = GetNlsrApp(*node)->GetNlsr();
+
+      grHelper.AddOrigin(nlsr.getConfParameter().getRouterPrefix().toUri(), *node);
+      m_origins.insert(nlsr.getConfParameter().getRouterPrefix());
+
+      for (const ndn::Name& prefix : nlsr.getNamePrefixList().getNameList()) {
+        grHelper.AddOrigin(prefix.toUri(), *node);
+        m_origins.insert(prefix);
+      }
+    }
+  }
+
+  static Ptr<ndn::NlsrApp>
+  GetNlsrApp(Ptr<Node> node)
+  {
+    Ptr<ndn::NlsrApp> nlsrApp = node->GetApplication(0)->GetObject<ndn::NlsrApp>();
+    NS_ASSERT(nlsrApp != 0);
+    return nlsrApp;
+  }
+
+  static LinkKey
+  GetLinkKey(Ptr<Node> node1, Ptr<Node> node2)
+  {
+    return std::make_pair(std::min(node1->GetId(), node2->GetId()),
+                          std::max(node1->GetId(), node2->GetId()));
+  }
+
+  std::string
+  GetLinkName(Ptr<Node> node1, Ptr<Node> node2)
+  {
+    return m_nodeNames[node1->GetId()] + "-" + m_nodeNames[node2->GetId()];
+  }
+
+  /**
+   * @brief Fail the link and hide it from GlobalRoutingHelper
+   */
+  void
+  SetLinkDown(Ptr<Node> node1, Ptr<Node> node2)
+  {
+    NS_LOG_INFO("Link " << GetLinkName(node1, node2) << " is down");
+    ndn::LinkControlHelper::FailLink(node1, node2);
+
+    Ptr<ndn::GlobalRouter> gr1 = node1->GetObject<ndn::GlobalRouter>();
+    Ptr<ndn::GlobalRouter> gr2 = node2->GetObject<ndn::GlobalRouter>();
+    ndn::GlobalRouter::IncidencyList& removed = m_removedIncidencies[GetLinkKey(node1, node2)];
+
+    for (const auto& gr : {gr1, gr2}) {
+      Ptr<ndn::GlobalRouter> other = gr == gr1 ? gr2 : gr1;
+      ndn::GlobalRouter::IncidencyList& incidencies = gr->GetIncidencies();
+      for (auto i = incidencies.begin(); i != incidencies.end();) {
+        if (std::get<2>(*i) == other) {
+          removed.push_back(*i);
+          i = incidencies.erase(i);
+        }
+        else {
+          ++i;
+        }
+      }
+    }
+    m_isOracleValid = false;
+  }
+
+  void
+  SetLinkUp(Ptr<Node> node1, Ptr<Node> node2)
+  {
+    NS_LOG_INFO("Link " << GetLinkName(node1, node2) << " is up");
+    ndn::LinkControlHelper::UpLink(node1, node2);
+
+    auto removed = m_removedIncidencies.find(GetLinkKey(node1, node2));
+    if (removed != m_removedIncidencies.end()) {
+      for (const auto& incidency : removed->second) {
+        std::get<0>(incidency)->GetIncidencies().push_back(incidency);
+      }
+      m_removedIncidencies.erase(removed);
+    }
+    m_isOracleValid = false;
+  }
+
+  std::string
+  GetNeighborName(Ptr<Node> node, const shared_ptr<ndn::Face>& face)
+  {
+    for (const auto& incidency : node->GetObject<ndn::GlobalRouter>()->GetIncidencies()) {
+      if (std::get<1>(incidency) == face) {
+        return m_nodeNames[std::get<2>(incidency)->GetObject<Node>()->GetId()];
+      }
+    }
+    return "";
+  }
+
+  void
+  UpdateOracle()
+  {
+    m_oracle.clear();
+    ndn::GlobalRoutingHelper::CalculateAllPossibleRoutes(
+      [this] (Ptr<Node> node, const ndn::Name& prefix, shared_ptr<ndn::Face> face, int32_t metric) {
+        auto inserted = m_oracle[node->GetId()].insert({prefix, Route{metric, {}}});
+        Route& route = inserted.first->second;
+        if (metric < route.metric) {
+          route.metric = metric;
+          route.neighbors.clear();
+        }
+        if (metric == route.metric) {
+          route.neighbors.insert(GetNeighborName(node, face));
+        }
+      });
+    m_isOracleValid = true;
+  }
+
+  /**
+   * @brief Check whether the NLSR FIB of the node agrees with the oracle
+   */
+  bool
+  IsConverged(Ptr<Node> node)
+  {
+    nlsr::Nlsr& nlsr = GetNlsrApp(node)->GetNlsr();
+    const std::map<ndn::Name, Route>& expected = m_oracle[node->GetId()];
+
+    size_t nMatched = 0;
+    for (const nlsr::FibEntry& entry : nlsr.getFib().getTable()) {
+      const nlsr::NexthopList& nexthops = entry.getNexthopList();
+      if (nexthops.cbegin() == nexthops.cend() || m_origins.count(entry.getName()) == 0) {
+        continue;
+      }
+
+      auto route = expected.find(entry.getName());
+      if (route == expected.end()) {
+        return false;
+      }
+
+      auto best = nexthops.cbegin();
+      for (auto nexthop = nexthops.cbegin(); nexthop != nexthops.cend(); ++nexthop) {
+        if (nexthop->getRouteCost() < best->getRouteCost()) {
+          best = nexthop;
+        }
+      }
+
+      nlsr::Adjacent* adjacent = nlsr.getAdjacencyList().findAdjacent(best->getConnectingFaceUri());
+      if (adjacent == nullptr ||
+          route->second.neighbors.count(adjacent->getSimulatedName()) == 0) {
+        return false;
+      }
+      ++nMatched;
+    }
+
+    return nMatched == expected.size();
+  }
+
+  void
+  Check()
+  {
+    if (!m_isOracleValid) {
+      UpdateOracle();
+    }
+
+    bool isConverged = true;
+    for (NodeContainer::Iterator node = m_nodes.Begin(); node != m_nodes.End(); ++node) {
+      if (!IsConverged(*node)) {
+        isConverged = false;
+        break;
+      }
+    }
+
+    Phase& phase = m_phases.back();
+    if (isConverged && !phase.isConverged) {
+      NS_LOG_INFO("Converged after " << (Simulator::Now() - phase.start).ToDouble(Time::S)
+                  << "s");
+      phase.convergedAt = Simulator::Now();
+    }
+    phase.isConverged = isConverged;
+
+    m_peakRss = std::max(m_peakRss, MemUsage::Get());
+    Simulator::Schedule(m_checkInterval, &ConvergenceMonitor::Check, this);
+  }
+
+  uint64_t
+  CountControlMessages()
+  {
+    uint64_t nMessages = 0;
+    for (NodeContainer::Iterator node = m_nodes.Begin(); node != m_nodes.End(); ++node) {
+      Ptr<ndn::L3Protocol> l3 = (*node)->GetObject<ndn::L3Protocol>();
+      for (const auto& face : l3->getForwarder()->getFaceTable()) {
+        if (dynamic_cast<ndn::NetDeviceLinkService*>(face->getLinkService()) == nullptr) {
+          continue;
+        }
+        nMessages += face->getCounters().nOutInterests + face->getCounters().nOutData;
+      }
+    }
+    return nMessages;
+  }
+
+  uint64_t
+  CountSpfRuns()
+  {
+    uint64_t nRuns = 0;
+    for (NodeContainer::Iterator node = m_nodes.Begin(); node != m_nodes.End(); ++node) {
+      nRuns += GetNlsrApp(*node)->GetNlsr().getRoutingTable().getNCalculations();
+    }
+    return nRuns;
+  }
+
+  void
+  StartPhase(const std::string& event, const std::string& target)
+  {
+    if (m_fastForward != nullptr) {
+      m_fastForward->Wake();
+    }
+    FinishPhase();
+    NS_LOG_INFO("Phase " << event << " " << target);
+
+    m_phases.push_back(Phase{event, target, Simulator::Now(), Time(), false, 0, 0});
+    m_nControlMessages = CountControlMessages();
+    m_nSpfRuns = CountSpfRuns();
+  }
+
+  void
+  FinishPhase()
+  {
+    if (m_phases.empty()) {
+      return;
+    }
+    Phase& phase = m_phases.back();
+    phase.nControlMessages = CountControlMessages() - m_nControlMessages;
+    phase.nSpfRuns = CountSpfRuns() - m_nSpfRuns;
+  }
+
+private:
+  NodeContainer m_nodes;
+  Time m_checkInterval;
+  std::map<uint32_t, std::string> m_nodeNames;
+  std::set<ndn::Name> m_origins;
+
+  std::map<LinkKey, ndn::GlobalRouter::IncidencyList> m_removedIncidencies;
+  std::map<uint32_t, std::map<ndn::Name, Route>> m_oracle;
+  bool m_isOracleValid;
+  ndn::NlsrFastForward* m_fastForward;
+
+  std::vector<Phase> m_phases;
+  uint64_t m_nControlMessages;
+  uint64_t m_nSpfRuns;
+  int64_t m_peakRss;
+};
+
+int
+main (int argc, char *argv[])
+{
+  std::string conf = "src/ndnSIM/examples/ndn-nlsr-conf/nlsr_sim.conf";
+  std::string output = "nlsr-convergence.json";
+  uint32_t nFailures = 5;
+  double nodeFailureRatio = 0.2;
+  double warmup = 120;
+  double interval = 120;
+  double checkInterval = 0.1;
+  std::string snapshot;
+  double fastForward = 0;
+
+  CommandLine cmd;
+  cmd.AddValue("conf", "NLSR simulation configuration (as generated by ndn-nlsr-confgen)", conf);
+  cmd.AddValue("output", "File to write the JSON report to", output);
+  cmd.AddValue("failures", "Number of failures to inject", nFailures);
+  cmd.AddValue("nodeFailureRatio", "Probability that a failure takes down a whole node",
+               nodeFailureRatio);
+  cmd.AddValue("warmup", "Time (s) before the first failure", warmup);
+  cmd.AddValue("interval", "Time (s) between failures; each is recovered half-way", interval);
+  cmd.AddValue("checkInterval", "Time (s) between FIB comparisons with the oracle",
+               checkInterval);
+  cmd.AddValue("snapshot", "LSDB snapshot to start NLSR from (generated if the file is missing)",
+               snapshot);
+  cmd.AddValue("fastForward", "Time (s) of quiescence after which NLSR is suspended (0 = never)",
+               fastForward);
+  cmd.Parse (argc, argv);
+
+  // Build the NLSR network topology from nlsr.conf
+  ndn::NlsrConfReader nlsrConfReader(conf, 15);
+  NodeContainer nodes = nlsrConfReader.Read();
+  const std::list<TopologyReader::Link>& links = nlsrConfReader.GetLinks();
+  NS_ABORT_MSG_IF(links.empty(), "Topology " << conf << " has no links to fail");
+
+  if (!snapshot.empty()) {
+    if (!std::ifstream(snapshot.c_str()).good()) {
+      nlsrConfReader.WriteLsdbSnapshot(snapshot);
+    }
+    nlsrConfReader.SetLsdbSnapshot(snapshot);
+  }
+
+  ndn::NlsrTracer::Instance().InitializeTracer(std::to_string(nodes.GetN()) + "-convergence",
+                                               ndn::NlsrTracer::BINARY);
+
+  ndn::AppHelper nlsrHelper ("ns3::ndn::NlsrApp");
+  nlsrHelper.Install(nodes);
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.InstallAll();
+
+  ndn::StrategyChoiceHelper::InstallAll("/", "ndn:/localhost/nfd/strategy/best-route");
+
+  nlsrConfReader.InitializeNlsr();
+
+  // GlobalRouter interfaces only serve as the oracle, routes are not installed into FIBs
+  ndn::GlobalRoutingHelper grHelper;
+  grHelper.InstallAll();
+
+  // NlsrConfReader::InitializeNlsr starts NLSR at 1s
+  ConvergenceMonitor monitor(nodes, Seconds(checkInterval));
+  monitor.Start(Seconds(1.0));
+
+  std::unique_ptr<ndn::NlsrFastForward> nlsrFastForward;
+  if (fastForward > 0) {
+    nlsrFastForward.reset(new ndn::NlsrFastForward(nodes, Seconds(fastForward)));
+    nlsrFastForward->Start(Seconds(1.0));
+    monitor.SetFastForward(nlsrFastForward.get());
+  }
+
+  Ptr<UniformRandomVariable> random = CreateObject<UniformRandomVariable>();
+  std::vector<const TopologyReader::Link*> linkList;
+  std::map<uint32_t, std::vector<Ptr<Node>>> neighbors;
+  for (const auto& link : links) {
+    linkList.push_back(&link);
+    neighbors[link.GetFromNode()->GetId()].push_back(link.GetToNode());
+    neighbors[link.GetToNode()->GetId()].push_back(link.GetFromNode());
+  }
+
+  for (uint32_t i = 0; i < nFailures; ++i) {
+    Time failAt = Seconds(warmup + i * interval);
+    Time upAt = Seconds(warmup + i * interval + interval / 2);
+
+    if (random->GetValue() < nodeFailureRatio) {
+      Ptr<Node> node = nodes.Get(random->GetInteger(0, nodes.GetN() - 1));
+      Simulator::Schedule(failAt, &ConvergenceMonitor::FailNode, &monitor, node,
+                          neighbors[node->GetId()]);
+      Simulator::Schedule(upAt, &ConvergenceMonitor::UpNode, &monitor, node,
+                          neighbors[node->GetId()]);
+    }
+    else {
+      const TopologyReader::Link* link = linkList[random->GetInteger(0, linkList.size() - 1)];
+      Simulator::Schedule(failAt, &ConvergenceMonitor::FailLink, &monitor,
+                          link->GetFromNode(), link->GetToNode());
+      Simulator::Schedule(upAt, &ConvergenceMonitor::UpLink, &monitor,
+                          link->GetFromNode(), link->GetToNode());
+    }
+  }
+
+  Simulator::Stop(Seconds(warmup + nFailures * interval));
+
+  std::clock_t cpuStart = std::clock();
+  auto wallStart = std::chrono::steady_clock::now();
+
+  Simulator::Run ();
+
+  double cpuTime = static_cast<double>(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+  double wallTime = std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                                  wallStart).count();
+
+  std::ofstream os(output.c_str());
+  monitor.Report(os, conf, links.size(), wallTime, cpuTime);
+  NS_LOG_UNCOND("Convergence report written to " << output);
+
+  Simulator::Destroy ();
+
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  return ns3::main(argc, argv);
+}
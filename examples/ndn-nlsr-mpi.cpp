@@ -0,0 +1,130 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-nlsr-mpi.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/ndnSIM-module.h"
+#include "ns3/mpi-interface.h"
+
+#include "utils/tracers/ndn-nlsr-tracer.hpp"
+#include "utils/topology/nlsr-conf-reader.hpp"
+
+#ifdef NS3_MPI
+#include <mpi.h>
+#else
+#error "ndn-nlsr-mpi scenario can be compiled only if NS3_MPI is enabled"
+#endif
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("NdnNlsrMpi");
+
+/**
+ * This scenario runs NLSR on a topology generated by ndn-nlsr-confgen, distributed over
+ * MPI ranks on one or more machines.
+ *
+ * NlsrConfReader assigns the routers to ranks with a min-edge-cut partition of the
+ * topology, weighting routers by their number of neighbors.  Links between ranks use the
+ * delay from the configuration files (at least `minLookahead`), which is the lookahead of
+ * the distributed simulator: the longer these links, the less often ranks synchronize.
+ *
+ * Every rank runs the NLSR instances of its own routers and writes its own traces
+ * (<prefix>-rank<N>-...).  Merge them by time with
+ *
+ *     examples/graphs/merge-rank-traces.py        (TEXT traces, L3 rate traces)
+ *     examples/graphs/nlsr-trace-to-tsv.py        (BINARY NlsrTracer traces)
+ *
+ * To run the scenario on 4 local cores:
+ *
+ *     mpirun -np 4 ./waf --run "ndn-nlsr-mpi --conf=src/ndnSIM/examples/ndn-nlsr-conf/nlsr_sim.conf"
+ */
+
+int
+main (int argc, char *argv[])
+{
+  std::string conf = "src/ndnSIM/examples/ndn-nlsr-conf/nlsr_sim.conf";
+  std::string minLookahead = "1ms";
+  double stopTime = 200.0;
+  bool nullmsg = false;
+
+  CommandLine cmd;
+  cmd.AddValue ("conf", "NLSR simulation configuration (as generated by ndn-nlsr-confgen)", conf);
+  cmd.AddValue ("minLookahead", "Minimum delay of links between ranks", minLookahead);
+  cmd.AddValue ("stop", "Simulation time in seconds", stopTime);
+  cmd.AddValue ("nullmsg", "Enable the use of null-message synchronization", nullmsg);
+  cmd.Parse (argc, argv);
+
+  // Distributed simulation setup; by default use granted time window algorithm.
+  if (nullmsg) {
+    GlobalValue::Bind ("SimulatorImplementationType",
+                       StringValue ("ns3::NullMessageSimulatorImpl"));
+  }
+  else {
+    GlobalValue::Bind ("SimulatorImplementationType",
+                       StringValue ("ns3::DistributedSimulatorImpl"));
+  }
+
+  MpiInterface::Enable (&argc, &argv);
+  uint32_t systemId = MpiInterface::GetSystemId ();
+  uint32_t systemCount = MpiInterface::GetSize ();
+
+  // Every rank builds the whole topology with the same partition
+  ndn::NlsrConfReader nlsrConfReader (conf, 15);
+  nlsrConfReader.SetPartitions (systemCount, Time (minLookahead));
+  NodeContainer nodes = nlsrConfReader.Read ();
+  NodeContainer localNodes = nlsrConfReader.GetLocalNodes ();
+  NS_LOG_INFO ("Rank " << systemId << " simulates " << localNodes.GetN () << " of "
+               << nodes.GetN () << " nodes");
+
+  ndn::NlsrTracer& tracer = ndn::NlsrTracer::Instance ();
+  std::string prefix = std::to_string (nodes.GetN ());
+  tracer.InitializeTracer (prefix);
+
+  // NLSR runs on the local nodes only
+  ndn::AppHelper nlsrHelper ("ns3::ndn::NlsrApp");
+  nlsrHelper.Install (localNodes);
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.InstallAll ();
+
+  ndn::StrategyChoiceHelper::InstallAll ("/", "ndn:/localhost/nfd/strategy/best-route");
+
+  nlsrConfReader.InitializeNlsr ();
+
+  ndn::L3RateTracer::Install (localNodes, prefix + "-rank" + std::to_string (systemId)
+                                            + "-nlsr-l3-rate-trace.txt", Seconds (10));
+
+  Simulator::Stop (Seconds (stopTime));
+
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  MpiInterface::Disable ();
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main (int argc, char *argv[])
+{
+  return ns3::main (argc, argv);
+}
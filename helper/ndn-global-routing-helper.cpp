@@ -49,12 +49,17 @@
 
 #include <boost/lexical_cast.hpp>
 #include <boost/foreach.hpp>
-#include <boost/concept/assert.hpp>
-#include <boost/graph/dijkstra_shortest_paths.hpp>
 
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <queue>
+#include <thread>
 #include <unordered_map>
-
-#include "boost-graph-ndn-global-routing-helper.hpp"
+#include <vector>
 
 #include <math.h>
 
@@ -63,6 +68,350 @@ NS_LOG_COMPONENT_DEFINE("ndn.GlobalRoutingHelper");
 namespace ns3 {
 namespace ndn {
 
+namespace {
+
+/**
+ * @brief Snapshot of the GlobalRouter graph in compressed sparse row form
+ *
+ * Route calculation threads only read the plain arrays of the snapshot, as reference counting
+ * of ns3::Ptr is not thread-safe.  Vertices are the GlobalRouters of nodes in NodeList order,
+ * followed by those of (multi-access) channels.
+ */
+struct RouterGraph
+{
+  static const uint32_t NO_FACE = std::numeric_limits<uint32_t>::max();
+  static const uint32_t NO_EDGE = std::numeric_limits<uint32_t>::max();
+
+  /// paths at least this long are unreachable, like boost::WeightInf in the boost graph adaptor
+  static const uint32_t INF = std::numeric_limits<uint16_t>::max();
+
+  struct Edge
+  {
+    uint32_t to;
+    uint32_t metric;
+    uint32_t face; ///< index in faces, NO_FACE for edges leaving a channel
+  };
+
+  struct Route
+  {
+    uint32_t destination;
+    uint32_t face;
+    uint32_t metric;
+  };
+
+  RouterGraph();
+
+  std::vector<Ptr<GlobalRouter>> routers;
+  std::vector<uint32_t> offsets; ///< out-edges of vertex v are edges[offsets[v] .. offsets[v + 1])
+  std::vector<Edge> edges;
+  std::vector<uint32_t> reverse; ///< edge index of the opposite direction, or NO_EDGE
+  std::vector<shared_ptr<Face>> faces;
+
+  std::vector<uint32_t> sources; ///< vertices of nodes
+  std::vector<Ptr<Node>> sourceNodes;
+  std::vector<uint32_t> destinations; ///< vertices with local prefixes
+};
+
+const uint32_t RouterGraph::NO_FACE;
+const uint32_t RouterGraph::NO_EDGE;
+const uint32_t RouterGraph::INF;
+
+RouterGraph::RouterGraph()
+{
+  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
+    Ptr<GlobalRouter> gr = (*node)->GetObject<GlobalRouter>();
+    if (gr == 0) {
+      NS_LOG_DEBUG("Node " << (*node)->GetId() << " does not export GlobalRouter interface");
+      continue;
+    }
+    sources.push_back(routers.size());
+    sourceNodes.push_back(*node);
+    routers.push_back(gr);
+  }
+
+  for (ChannelList::Iterator channel = ChannelList::Begin(); channel != ChannelList::End();
+       channel++) {
+    Ptr<GlobalRouter> gr = (*channel)->GetObject<GlobalRouter>();
+    if (gr != 0) {
+      routers.push_back(gr);
+    }
+  }
+
+  std::unordered_map<const GlobalRouter*, uint32_t> vertexIds;
+  for (uint32_t v = 0; v < routers.size(); ++v) {
+    vertexIds[PeekPointer(routers[v])] = v;
+  }
+
+  std::unordered_map<const Face*, uint32_t> faceIds;
+  offsets.push_back(0);
+  for (uint32_t v = 0; v < routers.size(); ++v) {
+    for (const auto& incidency : routers[v]->GetIncidencies()) {
+      auto to = vertexIds.find(PeekPointer(std::get<2>(incidency)));
+      if (to == vertexIds.end()) {
+        continue;
+      }
+
+      const shared_ptr<Face>& face = std::get<1>(incidency);
+      if (face == nullptr) {
+        edges.push_back({to->second, 0, NO_FACE});
+        continue;
+      }
+
+      auto faceId = faceIds.insert(std::make_pair(face.get(), faces.size()));
+      if (faceId.second) {
+        faces.push_back(face);
+      }
+      edges.push_back({to->second, face->getMetric(), faceId.first->second});
+    }
+    offsets.push_back(edges.size());
+
+    if (!routers[v]->GetLocalPrefixes().empty()) {
+      destinations.push_back(v);
+    }
+  }
+
+  reverse.assign(edges.size(), NO_EDGE);
+  for (uint32_t v = 0; v < routers.size(); ++v) {
+    for (uint32_t e = offsets[v]; e < offsets[v + 1]; ++e) {
+      uint32_t w = edges[e].to;
+      for (uint32_t back = offsets[w]; back < offsets[w + 1]; ++back) {
+        if (edges[back].to == v) {
+          reverse[e] = back;
+          break;
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Dijkstra's algorithm over RouterGraph with reusable per-thread buffers
+ */
+class ShortestPaths
+{
+public:
+  explicit ShortestPaths(const RouterGraph& graph)
+    : m_graph(graph)
+    , m_distances(graph.routers.size())
+    , m_firstHops(graph.routers.size())
+  {
+  }
+
+  /**
+   * @brief Compute distances and first-hop faces from @p source
+   * @param onlyEdge if not NO_EDGE, the only edge used to leave @p source
+   */
+  void
+  Compute(uint32_t source, uint32_t onlyEdge = RouterGraph::NO_EDGE)
+  {
+    std::fill(m_distances.begin(), m_distances.end(), RouterGraph::INF);
+    std::fill(m_firstHops.begin(), m_firstHops.end(), RouterGraph::NO_FACE);
+
+    typedef std::pair<uint32_t, uint32_t> Entry; // (distance, vertex)
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+    m_distances[source] = 0;
+    queue.push(Entry(0, source));
+
+    while (!queue.empty()) {
+      Entry entry = queue.top();
+      queue.pop();
+      uint32_t u = entry.second;
+      if (entry.first > m_distances[u]) {
+        continue; // stale
+      }
+
+      uint32_t begin = m_graph.offsets[u];
+      uint32_t end = m_graph.offsets[u + 1];
+      if (u == source && onlyEdge != RouterGraph::NO_EDGE) {
+        begin = onlyEdge;
+        end = onlyEdge + 1;
+      }
+
+      for (uint32_t e = begin; e < end; ++e) {
+        const RouterGraph::Edge& edge = m_graph.edges[e];
+        uint32_t distance = entry.first + edge.metric;
+        if (distance < m_distances[edge.to]) {
+          m_distances[edge.to] = distance;
+          m_firstHops[edge.to] = m_firstHops[u] != RouterGraph::NO_FACE ? m_firstHops[u] : edge.face;
+          queue.push(Entry(distance, edge.to));
+        }
+      }
+    }
+  }
+
+  uint32_t
+  GetDistance(uint32_t v) const
+  {
+    return m_distances[v];
+  }
+
+  uint32_t
+  GetFirstHop(uint32_t v) const
+  {
+    return m_firstHops[v];
+  }
+
+private:
+  const RouterGraph& m_graph;
+  std::vector<uint32_t> m_distances;
+  std::vector<uint32_t> m_firstHops;
+};
+
+uint32_t g_nThreads = 0;
+
+/**
+ * @brief Run @p calculate for every source index on a pool of threads, and pass the routes
+ *        to @p consume on the calling thread in source order
+ *
+ * Each thread has its own ShortestPaths.  Threads run at most a few sources ahead of
+ * @p consume, which bounds the memory held by pending routes.  If @p calculate or @p consume
+ * throws, the threads are stopped and joined, and the exception is rethrown to the caller.
+ */
+void
+ForEachSource(const RouterGraph& graph, size_t nSources,
+              const std::function<void(size_t, ShortestPaths&,
+                                       std::vector<RouterGraph::Route>&)>& calculate,
+              const std::function<void(size_t, const std::vector<RouterGraph::Route>&)>& consume)
+{
+  size_t nThreads = g_nThreads != 0 ? g_nThreads : std::thread::hardware_concurrency();
+  nThreads = std::max<size_t>(1, std::min(nThreads, nSources));
+
+  if (nThreads == 1) {
+    ShortestPaths paths(graph);
+    std::vector<RouterGraph::Route> routes;
+    for (size_t i = 0; i < nSources; ++i) {
+      routes.clear();
+      calculate(i, paths, routes);
+      consume(i, routes);
+    }
+    return;
+  }
+
+  const size_t window = 4 * nThreads;
+  std::vector<std::vector<RouterGraph::Route>> results(nSources);
+  std::vector<uint8_t> isDone(nSources, 0);
+  size_t nStarted = 0;
+  size_t nConsumed = 0;
+  bool isStopped = false;
+  std::exception_ptr error; // first exception thrown by calculate
+  std::mutex mutex;
+  std::condition_variable cv;
+
+  auto work = [&] {
+    ShortestPaths paths(graph);
+    while (true) {
+      size_t i;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&] {
+          return isStopped || nStarted == nSources || nStarted < nConsumed + window;
+        });
+        if (isStopped || nStarted == nSources) {
+          return;
+        }
+        i = nStarted++;
+      }
+
+      std::vector<RouterGraph::Route> routes;
+      try {
+        calculate(i, paths, routes);
+      }
+      catch (...) {
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          if (error == nullptr) {
+            error = std::current_exception();
+          }
+          isStopped = true;
+        }
+        cv.notify_all();
+        return;
+      }
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        results[i].swap(routes);
+        isDone[i] = 1;
+      }
+      cv.notify_all();
+    }
+  };
+
+  // stops and joins the threads on every exit, including when calculate or consume throws,
+  // as destroying a joinable std::thread terminates the program
+  class ThreadsGuard
+  {
+  public:
+    ThreadsGuard(std::mutex& mutex, std::condition_variable& cv, bool& isStopped)
+      : m_mutex(mutex)
+      , m_cv(cv)
+      , m_isStopped(isStopped)
+    {
+    }
+
+    ~ThreadsGuard()
+    {
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isStopped = true;
+      }
+      m_cv.notify_all();
+
+      for (auto& thread : threads) {
+        thread.join();
+      }
+    }
+
+  public:
+    std::vector<std::thread> threads;
+
+  private:
+    std::mutex& m_mutex;
+    std::condition_variable& m_cv;
+    bool& m_isStopped;
+  } guard(mutex, cv, isStopped);
+
+  for (size_t t = 0; t < nThreads; ++t) {
+    guard.threads.push_back(std::thread(work));
+  }
+
+  for (size_t i = 0; i < nSources; ++i) {
+    std::vector<RouterGraph::Route> routes;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      cv.wait(lock, [&] { return isDone[i] != 0 || error != nullptr; });
+      if (isDone[i] == 0) {
+        std::rethrow_exception(error);
+      }
+      routes.swap(results[i]);
+      nConsumed = i + 1;
+    }
+    cv.notify_all();
+    consume(i, routes);
+  }
+}
+
+/**
+ * @brief Install routes of source @p i through @p onRoute
+ */
+void
+ReportRoutes(const RouterGraph& graph, size_t i, const std::vector<RouterGraph::Route>& routes,
+             const GlobalRoutingHelper::RouteCallback& onRoute)
+{
+  NS_LOG_DEBUG("Reachability from Node: " << graph.sourceNodes[i]->GetId() << " ("
+               << Names::FindName(graph.sourceNodes[i]) << ")");
+
+  for (const auto& route : routes) {
+    for (const auto& prefix : graph.routers[route.destination]->GetLocalPrefixes()) {
+      NS_LOG_DEBUG(" prefix " << *prefix << " reachable via face " << *graph.faces[route.face]
+                   << " with distance " << route.metric);
+
+      onRoute(graph.sourceNodes[i], *prefix, graph.faces[route.face], route.metric);
+    }
+  }
+}
+
+} // namespace
+
 void
 GlobalRoutingHelper::Install(Ptr<Node> node)
 {
@@ -215,175 +564,151 @@ GlobalRoutingHelper::AddOriginsForAll()
 }
 
 void
-GlobalRoutingHelper::CalculateRoutes()
+GlobalRoutingHelper::SetNumberOfThreads(uint32_t nThreads)
 {
-  /**
-   * Implementation of route calculation is heavily based on Boost Graph Library
-   * See http://www.boost.org/doc/libs/1_49_0/libs/graph/doc/table_of_contents.html for more details
-   */
-
-  BOOST_CONCEPT_ASSERT((boost::VertexListGraphConcept<boost::NdnGlobalRouterGraph>));
-  BOOST_CONCEPT_ASSERT((boost::IncidenceGraphConcept<boost::NdnGlobalRouterGraph>));
-
-  boost::NdnGlobalRouterGraph graph;
-  // typedef graph_traits < NdnGlobalRouterGraph >::vertex_descriptor vertex_descriptor;
-
-  // For now we doing Dijkstra for every node.  Can be replaced with Bellman-Ford or Floyd-Warshall.
-  // Other algorithms should be faster, but they need additional EdgeListGraph concept provided by
-  // the graph, which
-  // is not obviously how implement in an efficient manner
-  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
-    Ptr<GlobalRouter> source = (*node)->GetObject<GlobalRouter>();
-    if (source == 0) {
-      NS_LOG_DEBUG("Node " << (*node)->GetId() << " does not export GlobalRouter interface");
-      continue;
-    }
-
-    boost::DistancesMap distances;
+  g_nThreads = nThreads;
+}
 
-    dijkstra_shortest_paths(graph, source,
-                            // predecessor_map (boost::ref(predecessors))
-                            // .
-                            distance_map(boost::ref(distances))
-                              .distance_inf(boost::WeightInf)
-                              .distance_zero(boost::WeightZero)
-                              .distance_compare(boost::WeightCompare())
-                              .distance_combine(boost::WeightCombine()));
+void
+GlobalRoutingHelper::CalculateRoutes()
+{
+  CalculateRoutes([] (Ptr<Node> node, const Name& prefix, shared_ptr<Face> face, int32_t metric) {
+      FibHelper::AddRoute(node, prefix, face, metric);
+    });
+}
 
-    // NS_LOG_DEBUG (predecessors.size () << ", " << distances.size ());
+void
+GlobalRoutingHelper::CalculateRoutes(const RouteCallback& onRoute)
+{
+  RouterGraph graph;
 
-    Ptr<L3Protocol> L3protocol = (*node)->GetObject<L3Protocol>();
-    shared_ptr<nfd::Forwarder> forwarder = L3protocol->getForwarder();
+  ForEachSource(graph, graph.sources.size(),
+    [&graph] (size_t i, ShortestPaths& paths, std::vector<RouterGraph::Route>& routes) {
+      uint32_t source = graph.sources[i];
+      paths.Compute(source);
 
-    NS_LOG_DEBUG("Reachability from Node: " << source->GetObject<Node>()->GetId());
-    for (const auto& dist : distances) {
-      if (dist.first == source)
-        continue;
-      else {
-        // cout << "  Node " << dist.first->GetObject<Node> ()->GetId ();
-        if (std::get<0>(dist.second) == 0) {
-          // cout << " is unreachable" << endl;
-        }
-        else {
-          for (const auto& prefix : dist.first->GetLocalPrefixes()) {
-            NS_LOG_DEBUG(" prefix " << prefix << " reachable via face " << *std::get<0>(dist.second)
-                         << " with distance " << std::get<1>(dist.second) << " with delay "
-                         << std::get<2>(dist.second));
-
-            FibHelper::AddRoute(*node, *prefix, std::get<0>(dist.second),
-                                std::get<1>(dist.second));
-          }
+      for (uint32_t destination : graph.destinations) {
+        if (destination == source || paths.GetFirstHop(destination) == RouterGraph::NO_FACE) {
+          continue; // unreachable
         }
+        routes.push_back({destination, paths.GetFirstHop(destination),
+                          paths.GetDistance(destination)});
       }
-    }
-  }
+    },
+    [&graph, &onRoute] (size_t i, const std::vector<RouterGraph::Route>& routes) {
+      ReportRoutes(graph, i, routes, onRoute);
+    });
 }
 
 void
 GlobalRoutingHelper::CalculateAllPossibleRoutes()
 {
-  /**
-   * Implementation of route calculation is heavily based on Boost Graph Library
-   * See http://www.boost.org/doc/libs/1_49_0/libs/graph/doc/table_of_contents.html for more details
-   */
-
-  BOOST_CONCEPT_ASSERT((boost::VertexListGraphConcept<boost::NdnGlobalRouterGraph>));
-  BOOST_CONCEPT_ASSERT((boost::IncidenceGraphConcept<boost::NdnGlobalRouterGraph>));
-
-  boost::NdnGlobalRouterGraph graph;
-  // typedef graph_traits < NdnGlobalRouterGraph >::vertex_descriptor vertex_descriptor;
-
-  // For now we doing Dijkstra for every node.  Can be replaced with Bellman-Ford or Floyd-Warshall.
-  // Other algorithms should be faster, but they need additional EdgeListGraph concept provided by
-  // the graph, which
-  // is not obviously how implement in an efficient manner
-  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
-    Ptr<GlobalRouter> source = (*node)->GetObject<GlobalRouter>();
-    if (source == 0) {
-      NS_LOG_DEBUG("Node " << (*node)->GetId() << " does not export GlobalRouter interface");
-      continue;
-    }
-
-    Ptr<L3Protocol> L3protocol = (*node)->GetObject<L3Protocol>();
-    shared_ptr<nfd::Forwarder> forwarder = L3protocol->getForwarder();
+  CalculateAllPossibleRoutes([] (Ptr<Node> node, const Name& prefix, shared_ptr<Face> face,
+                                 int32_t metric) {
+      FibHelper::AddRoute(node, prefix, face, metric);
+    });
+}
 
-    NS_LOG_DEBUG("Reachability from Node: " << source->GetObject<Node>()->GetId() << " ("
-                                            << Names::FindName(source->GetObject<Node>()) << ")");
+void
+GlobalRoutingHelper::CalculateAllPossibleRoutes(const RouteCallback& onRoute)
+{
+  RouterGraph graph;
 
-    Ptr<L3Protocol> l3 = source->GetObject<L3Protocol>();
-    NS_ASSERT(l3 != 0);
+  // For every face of the source, shortest paths that leave the source only through that face
+  // (previously emulated by setting metrics of all other faces to "almost infinity")
+  ForEachSource(graph, graph.sources.size(),
+    [&graph] (size_t i, ShortestPaths& paths, std::vector<RouterGraph::Route>& routes) {
+      uint32_t source = graph.sources[i];
 
-    // remember interface statuses
-    std::list<nfd::FaceId> faceIds;
-    std::unordered_map<nfd::FaceId, uint16_t> originalMetrics;
-    for (auto& i : l3->getForwarder()->getFaceTable()) {
-      shared_ptr<Face> nfdFace = std::dynamic_pointer_cast<Face>(i);
-      faceIds.push_back(nfdFace->getId());
-      originalMetrics[nfdFace->getId()] = nfdFace->getMetric();
-      nfdFace->setMetric(std::numeric_limits<uint16_t>::max() - 1);
-      // value std::numeric_limits<uint16_t>::max () MUST NOT be used (reserved)
-    }
+      for (uint32_t e = graph.offsets[source]; e < graph.offsets[source + 1]; ++e) {
+        if (graph.edges[e].face == RouterGraph::NO_FACE) {
+          continue;
+        }
+        paths.Compute(source, e);
 
-    for (auto& faceId : faceIds) {
-      shared_ptr<Face> face = l3->getForwarder()->getFaceTable().get(faceId);
-      auto linkService = dynamic_cast<NetDeviceLinkService*>(face->getLinkService());
-      if (linkService == nullptr) {
-        NS_LOG_DEBUG("Skipping non-netdevice face");
-        continue;
+        for (uint32_t destination : graph.destinations) {
+          if (destination == source || paths.GetFirstHop(destination) == RouterGraph::NO_FACE) {
+            continue; // unreachable through this face
+          }
+          routes.push_back({destination, graph.edges[e].face, paths.GetDistance(destination)});
+        }
       }
+    },
+    [&graph, &onRoute] (size_t i, const std::vector<RouterGraph::Route>& routes) {
+      ReportRoutes(graph, i, routes, onRoute);
+    });
+}
 
-      // enabling only faceId
-      face->setMetric(originalMetrics[faceId]);
-
-      boost::DistancesMap distances;
-
-      NS_LOG_DEBUG("-----------");
+void
+GlobalRoutingHelper::CalculateLoopFreeAlternateRoutes()
+{
+  CalculateLoopFreeAlternateRoutes([] (Ptr<Node> node, const Name& prefix,
+                                       shared_ptr<Face> face, int32_t metric) {
+      FibHelper::AddRoute(node, prefix, face, metric);
+    });
+}
 
-      dijkstra_shortest_paths(graph, source,
-                              // predecessor_map (boost::ref(predecessors))
-                              // .
-                              distance_map(boost::ref(distances))
-                                .distance_inf(boost::WeightInf)
-                                .distance_zero(boost::WeightZero)
-                                .distance_compare(boost::WeightCompare())
-                                .distance_combine(boost::WeightCombine()));
+void
+GlobalRoutingHelper::CalculateLoopFreeAlternateRoutes(const RouteCallback& onRoute)
+{
+  RouterGraph graph;
+  const size_t nVertices = graph.routers.size();
+  const size_t nDestinations = graph.destinations.size();
+  if (nDestinations == 0) {
+    return;
+  }
 
-      // NS_LOG_DEBUG (predecessors.size () << ", " << distances.size ());
+  // One shortest path tree per vertex: distances to all destinations, and distance from the
+  // head of each edge back to its tail
+  std::vector<uint32_t> distances(nVertices * nDestinations);
+  std::vector<uint32_t> backDistances(graph.edges.size(), RouterGraph::INF);
 
-      for (const auto& dist : distances) {
-        if (dist.first == source)
+  ForEachSource(graph, nVertices,
+    [&] (size_t v, ShortestPaths& paths, std::vector<RouterGraph::Route>&) {
+      paths.Compute(v);
+      for (size_t t = 0; t < nDestinations; ++t) {
+        distances[v * nDestinations + t] = paths.GetDistance(graph.destinations[t]);
+      }
+      for (uint32_t e = graph.offsets[v]; e < graph.offsets[v + 1]; ++e) {
+        if (graph.reverse[e] != RouterGraph::NO_EDGE) {
+          backDistances[graph.reverse[e]] = paths.GetDistance(graph.edges[e].to);
+        }
+      }
+    },
+    [] (size_t, const std::vector<RouterGraph::Route>&) {
+    });
+
+  // A neighbor is an alternative next hop when its shortest path does not come back through
+  // the source: dist(neighbor, t) < dist(neighbor, source) + dist(source, t)
+  ForEachSource(graph, graph.sources.size(),
+    [&] (size_t i, ShortestPaths&, std::vector<RouterGraph::Route>& routes) {
+      uint32_t source = graph.sources[i];
+      const uint32_t* fromSource = &distances[source * nDestinations];
+
+      for (uint32_t e = graph.offsets[source]; e < graph.offsets[source + 1]; ++e) {
+        const RouterGraph::Edge& edge = graph.edges[e];
+        if (edge.face == RouterGraph::NO_FACE) {
           continue;
-        else {
-          // cout << "  Node " << dist.first->GetObject<Node> ()->GetId ();
-          if (std::get<0>(dist.second) == 0) {
-            // cout << " is unreachable" << endl;
+        }
+        const uint32_t* fromNeighbor = &distances[edge.to * nDestinations];
+
+        for (size_t t = 0; t < nDestinations; ++t) {
+          uint32_t destination = graph.destinations[t];
+          uint32_t metric = edge.metric + fromNeighbor[t];
+          if (destination == source || metric >= RouterGraph::INF) {
+            continue;
           }
-          else {
-            for (const auto& prefix : dist.first->GetLocalPrefixes()) {
-              NS_LOG_DEBUG(" prefix " << *prefix << " reachable via face "
-                           << *std::get<0>(dist.second)
-                           << " with distance " << std::get<1>(dist.second)
-                           << " with delay " << std::get<2>(dist.second));
-
-              if (std::get<0>(dist.second)->getMetric() == std::numeric_limits<uint16_t>::max() - 1)
-                continue;
-
-              FibHelper::AddRoute(*node, *prefix, std::get<0>(dist.second),
-                                  std::get<1>(dist.second));
-            }
+          if (destination != edge.to &&
+              fromNeighbor[t] >= uint64_t(backDistances[e]) + fromSource[t]) {
+            continue; // may loop back through the source
           }
+          routes.push_back({destination, edge.face, metric});
         }
       }
-
-      // disabling the face again
-      face->setMetric(std::numeric_limits<uint16_t>::max() - 1);
-    }
-
-    // recover original interface statuses
-    for (auto& i : originalMetrics) {
-      l3->getForwarder()->getFaceTable().get(i.first)->setMetric(i.second);
-    }
-  }
+    },
+    [&graph, &onRoute] (size_t i, const std::vector<RouterGraph::Route>& routes) {
+      ReportRoutes(graph, i, routes, onRoute);
+    });
 }
 
 } // namespace ndn
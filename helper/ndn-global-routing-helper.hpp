@@ -38,6 +38,14 @@ namespace ndn {
  */
 class GlobalRoutingHelper {
 public:
+  /**
+   * @brief Callback receiving each route found by route calculation
+   *
+   * Arguments are the node, the prefix, the node's outgoing face, and the path metric.
+   */
+  typedef std::function<void(Ptr<Node> node, const Name& prefix, shared_ptr<Face> face,
+                             int32_t metric)> RouteCallback;
+
   /**
    * @brief Install GlobalRouter interface on a node
    *
@@ -94,23 +102,75 @@ public:
   void
   AddOriginsForAll();
 
+  /**
+   * @brief Set number of threads used for route calculation
+   *
+   * Shortest path trees of different nodes are computed concurrently on a snapshot of the
+   * GlobalRouter graph.  Routes are always installed (or reported) on the calling thread,
+   * node by node in NodeList order, so the result does not depend on the number of threads.
+   *
+   * @param nThreads number of threads, 0 (default) for one per hardware thread
+   */
+  static void
+  SetNumberOfThreads(uint32_t nThreads);
+
   /**
    * @brief Calculate for every node shortest path trees and install routes to all prefix origins
    */
   static void
   CalculateRoutes();
 
+  /**
+   * @brief Calculate for every node shortest path trees and report routes to all prefix origins
+   *
+   * Same as CalculateRoutes(), but routes are passed to @p onRoute instead of being installed
+   * into FIBs, e.g., to use global routing as an oracle for a dynamic routing protocol.
+   */
+  static void
+  CalculateRoutes(const RouteCallback& onRoute);
+
   /**
    * @brief Calculate all possible next-hop independent alternative routes
    *
-   * Refer to the implementation for more details.
+   * For every face of a node, the shortest paths leaving the node through that face are
+   * calculated, i.e., one shortest path tree per face.
    *
-   * Note that this method is highly experimental and should be used with caution (very time
-   *consuming).
+   * Note that this method is very time consuming on large topologies;
+   * CalculateLoopFreeAlternateRoutes() needs one shortest path tree per node.
    */
   static void
   CalculateAllPossibleRoutes();
 
+  /**
+   * @brief Calculate all possible next-hop independent alternative routes and report them
+   *
+   * Same as CalculateAllPossibleRoutes(), but routes are passed to @p onRoute instead of being
+   * installed into FIBs.
+   */
+  static void
+  CalculateAllPossibleRoutes(const RouteCallback& onRoute);
+
+  /**
+   * @brief Calculate shortest path routes through every loop-free neighbor
+   *
+   * A route to a prefix origin t is installed on node s through the face towards neighbor n
+   * when the shortest path from n to t does not come back through s
+   * (dist(n, t) < dist(n, s) + dist(s, t)), with metric of the face plus dist(n, t).
+   *
+   * Reuses one shortest path tree per node instead of one per face.  Unlike
+   * CalculateAllPossibleRoutes(), it omits alternatives whose neighbor's shortest path goes
+   * through s, even when a longer detour avoiding s exists.  Keeps a table of distances from
+   * all nodes to all prefix origins (4 bytes per pair).
+   */
+  static void
+  CalculateLoopFreeAlternateRoutes();
+
+  /**
+   * @brief Same as CalculateLoopFreeAlternateRoutes(), but routes are passed to @p onRoute
+   */
+  static void
+  CalculateLoopFreeAlternateRoutes(const RouteCallback& onRoute);
+
 private:
   void
   Install(Ptr<Channel> channel);
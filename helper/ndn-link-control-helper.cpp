@@ -30,9 +30,11 @@
 #include "ns3/boolean.h"
 #include "ns3/double.h"
 #include "ns3/pointer.h"
+#include "ns3/simulator.h"
 
 #include "model/ndn-l3-protocol.hpp"
 #include "model/ndn-net-device-link-service.hpp"
+#include "model/null-transport.hpp"
 #include "NFD/daemon/face/face.hpp"
 
 #include "fw/forwarder.hpp"
@@ -85,12 +87,38 @@ LinkControlHelper::setErrorRate(Ptr<Node> node1, Ptr<Node> node2, double errorRa
 
       nd1->SetAttribute("ReceiveErrorModel", PointerValue(errorFactory.Create<ErrorModel>()));
       nd2->SetAttribute("ReceiveErrorModel", PointerValue(errorFactory.Create<ErrorModel>()));
+
+      // faces change state in the context of their node, as NFD of that node notifies it
+      bool isUp = errorRate <= 0;
+      Simulator::ScheduleWithContext(node1->GetId(), Seconds(0), &LinkControlHelper::setFaceLinkUp,
+                                     node1, nd1, isUp);
+      Simulator::ScheduleWithContext(node2->GetId(), Seconds(0), &LinkControlHelper::setFaceLinkUp,
+                                     node2, nd2, isUp);
       return;
     }
   }
   NS_FATAL_ERROR("There is no link to fail between the requested nodes");
 }
 
+void
+LinkControlHelper::setFaceLinkUp(Ptr<Node> node, Ptr<NetDevice> netDevice, bool isUp)
+{
+  NS_LOG_FUNCTION(node << netDevice << isUp);
+
+  Ptr<ndn::L3Protocol> ndn = node->GetObject<ndn::L3Protocol>();
+  for (const auto& face : ndn->getForwarder()->getFaceTable()) {
+    auto linkService = dynamic_cast<NetDeviceLinkService*>(face->getLinkService());
+    if (linkService == nullptr || linkService->GetNetDevice() != netDevice)
+      continue;
+
+    auto transport = dynamic_cast<NullTransport*>(face->getTransport());
+    if (transport != nullptr) {
+      transport->setLinkUp(isUp);
+    }
+    return;
+  }
+}
+
 void
 LinkControlHelper::FailLink(Ptr<Node> node1, Ptr<Node> node2)
 {
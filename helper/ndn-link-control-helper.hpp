@@ -24,6 +24,7 @@
 
 #include "ns3/ptr.h"
 #include "ns3/node.h"
+#include "ns3/net-device.h"
 
 namespace ns3 {
 namespace ndn {
@@ -98,6 +99,15 @@ public:
 private:
   static void
   setErrorRate(Ptr<Node> node1, Ptr<Node> node2, double errorRate);
+
+  /**
+   * @brief Set the NDN face of @p netDevice on @p node UP or DOWN
+   *
+   * NFD notifies the change as a face event, so applications such as NLSR learn about the
+   * link state right away, instead of after timeouts
+   */
+  static void
+  setFaceLinkUp(Ptr<Node> node, Ptr<NetDevice> netDevice, bool isUp);
 }; // LinkControlHelper
 
 } // ndn
@@ -31,6 +31,9 @@
 #include "utils/ndn-time.hpp"
 #include "utils/dummy-keychain.hpp"
 #include "model/cs/ndn-content-store.hpp"
+#include "model/cs/ndn-cs-policy-probability.hpp"
+#include "model/cs/ndn-cs-policy-freshness.hpp"
+#include "model/cs/ndn-cs-policy-lifetime-stats.hpp"
 
 #include <limits>
 #include <map>
@@ -51,8 +54,10 @@ StackHelper::StackHelper()
   // , m_isFaceManagerDisabled(false)
   , m_isForwarderStatusManagerDisabled(false)
   , m_isStrategyChoiceManagerDisabled(false)
+  , m_isFixedStrategyDispatchEnabled(false)
   , m_needSetDefaultRoutes(false)
   , m_maxCsSize(100)
+  , m_csCacheProbability(1.0)
 {
   setCustomNdnCxxClocks();
 
@@ -60,6 +65,20 @@ StackHelper::StackHelper()
   m_csPolicies.insert({"nfd::cs::lru", [] { return make_unique<nfd::cs::LruPolicy>(); }});
   m_csPolicies.insert({"nfd::cs::priority_fifo", [] () { return make_unique<nfd::cs::PriorityFifoPolicy>(); }});
 
+  // ndnSIM policies, on top of each of NFD's policies (e.g., nfd::cs::freshness::lru)
+  for (const std::string& base : {"lru", "priority_fifo"}) {
+    PolicyCreationCallback createBase = m_csPolicies["nfd::cs::" + base];
+    m_csPolicies.insert({"nfd::cs::probability::" + base, [this, createBase] {
+          return make_unique<cs::ProbabilityPolicy>(createBase(), m_csCacheProbability);
+        }});
+    m_csPolicies.insert({"nfd::cs::freshness::" + base, [createBase] {
+          return make_unique<cs::FreshnessPolicy>(createBase());
+        }});
+    m_csPolicies.insert({"nfd::cs::lifetime_stats::" + base, [createBase] {
+          return make_unique<cs::LifetimeStatsPolicy>(createBase());
+        }});
+  }
+
   m_csPolicyCreationFunc = m_csPolicies["nfd::cs::lru"];
   //ymz ncc
 
@@ -139,6 +158,12 @@ StackHelper::setCsSize(size_t maxSize)
   m_maxCsSize = maxSize;
 }
 
+void
+StackHelper::setCacheProbability(double probability)
+{
+  m_csCacheProbability = probability;
+}
+
 //ymz ncc
 void
 StackHelper::setPolicy(const std::string& policy)
@@ -202,6 +227,10 @@ StackHelper::Install(Ptr<Node> node) const
     ndn->getConfig().put("ndnSIM.disable_strategy_choice_manager", true);
   }
 
+  if (m_isFixedStrategyDispatchEnabled) {
+    ndn->getConfig().put("ndnSIM.fixed_strategy_dispatch", true);
+  }
+
   ndn->getConfig().put("tables.cs_max_packets", (m_maxCsSize == 0) ? 1 : m_maxCsSize);
 
   // Create and aggregate content store if NFD's contest store has been disabled
@@ -417,5 +446,11 @@ StackHelper::disableForwarderStatusManager()
   m_isForwarderStatusManagerDisabled = true;
 }
 
+void
+StackHelper::enableFixedStrategyDispatch()
+{
+  m_isFixedStrategyDispatchEnabled = true;
+}
+
 } // namespace ndn
 } // namespace ns3
@@ -82,9 +82,20 @@ public:
   void
   setCsSize(size_t maxSize);
 
+  /**
+   * @brief Set the probability to cache new Data packets, for nfd::cs::probability::* policies
+   */
+  void
+  setCacheProbability(double probability);
+
   //ymz ncc
   /**
    * @brief Set the cache replacement policy for NFD's Content Store
+   *
+   * Available policies are NFD's nfd::cs::lru and nfd::cs::priority_fifo, and the ndnSIM
+   * policies nfd::cs::probability::<base>, nfd::cs::freshness::<base> and
+   * nfd::cs::lifetime_stats::<base> (see docs/source/cs.rst), where <base> is the NFD policy
+   * deciding evictions.
    */
   void
   setPolicy(const std::string& policy);
@@ -95,6 +106,8 @@ public:
    * @param contentStoreClass string, representing class of the content store
    * @note ndnSIM 1.0 content store implementation have limited support for Interest selectors
    *       Do not use these implementations if your scenario relies on proper selector processing.
+   * @note Kept for compatibility: Probability, Freshness and Stats content stores have
+   *       counterparts among the policies of NFD's Content Store (see setPolicy)
    */
   void
   SetOldContentStore(const std::string& contentStoreClass, const std::string& attr1 = "",
@@ -252,6 +265,16 @@ public:
   void
   disableForwarderStatusManager();
 
+  /**
+   * \brief Enable fixed strategy dispatch in NFD's forwarder
+   *
+   * Intended for scenarios that choose forwarding strategies at startup: the effective
+   * strategy is looked up once per PIT entry, and best-route, multicast, and ncc strategies
+   * are invoked without virtual calls (see nfd::Forwarder::setFixedStrategyDispatch)
+   */
+  void
+  enableFixedStrategyDispatch();
+
 private:
   shared_ptr<Face>
   DefaultNetDeviceCallback(Ptr<Node> node, Ptr<L3Protocol> ndn, Ptr<NetDevice> netDevice) const;
@@ -266,6 +289,7 @@ private:
   // bool m_isFaceManagerDisabled;
   bool m_isForwarderStatusManagerDisabled;
   bool m_isStrategyChoiceManagerDisabled;
+  bool m_isFixedStrategyDispatchEnabled;
 
 public:
   void
@@ -277,6 +301,7 @@ private:
 
   bool m_needSetDefaultRoutes;
   size_t m_maxCsSize;
+  double m_csCacheProbability;
 
   //ymz ncc
   typedef std::function<std::unique_ptr<nfd::cs::Policy>()> PolicyCreationCallback;
@@ -23,6 +23,8 @@
 #include "../../utils/trie/lru-policy.hpp"
 #include "../../utils/trie/fifo-policy.hpp"
 #include "../../utils/trie/lfu-policy.hpp"
+#include "../../utils/trie/bucket-lfu-policy.hpp"
+#include "../../utils/trie/tiny-lfu-policy.hpp"
 #include "../../utils/trie/multi-policy.hpp"
 #include "../../utils/trie/aggregate-stats-policy.hpp"
 
@@ -63,10 +65,22 @@ template class ContentStoreImpl<fifo_policy_traits>;
  **/
 template class ContentStoreImpl<lfu_policy_traits>;
 
+/**
+ * @brief ContentStore with LFU cache replacement policy, updated in constant time on hits
+ **/
+template class ContentStoreImpl<bucket_lfu_policy_traits>;
+
+/**
+ * @brief ContentStore with W-TinyLFU cache admission and replacement policy
+ **/
+template class ContentStoreImpl<tiny_lfu_policy_traits>;
+
 NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreImpl, lru_policy_traits);
 NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreImpl, random_policy_traits);
 NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreImpl, fifo_policy_traits);
 NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreImpl, lfu_policy_traits);
+NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreImpl, bucket_lfu_policy_traits);
+NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreImpl, tiny_lfu_policy_traits);
 
 typedef multi_policy_traits<boost::mpl::vector2<lru_policy_traits, aggregate_stats_policy_traits>>
   LruWithCountsTraits;
@@ -77,6 +91,12 @@ typedef multi_policy_traits<boost::mpl::vector2<fifo_policy_traits, aggregate_st
   FifoWithCountsTraits;
 typedef multi_policy_traits<boost::mpl::vector2<lfu_policy_traits, aggregate_stats_policy_traits>>
   LfuWithCountsTraits;
+typedef multi_policy_traits<boost::mpl::vector2<bucket_lfu_policy_traits,
+                                                aggregate_stats_policy_traits>>
+  BucketLfuWithCountsTraits;
+typedef multi_policy_traits<boost::mpl::vector2<tiny_lfu_policy_traits,
+                                                aggregate_stats_policy_traits>>
+  TinyLfuWithCountsTraits;
 
 template class ContentStoreImpl<LruWithCountsTraits>;
 NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreImpl, LruWithCountsTraits);
@@ -90,6 +110,12 @@ NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreImpl, FifoWithCountsTraits);
 template class ContentStoreImpl<LfuWithCountsTraits>;
 NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreImpl, LfuWithCountsTraits);
 
+template class ContentStoreImpl<BucketLfuWithCountsTraits>;
+NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreImpl, BucketLfuWithCountsTraits);
+
+template class ContentStoreImpl<TinyLfuWithCountsTraits>;
+NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreImpl, TinyLfuWithCountsTraits);
+
 #ifdef DOXYGEN
 // /**
 //  * \brief Content Store implementing LRU cache replacement policy
@@ -114,6 +140,19 @@ class Random : public ContentStoreImpl<random_policy_traits> {
  */
 class Lfu : public ContentStoreImpl<lfu_policy_traits> {
 };
+
+/**
+ * \brief Content Store implementing Least Frequently Used cache replacement policy, with
+ *        constant-time updates on cache hits
+ */
+class BucketLfu : public ContentStoreImpl<bucket_lfu_policy_traits> {
+};
+
+/**
+ * \brief Content Store implementing W-TinyLFU cache admission and replacement policy
+ */
+class TinyLfu : public ContentStoreImpl<tiny_lfu_policy_traits> {
+};
 #endif
 
 } // namespace cs
@@ -49,7 +49,7 @@ Nocache::~Nocache()
 {
 }
 
-shared_ptr<Data>
+shared_ptr<const Data>
 Nocache::Lookup(shared_ptr<const Interest> interest)
 {
   this->m_cacheMissesTrace(interest);
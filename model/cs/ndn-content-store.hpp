@@ -119,8 +119,10 @@ public:
    *
    * If an entry is found, it is promoted to the top of most recent
    * used entries index, \see m_contentStore
+   *
+   * The returned Data is the cached one, shared with the content store rather than copied
    */
-  virtual shared_ptr<Data>
+  virtual shared_ptr<const Data>
   Lookup(shared_ptr<const Interest> interest) = 0;
 
   /**
@@ -0,0 +1,90 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-cs-policy-decorator.hpp"
+
+#include "ns3/ndnSIM/NFD/daemon/table/cs.hpp"
+
+namespace ns3 {
+namespace ndn {
+namespace cs {
+
+PolicyDecorator::PolicyDecorator(const std::string& policyName,
+                                 std::unique_ptr<nfd::cs::Policy> policy)
+  : nfd::cs::Policy(policyName)
+  , m_policy(std::move(policy))
+{
+  BOOST_ASSERT(m_policy != nullptr);
+  m_beforeEvictConnection = m_policy->beforeEvict.connect([this] (nfd::cs::iterator i) {
+      this->beforeRemove(i);
+      this->emitSignal(beforeEvict, i);
+    });
+}
+
+void
+PolicyDecorator::doAfterInsert(nfd::cs::iterator i)
+{
+  m_policy->afterInsert(i);
+}
+
+void
+PolicyDecorator::doAfterRefresh(nfd::cs::iterator i)
+{
+  m_policy->afterRefresh(i);
+}
+
+void
+PolicyDecorator::doBeforeErase(nfd::cs::iterator i)
+{
+  this->beforeRemove(i);
+  m_policy->beforeErase(i);
+}
+
+void
+PolicyDecorator::doBeforeUse(nfd::cs::iterator i)
+{
+  m_policy->beforeUse(i);
+}
+
+void
+PolicyDecorator::evictEntries()
+{
+  // CS sets the limit of its policy after attaching it, which brings the decorated policy
+  // to the same content store and limit
+  BOOST_ASSERT(this->getCs() != nullptr);
+  m_policy->setCs(this->getCs());
+  m_policy->setLimit(this->getLimit());
+}
+
+void
+PolicyDecorator::beforeRemove(nfd::cs::iterator i)
+{
+}
+
+void
+PolicyDecorator::evict(nfd::cs::iterator i)
+{
+  this->beforeRemove(i);
+  m_policy->beforeErase(i);
+  this->emitSignal(beforeEvict, i);
+}
+
+} // namespace cs
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,92 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDNSIM_MODEL_CS_NDN_CS_POLICY_DECORATOR_HPP
+#define NDNSIM_MODEL_CS_NDN_CS_POLICY_DECORATOR_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ns3/ndnSIM/NFD/daemon/table/cs-policy.hpp"
+
+namespace ns3 {
+namespace ndn {
+namespace cs {
+
+/**
+ * @ingroup ndn-cs
+ * @brief Base class of ndnSIM policies for NFD's content store, adding a behavior to another
+ *        policy
+ *
+ * The decorated policy (e.g., nfd::cs::LruPolicy) decides which entries are evicted when the
+ * content store is full.  The decorator can refuse new entries, evict entries on its own or
+ * observe the removal of entries, as the policies of ndnSIM 1.0 content stores did.
+ */
+class PolicyDecorator : public nfd::cs::Policy {
+public:
+  PolicyDecorator(const std::string& policyName, std::unique_ptr<nfd::cs::Policy> policy);
+
+  /**
+   * @brief Get the decorated policy
+   */
+  nfd::cs::Policy&
+  getDecoratedPolicy() const
+  {
+    return *m_policy;
+  }
+
+protected:
+  // from nfd::cs::Policy, forwarded to the decorated policy
+  virtual void
+  doAfterInsert(nfd::cs::iterator i) override;
+
+  virtual void
+  doAfterRefresh(nfd::cs::iterator i) override;
+
+  virtual void
+  doBeforeErase(nfd::cs::iterator i) override;
+
+  virtual void
+  doBeforeUse(nfd::cs::iterator i) override;
+
+  virtual void
+  evictEntries() override;
+
+  /**
+   * @brief Invoked before an entry accepted by the decorated policy leaves the content store,
+   *        whether it is evicted by either policy or erased by a management command
+   */
+  virtual void
+  beforeRemove(nfd::cs::iterator i);
+
+  /**
+   * @brief Evict an entry accepted by the decorated policy, e.g., an expired one
+   */
+  void
+  evict(nfd::cs::iterator i);
+
+private:
+  std::unique_ptr<nfd::cs::Policy> m_policy;
+  ::ndn::util::signal::ScopedConnection m_beforeEvictConnection;
+};
+
+} // namespace cs
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDNSIM_MODEL_CS_NDN_CS_POLICY_DECORATOR_HPP
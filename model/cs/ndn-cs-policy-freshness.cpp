@@ -0,0 +1,114 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-cs-policy-freshness.hpp"
+
+#include "ns3/ndnSIM/NFD/daemon/table/cs-entry-impl.hpp"
+
+#include "ns3/log.h"
+
+NS_LOG_COMPONENT_DEFINE("ndn.cs.FreshnessPolicy");
+
+namespace ns3 {
+namespace ndn {
+namespace cs {
+
+const std::string FreshnessPolicy::POLICY_NAME = "freshness";
+
+FreshnessPolicy::FreshnessPolicy(std::unique_ptr<nfd::cs::Policy> policy)
+  : PolicyDecorator(POLICY_NAME, std::move(policy))
+  , m_scheduledCleaningTime(time::steady_clock::TimePoint::max())
+{
+}
+
+void
+FreshnessPolicy::doAfterInsert(nfd::cs::iterator i)
+{
+  // must be tracked before the decorated policy gets a chance to evict the entry
+  this->insertToQueue(i);
+  PolicyDecorator::doAfterInsert(i);
+  this->rescheduleCleaning();
+}
+
+void
+FreshnessPolicy::doAfterRefresh(nfd::cs::iterator i)
+{
+  // CS has updated the stale time of the entry
+  this->beforeRemove(i);
+  this->insertToQueue(i);
+  PolicyDecorator::doAfterRefresh(i);
+  this->rescheduleCleaning();
+}
+
+void
+FreshnessPolicy::beforeRemove(nfd::cs::iterator i)
+{
+  auto found = m_queueIts.find(&*i);
+  if (found != m_queueIts.end()) {
+    m_queue.erase(found->second);
+    m_queueIts.erase(found);
+  }
+}
+
+void
+FreshnessPolicy::insertToQueue(nfd::cs::iterator i)
+{
+  if (i->getData().getFreshnessPeriod() > time::milliseconds::zero()) {
+    m_queueIts[&*i] = m_queue.insert({i->getStaleTime(), i});
+  }
+}
+
+void
+FreshnessPolicy::cleanExpired()
+{
+  m_scheduledCleaningTime = time::steady_clock::TimePoint::max();
+
+  time::steady_clock::TimePoint now = time::steady_clock::now();
+  while (!m_queue.empty() && m_queue.begin()->first <= now) {
+    nfd::cs::iterator i = m_queue.begin()->second;
+    NS_LOG_DEBUG("Removing expired " << i->getName());
+    this->evict(i);
+  }
+
+  this->rescheduleCleaning();
+}
+
+void
+FreshnessPolicy::rescheduleCleaning()
+{
+  if (m_queue.empty()) {
+    m_cleanEvent.cancel();
+    m_scheduledCleaningTime = time::steady_clock::TimePoint::max();
+    return;
+  }
+
+  time::steady_clock::TimePoint nextExpiry = m_queue.begin()->first;
+  if (nextExpiry == m_scheduledCleaningTime) {
+    return;
+  }
+
+  m_scheduledCleaningTime = nextExpiry;
+  m_cleanEvent = nfd::scheduler::schedule(std::max(nextExpiry - time::steady_clock::now(),
+                                                   time::steady_clock::Duration::zero()),
+                                          [this] { this->cleanExpired(); });
+}
+
+} // namespace cs
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,92 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDNSIM_MODEL_CS_NDN_CS_POLICY_FRESHNESS_HPP
+#define NDNSIM_MODEL_CS_NDN_CS_POLICY_FRESHNESS_HPP
+
+#include "ndn-cs-policy-decorator.hpp"
+
+#include "ns3/ndnSIM/NFD/core/scheduler.hpp"
+
+#include <map>
+#include <unordered_map>
+
+namespace ns3 {
+namespace ndn {
+namespace cs {
+
+/**
+ * @ingroup ndn-cs
+ * @brief Policy for NFD's content store that removes Data packets as soon as their
+ *        FreshnessPeriod expires, and leaves eviction of other entries to the decorated policy
+ *
+ * Counterpart of ndnSIM 1.0 ns3::ndn::cs::Freshness content stores.  Data packets without
+ * FreshnessPeriod never expire.  A single scheduled event removes the entries that expire first.
+ */
+class FreshnessPolicy : public PolicyDecorator {
+public:
+  explicit
+  FreshnessPolicy(std::unique_ptr<nfd::cs::Policy> policy);
+
+public:
+  static const std::string POLICY_NAME;
+
+protected:
+  virtual void
+  doAfterInsert(nfd::cs::iterator i) override;
+
+  virtual void
+  doAfterRefresh(nfd::cs::iterator i) override;
+
+  virtual void
+  beforeRemove(nfd::cs::iterator i) override;
+
+private:
+  /**
+   * @brief Start tracking the stale time of an entry, if it has one
+   */
+  void
+  insertToQueue(nfd::cs::iterator i);
+
+  /**
+   * @brief Remove expired entries and schedule the next cleaning
+   */
+  void
+  cleanExpired();
+
+  /**
+   * @brief Schedule the cleaning at the earliest stale time, unless already scheduled then
+   */
+  void
+  rescheduleCleaning();
+
+private:
+  typedef std::multimap<time::steady_clock::TimePoint, nfd::cs::iterator> Queue;
+  Queue m_queue;
+  std::unordered_map<const nfd::cs::EntryImpl*, Queue::iterator> m_queueIts;
+
+  nfd::scheduler::ScopedEventId m_cleanEvent;
+  time::steady_clock::TimePoint m_scheduledCleaningTime;
+};
+
+} // namespace cs
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDNSIM_MODEL_CS_NDN_CS_POLICY_FRESHNESS_HPP
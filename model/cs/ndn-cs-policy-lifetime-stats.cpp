@@ -0,0 +1,56 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-cs-policy-lifetime-stats.hpp"
+
+#include "ns3/ndnSIM/NFD/daemon/table/cs-entry-impl.hpp"
+
+namespace ns3 {
+namespace ndn {
+namespace cs {
+
+const std::string LifetimeStatsPolicy::POLICY_NAME = "lifetime_stats";
+
+LifetimeStatsPolicy::LifetimeStatsPolicy(std::unique_ptr<nfd::cs::Policy> policy)
+  : PolicyDecorator(POLICY_NAME, std::move(policy))
+{
+}
+
+void
+LifetimeStatsPolicy::doAfterInsert(nfd::cs::iterator i)
+{
+  // must be recorded before the decorated policy gets a chance to evict the entry
+  m_insertTimes[&*i] = time::steady_clock::now();
+  PolicyDecorator::doAfterInsert(i);
+}
+
+void
+LifetimeStatsPolicy::beforeRemove(nfd::cs::iterator i)
+{
+  auto found = m_insertTimes.find(&*i);
+  BOOST_ASSERT(found != m_insertTimes.end());
+  time::nanoseconds lifetime = time::steady_clock::now() - found->second;
+  m_insertTimes.erase(found);
+
+  willRemoveEntry(i->getData(), lifetime);
+}
+
+} // namespace cs
+} // namespace ndn
+} // namespace ns3
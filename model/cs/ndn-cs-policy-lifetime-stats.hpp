@@ -0,0 +1,68 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDNSIM_MODEL_CS_NDN_CS_POLICY_LIFETIME_STATS_HPP
+#define NDNSIM_MODEL_CS_NDN_CS_POLICY_LIFETIME_STATS_HPP
+
+#include "ndn-cs-policy-decorator.hpp"
+
+#include <unordered_map>
+
+namespace ns3 {
+namespace ndn {
+namespace cs {
+
+/**
+ * @ingroup ndn-cs
+ * @brief Policy for NFD's content store that reports how long each Data packet stayed in the
+ *        cache, and leaves eviction to the decorated policy
+ *
+ * Counterpart of ndnSIM 1.0 ns3::ndn::cs::Stats content stores.  The policy of a node can be
+ * reached with L3Protocol::getForwarder()->getCs().getPolicy().
+ */
+class LifetimeStatsPolicy : public PolicyDecorator {
+public:
+  explicit
+  LifetimeStatsPolicy(std::unique_ptr<nfd::cs::Policy> policy);
+
+public:
+  static const std::string POLICY_NAME;
+
+  /**
+   * @brief Emitted just before an entry is removed, with its Data and the time since its
+   *        insertion
+   */
+  ::ndn::util::signal::Signal<LifetimeStatsPolicy, Data, time::nanoseconds> willRemoveEntry;
+
+protected:
+  virtual void
+  doAfterInsert(nfd::cs::iterator i) override;
+
+  virtual void
+  beforeRemove(nfd::cs::iterator i) override;
+
+private:
+  std::unordered_map<const nfd::cs::EntryImpl*, time::steady_clock::TimePoint> m_insertTimes;
+};
+
+} // namespace cs
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDNSIM_MODEL_CS_NDN_CS_POLICY_LIFETIME_STATS_HPP
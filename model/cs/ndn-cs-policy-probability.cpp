@@ -0,0 +1,68 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-cs-policy-probability.hpp"
+
+#include "ns3/random-variable-stream.h"
+#include "ns3/log.h"
+
+NS_LOG_COMPONENT_DEFINE("ndn.cs.ProbabilityPolicy");
+
+namespace ns3 {
+namespace ndn {
+namespace cs {
+
+const std::string ProbabilityPolicy::POLICY_NAME = "probability";
+
+ProbabilityPolicy::ProbabilityPolicy(std::unique_ptr<nfd::cs::Policy> policy, double probability)
+  : PolicyDecorator(POLICY_NAME, std::move(policy))
+  , m_rand(CreateObject<UniformRandomVariable>())
+{
+  setProbability(probability);
+}
+
+ProbabilityPolicy::~ProbabilityPolicy()
+{
+}
+
+void
+ProbabilityPolicy::setProbability(double probability)
+{
+  if (probability < 0.0 || probability > 1.0) {
+    NS_FATAL_ERROR("Cache probability " << probability << " is not within [0, 1]");
+  }
+  m_probability = probability;
+}
+
+void
+ProbabilityPolicy::doAfterInsert(nfd::cs::iterator i)
+{
+  if (m_rand->GetValue() < m_probability) {
+    PolicyDecorator::doAfterInsert(i);
+  }
+  else {
+    NS_LOG_DEBUG("Not caching " << i->getName());
+    // the decorated policy has not seen the entry, only CS needs to erase it
+    this->emitSignal(beforeEvict, i);
+  }
+}
+
+} // namespace cs
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,73 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDNSIM_MODEL_CS_NDN_CS_POLICY_PROBABILITY_HPP
+#define NDNSIM_MODEL_CS_NDN_CS_POLICY_PROBABILITY_HPP
+
+#include "ndn-cs-policy-decorator.hpp"
+
+#include "ns3/ptr.h"
+
+namespace ns3 {
+
+class UniformRandomVariable;
+
+namespace ndn {
+namespace cs {
+
+/**
+ * @ingroup ndn-cs
+ * @brief Policy for NFD's content store that caches each new Data packet with a given
+ *        probability, and leaves eviction to the decorated policy
+ *
+ * Counterpart of ndnSIM 1.0 ns3::ndn::cs::Probability content stores.
+ */
+class ProbabilityPolicy : public PolicyDecorator {
+public:
+  explicit
+  ProbabilityPolicy(std::unique_ptr<nfd::cs::Policy> policy, double probability = 1.0);
+
+  ~ProbabilityPolicy();
+
+  void
+  setProbability(double probability);
+
+  double
+  getProbability() const
+  {
+    return m_probability;
+  }
+
+public:
+  static const std::string POLICY_NAME;
+
+protected:
+  virtual void
+  doAfterInsert(nfd::cs::iterator i) override;
+
+private:
+  double m_probability;
+  Ptr<UniformRandomVariable> m_rand;
+};
+
+} // namespace cs
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDNSIM_MODEL_CS_NDN_CS_POLICY_PROBABILITY_HPP
@@ -97,6 +97,13 @@ L3Protocol::GetTypeId(void)
       .AddTraceSource("TimedOutInterests", "TimedOutInterests",
                       MakeTraceSourceAccessor(&L3Protocol::m_timedOutInterests),
                       "ns3::ndn::L3Protocol::TimedOutInterestsCallback")
+
+      .AddTraceSource("CacheHits", "Interests satisfied from the ContentStore",
+                      MakeTraceSourceAccessor(&L3Protocol::m_cacheHits),
+                      "ns3::ndn::L3Protocol::CacheHitsCallback")
+      .AddTraceSource("CacheMisses", "Interests not found in the ContentStore",
+                      MakeTraceSourceAccessor(&L3Protocol::m_cacheMisses),
+                      "ns3::ndn::L3Protocol::CacheMissesCallback")
     ;
   return tid;
 }
@@ -200,6 +207,10 @@ L3Protocol::initialize()
 {
   m_impl->m_forwarder = make_shared<nfd::Forwarder>();
 
+  if (this->getConfig().get<bool>("ndnSIM.fixed_strategy_dispatch", false)) {
+    m_impl->m_forwarder->setFixedStrategyDispatch(true);
+  }
+
   initializeManagement();
 
   nfd::FaceTable& faceTable = m_impl->m_forwarder->getFaceTable();
@@ -212,6 +223,8 @@ L3Protocol::initialize()
 
   m_impl->m_forwarder->beforeSatisfyInterest.connect(std::ref(m_satisfiedInterests));
   m_impl->m_forwarder->beforeExpirePendingInterest.connect(std::ref(m_timedOutInterests));
+  m_impl->m_forwarder->afterCsHit.connect(std::ref(m_cacheHits));
+  m_impl->m_forwarder->afterCsMiss.connect(std::ref(m_cacheMisses));
 }
 
 class IgnoreSections
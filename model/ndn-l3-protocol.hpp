@@ -179,6 +179,9 @@ public:
   typedef void (*SatisfiedInterestsCallback)(const nfd::pit::Entry& pitEntry, const Face& inFace, const Data& data);
   typedef void (*TimedOutInterestsCallback)(const nfd::pit::Entry& pitEntry);
 
+  typedef void (*CacheHitsCallback)(const Interest& interest, const Data& data);
+  typedef void (*CacheMissesCallback)(const Interest& interest);
+
 protected:
   virtual void
   DoDispose(void); ///< @brief Do cleanup
@@ -219,6 +222,9 @@ private:
 
   TracedCallback<const nfd::pit::Entry&, const Face&/*in face*/, const Data&> m_satisfiedInterests;
   TracedCallback<const nfd::pit::Entry&> m_timedOutInterests;
+
+  TracedCallback<const Interest&, const Data&> m_cacheHits; ///< @brief trace of ContentStore hits
+  TracedCallback<const Interest&> m_cacheMisses;            ///< @brief trace of ContentStore misses
 };
 
 } // namespace ndn
@@ -21,6 +21,7 @@
 #include "ndn-l3-protocol.hpp"
 
 #include "ndn-ns3.hpp"
+#include "null-transport.hpp"
 
 #include "ns3/net-device.h"
 #include "ns3/log.h"
@@ -42,6 +43,7 @@ namespace ndn {
 NetDeviceLinkService::NetDeviceLinkService(Ptr<Node> node, const Ptr<NetDevice>& netDevice)
   : m_node(node)
   , m_netDevice(netDevice)
+  , m_self(make_shared<NetDeviceLinkService*>(this))
 {
   NS_LOG_FUNCTION(this << netDevice);
 
@@ -50,11 +52,18 @@ NetDeviceLinkService::NetDeviceLinkService(Ptr<Node> node, const Ptr<NetDevice>&
   m_node->RegisterProtocolHandler(MakeCallback(&NetDeviceLinkService::receiveFromNetDevice, this),
                                   L3Protocol::ETHERNET_FRAME_TYPE, m_netDevice,
                                   true /*promiscuous mode*/);
+
+  std::weak_ptr<NetDeviceLinkService*> self = m_self;
+  m_netDevice->AddLinkChangeCallback(MakeBoundCallback(&NetDeviceLinkService::notifyLinkChange,
+                                                       self));
 }
 
 NetDeviceLinkService::~NetDeviceLinkService()
 {
   NS_LOG_FUNCTION_NOARGS();
+
+  m_node->UnregisterProtocolHandler(MakeCallback(&NetDeviceLinkService::receiveFromNetDevice,
+                                                 this));
 }
 
 Ptr<Node>
@@ -69,6 +78,26 @@ NetDeviceLinkService::GetNetDevice() const
   return m_netDevice;
 }
 
+void
+NetDeviceLinkService::notifyLinkChange(std::weak_ptr<NetDeviceLinkService*> self)
+{
+  auto linkService = self.lock();
+  if (linkService != nullptr) {
+    (*linkService)->onLinkChange();
+  }
+}
+
+void
+NetDeviceLinkService::onLinkChange()
+{
+  NS_LOG_FUNCTION(this << m_netDevice->IsLinkUp());
+
+  auto transport = dynamic_cast<NullTransport*>(getTransport());
+  if (transport != nullptr) {
+    transport->setLinkUp(m_netDevice->IsLinkUp());
+  }
+}
+
 void
 NetDeviceLinkService::doSendInterest(const Interest& interest)
 {
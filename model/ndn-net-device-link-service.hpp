@@ -92,9 +92,24 @@ private:
   receiveFromNetDevice(Ptr<NetDevice> device, Ptr<const Packet> p, uint16_t protocol,
                        const Address& from, const Address& to, NetDevice::PacketType packetType);
 
+  /// \brief callback from NetDevice when its link goes up or down
+  static void
+  notifyLinkChange(std::weak_ptr<NetDeviceLinkService*> self);
+
+  void
+  onLinkChange();
+
 private:
   Ptr<Node> m_node;
   Ptr<NetDevice> m_netDevice; ///< \brief Smart pointer to NetDevice
+
+  /**
+   * \brief Refers to this LinkService until it is destroyed
+   *
+   * NetDevice cannot remove link change callbacks, so the callback holds a weak reference to
+   * it and ignores link changes after the face is gone.
+   */
+  std::shared_ptr<NetDeviceLinkService*> m_self;
 };
 
 } // namespace ndn
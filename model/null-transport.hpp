@@ -46,6 +46,21 @@ public:
     // this->setMtu(udp::computeMtu(m_socket.local_endpoint())); // not sure what should be here
   }
 
+  /**
+   * \brief Follow the up or down state of the underlying link
+   *
+   * The state change is notified by NFD as FACE_EVENT_UP or FACE_EVENT_DOWN.  Transports that
+   * are closing or closed are left alone.
+   */
+  void
+  setLinkUp(bool isUp)
+  {
+    nfd::face::TransportState state = this->getState();
+    if (state == nfd::face::TransportState::UP || state == nfd::face::TransportState::DOWN) {
+      this->setState(isUp ? nfd::face::TransportState::UP : nfd::face::TransportState::DOWN);
+    }
+  }
+
 private:
   virtual void
   beforeChangePersistency(::ndn::nfd::FacePersistency newPersistency)
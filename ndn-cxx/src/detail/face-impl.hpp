@@ -43,6 +43,8 @@
 #include "../lp/packet.hpp"
 #include "../lp/tags.hpp"
 
+#include "ns3/ndnSIM/NFD/daemon/face/internal-transport.hpp"
+
 namespace ndn {
 
 class Face::Impl : noncopyable
@@ -56,6 +58,7 @@ public:
   Impl(Face& face)
     : m_face(face)
     , m_scheduler(m_face.getIoService())
+    , m_internalTransport(nullptr)
   {
     auto postOnEmptyPitOrNoRegisteredPrefixes = [this] {
       m_scheduler.scheduleEvent(time::seconds(0), bind(&Impl::onEmptyPitOrNoRegisteredPrefixes, this));
@@ -73,7 +76,7 @@ public:
   /////////////////////////////////////////////////////////////////////////////////////////////////
 
   void
-  satisfyPendingInterests(Data& data)
+  satisfyPendingInterests(const Data& data)
   {
     for (auto entry = m_pendingInterestTable.begin(); entry != m_pendingInterestTable.end(); ) {
       if ((*entry)->getInterest()->matchesData(data)) {
@@ -107,7 +110,7 @@ public:
   }
 
   void
-  processInterestFilters(Interest& interest)
+  processInterestFilters(const Interest& interest)
   {
     for (const auto& filter : m_interestFilterTable) {
       if (filter->doesMatch(interest.getName())) {
@@ -119,6 +122,14 @@ public:
   /////////////////////////////////////////////////////////////////////////////////////////////////
   /////////////////////////////////////////////////////////////////////////////////////////////////
 
+  /** @return whether packets can be passed to the forwarder without encoding
+   */
+  bool
+  canSendPackets() const
+  {
+    return m_internalTransport != nullptr && m_internalTransport->canSendPackets();
+  }
+
   void
   ensureConnected(bool wantResume)
   {
@@ -146,6 +157,11 @@ public:
                                                                  ref(m_scheduler))).first;
     (*entry)->setDeleter([this, entry] { m_pendingInterestTable.erase(entry); });
 
+    if (this->canSendPackets()) {
+      m_internalTransport->sendInterest(interest);
+      return;
+    }
+
     lp::Packet packet;
 
     shared_ptr<lp::NextHopFaceIdTag> nextHopFaceIdTag = interest->getTag<lp::NextHopFaceIdTag>();
@@ -176,6 +192,11 @@ public:
   {
     this->ensureConnected(true);
 
+    if (this->canSendPackets()) {
+      m_internalTransport->sendData(data);
+      return;
+    }
+
     lp::Packet packet;
 
     shared_ptr<lp::CachePolicyTag> cachePolicyTag = data->getTag<lp::CachePolicyTag>();
@@ -194,6 +215,11 @@ public:
   {
     this->ensureConnected(true);
 
+    if (this->canSendPackets()) {
+      m_internalTransport->sendNack(nack);
+      return;
+    }
+
     lp::Packet packet;
     packet.add<lp::NackField>(nack->getHeader());
 
@@ -330,6 +356,9 @@ private:
   InterestFilterTable m_interestFilterTable;
   RegisteredPrefixTable m_registeredPrefixTable;
 
+  /// transport connected to the forwarder on the same node, or nullptr for other transports
+  ::nfd::face::InternalClientTransport* m_internalTransport;
+
   friend class Face;
 };
 
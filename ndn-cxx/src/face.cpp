@@ -31,7 +31,7 @@
 
 #include "ns3/node-list.h"
 #include "ns3/ndnSIM/helper/ndn-stack-helper.hpp"
-#include "ns3/ndnSIM/NFD/daemon/face/generic-link-service.hpp"
+#include "ns3/ndnSIM/NFD/daemon/face/internal-link-service.hpp"
 #include "ns3/ndnSIM/NFD/daemon/face/internal-transport.hpp"
 
 namespace ndn {
@@ -78,10 +78,7 @@ Face::makeDefaultTransport()
 
   auto uri = ::nfd::FaceUri("ndnFace://" + boost::lexical_cast<std::string>(node->GetId()));
 
-  ::nfd::face::GenericLinkService::Options serviceOpts;
-  serviceOpts.allowLocalFields = true;
-
-  auto nfdFace = make_shared<::nfd::Face>(make_unique<::nfd::face::GenericLinkService>(serviceOpts),
+  auto nfdFace = make_shared<::nfd::Face>(make_unique<::nfd::face::InternalLinkService>(),
                                           make_unique<::nfd::face::InternalForwarderTransport>(uri, uri));
   auto forwarderTransport = static_cast<::nfd::face::InternalForwarderTransport*>(nfdFace->getTransport());
 
@@ -102,10 +99,26 @@ Face::construct(shared_ptr<Transport> transport, KeyChain& keyChain)
   BOOST_ASSERT(transport != nullptr);
   m_transport = transport;
 
+  // packets exchanged with the forwarder on the same node are passed without encoding
+  auto internalTransport = dynamic_pointer_cast<::nfd::face::InternalClientTransport>(transport);
+  if (internalTransport != nullptr) {
+    m_impl->m_internalTransport = internalTransport.get();
+    internalTransport->setReceivePacketCallbacks(
+      [this] (shared_ptr<const Interest> interest) { m_impl->processInterestFilters(*interest); },
+      [this] (shared_ptr<const Data> data) { m_impl->satisfyPendingInterests(*data); },
+      [this] (shared_ptr<const lp::Nack> nack) { m_impl->nackPendingInterests(*nack); });
+  }
+
   m_nfdController.reset(new nfd::Controller(*this, keyChain));
 }
 
-Face::~Face() = default;
+Face::~Face()
+{
+  if (m_impl->m_internalTransport != nullptr) {
+    // the transport may outlive this face
+    m_impl->m_internalTransport->setReceivePacketCallbacks(nullptr, nullptr, nullptr);
+  }
+}
 
 shared_ptr<Transport>
 Face::getTransport()
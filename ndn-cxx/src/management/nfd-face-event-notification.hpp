@@ -33,7 +33,9 @@ namespace nfd {
  */
 enum FaceEventKind {
   FACE_EVENT_CREATED = 1,
-  FACE_EVENT_DESTROYED = 2
+  FACE_EVENT_DESTROYED = 2,
+  FACE_EVENT_UP = 3,
+  FACE_EVENT_DOWN = 4
 };
 
 /**
@@ -0,0 +1,280 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2016 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "timer-wheel.hpp"
+
+namespace ndn {
+namespace util {
+namespace scheduler {
+
+const size_t TimerWheel::N_LEVELS;
+const size_t TimerWheel::SLOT_BITS;
+const size_t TimerWheel::N_SLOTS;
+
+TimerWheel::TimerWheel(const time::nanoseconds& tick)
+  : m_tick(tick)
+  , m_current(0)
+  , m_nEntries(0)
+  , m_wakeupTick(0)
+{
+  BOOST_ASSERT(m_tick > time::nanoseconds::zero());
+  for (Level& level : m_levels) {
+    level.occupied.fill(0);
+  }
+  m_current = this->getNowTick();
+}
+
+TimerWheel::~TimerWheel()
+{
+  this->setWakeup(0);
+
+  for (Level& level : m_levels) {
+    for (Slot& slot : level.slots) {
+      for (TimerWheelEntry& entry : slot) {
+        shared_ptr<EventIdImpl> eventId = entry.eventId.lock();
+        if (eventId != nullptr) {
+          eventId->wheel = nullptr;
+        }
+      }
+    }
+  }
+}
+
+EventId
+TimerWheel::schedule(const time::nanoseconds& after, const Scheduler::Event& event)
+{
+  BOOST_ASSERT(after >= m_tick);
+  this->catchUp();
+
+  uint64_t nowNs = static_cast<uint64_t>(ns3::Simulator::Now().GetNanoSeconds());
+  uint64_t tickNs = static_cast<uint64_t>(m_tick.count());
+  uint64_t expiry = (nowNs + static_cast<uint64_t>(after.count()) + tickNs - 1) / tickNs;
+  expiry = std::max(expiry, m_current + 1);
+
+  auto eventId = make_shared<EventIdImpl>();
+
+  Slot entries;
+  entries.push_back(TimerWheelEntry{expiry, event, eventId, &entries});
+  Slot::iterator entry = entries.begin();
+  uint64_t dueTick = this->place(entries, entry);
+
+  eventId->wheel = this;
+  eventId->wheelEntry = entry;
+  ++m_nEntries;
+
+  if (m_wakeupTick == 0 || dueTick < m_wakeupTick) {
+    this->setWakeup(dueTick);
+  }
+  return eventId;
+}
+
+void
+TimerWheel::cancel(EventIdImpl& eventId)
+{
+  BOOST_ASSERT(eventId.wheel == this);
+
+  // the simulator wakeup is left in place; it finds nothing to do if this was the only entry
+  eventId.wheelEntry->slot->erase(eventId.wheelEntry);
+  eventId.wheel = nullptr;
+  --m_nEntries;
+}
+
+uint64_t
+TimerWheel::getNowTick() const
+{
+  return static_cast<uint64_t>(ns3::Simulator::Now().GetNanoSeconds()) /
+         static_cast<uint64_t>(m_tick.count());
+}
+
+void
+TimerWheel::catchUp()
+{
+  uint64_t now = this->getNowTick();
+  if (m_wakeupTick != 0) {
+    // ticks before the pending wakeup have no work, but the wakeup tick itself may not
+    // have been processed yet even if simulated time has reached it
+    now = std::min(now, m_wakeupTick - 1);
+  }
+  m_current = std::max(m_current, now);
+}
+
+uint64_t
+TimerWheel::place(Slot& entries, Slot::iterator entry)
+{
+  uint64_t delta = entry->expiry > m_current ? entry->expiry - m_current : 0;
+
+  size_t level = 0;
+  while (level < N_LEVELS - 1 && delta >= (uint64_t(1) << (SLOT_BITS * (level + 1)))) {
+    ++level;
+  }
+  size_t shift = SLOT_BITS * level;
+
+  uint64_t slotTick = entry->expiry;
+  if (delta >= (uint64_t(1) << (SLOT_BITS * N_LEVELS))) {
+    // beyond the wheel horizon: park in the farthest top-level slot, cascade again later
+    slotTick = m_current + (uint64_t(N_SLOTS - 1) << shift);
+  }
+  size_t index = (slotTick >> shift) & (N_SLOTS - 1);
+
+  Slot& slot = m_levels[level].slots[index];
+  slot.splice(slot.end(), entries, entry);
+  entry->slot = &slot;
+  this->markSlot(level, index, true);
+
+  return (slotTick >> shift) << shift;
+}
+
+void
+TimerWheel::markSlot(size_t level, size_t index, bool isOccupied)
+{
+  uint64_t& word = m_levels[level].occupied[index / 64];
+  uint64_t bit = uint64_t(1) << (index % 64);
+  if (isOccupied) {
+    word |= bit;
+  }
+  else {
+    word &= ~bit;
+  }
+}
+
+bool
+TimerWheel::checkSlot(size_t level, size_t index)
+{
+  if ((m_levels[level].occupied[index / 64] & (uint64_t(1) << (index % 64))) == 0) {
+    return false;
+  }
+  if (m_levels[level].slots[index].empty()) {
+    this->markSlot(level, index, false);
+    return false;
+  }
+  return true;
+}
+
+void
+TimerWheel::cascade(size_t level, size_t index)
+{
+  Slot entries;
+  entries.splice(entries.end(), m_levels[level].slots[index]);
+  this->markSlot(level, index, false);
+
+  while (!entries.empty()) {
+    this->place(entries, entries.begin());
+  }
+}
+
+uint64_t
+TimerWheel::findNextTick()
+{
+  if (m_nEntries == 0) {
+    return 0;
+  }
+
+  uint64_t next = std::numeric_limits<uint64_t>::max();
+
+  // level 0 holds entries expiring within (m_current, m_current + N_SLOTS)
+  for (uint64_t k = 1; k < N_SLOTS; ++k) {
+    if (this->checkSlot(0, (m_current + k) & (N_SLOTS - 1))) {
+      next = m_current + k;
+      break;
+    }
+  }
+
+  // upper levels come due when their slot's block begins
+  for (size_t level = 1; level < N_LEVELS; ++level) {
+    size_t shift = SLOT_BITS * level;
+    uint64_t base = m_current >> shift;
+    if (((base + 1) << shift) >= next) {
+      break;
+    }
+    for (uint64_t k = 1; k <= N_SLOTS; ++k) {
+      if (this->checkSlot(level, (base + k) & (N_SLOTS - 1))) {
+        next = std::min(next, (base + k) << shift);
+        break;
+      }
+    }
+  }
+
+  BOOST_ASSERT(next != std::numeric_limits<uint64_t>::max());
+  return next;
+}
+
+void
+TimerWheel::setWakeup(uint64_t tick)
+{
+  if (m_wakeupTick != 0) {
+    ns3::Simulator::Remove(m_wakeupEvent);
+  }
+  m_wakeupTick = tick;
+  if (tick == 0) {
+    return;
+  }
+
+  int64_t delay = static_cast<int64_t>(tick) * m_tick.count() -
+                  ns3::Simulator::Now().GetNanoSeconds();
+  m_wakeupEvent = ns3::Simulator::Schedule(ns3::NanoSeconds(std::max<int64_t>(delay, 0)),
+                                           &TimerWheel::onWakeup, this);
+}
+
+void
+TimerWheel::onWakeup()
+{
+  uint64_t tick = m_wakeupTick;
+  m_wakeupTick = 0;
+  BOOST_ASSERT(tick > m_current);
+  m_current = tick;
+
+  // cascade from the top so that entries can fall through several levels in one pass
+  for (size_t level = N_LEVELS - 1; level > 0; --level) {
+    size_t shift = SLOT_BITS * level;
+    if ((tick & ((uint64_t(1) << shift) - 1)) == 0) {
+      this->cascade(level, (tick >> shift) & (N_SLOTS - 1));
+    }
+  }
+
+  size_t index = tick & (N_SLOTS - 1);
+  Slot due;
+  due.splice(due.end(), m_levels[0].slots[index]);
+  this->markSlot(0, index, false);
+  for (TimerWheelEntry& entry : due) {
+    entry.slot = &due; // so that events fired earlier in this batch can cancel later ones
+  }
+
+  while (!due.empty()) {
+    TimerWheelEntry& entry = due.front();
+    BOOST_ASSERT(entry.expiry <= tick);
+
+    Scheduler::Event event = std::move(entry.event);
+    shared_ptr<EventIdImpl> eventId = entry.eventId.lock();
+    if (eventId != nullptr) {
+      eventId->wheel = nullptr;
+    }
+    due.pop_front();
+    --m_nEntries;
+
+    event();
+  }
+
+  this->setWakeup(this->findNextTick());
+}
+
+} // namespace scheduler
+} // namespace util
+} // namespace ndn
@@ -0,0 +1,166 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2016 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_UTIL_DETAIL_TIMER_WHEEL_HPP
+#define NDN_UTIL_DETAIL_TIMER_WHEEL_HPP
+
+#include "../scheduler.hpp"
+
+#include <array>
+#include <list>
+
+namespace ndn {
+namespace util {
+namespace scheduler {
+
+class TimerWheel;
+
+struct TimerWheelEntry
+{
+  uint64_t expiry; ///< absolute tick number
+  Scheduler::Event event;
+  weak_ptr<EventIdImpl> eventId;
+  std::list<TimerWheelEntry>* slot; ///< list currently holding this entry
+};
+
+/** \brief state behind an EventId
+ *
+ *  An event is pending either in the simulator event queue (\p simulatorEvent),
+ *  or in a TimerWheel (\p wheel is non-null while the event is pending there).
+ */
+class EventIdImpl : noncopyable
+{
+public:
+  ns3::EventId simulatorEvent;
+  TimerWheel* wheel = nullptr;
+  std::list<TimerWheelEntry>::iterator wheelEntry;
+};
+
+/** \brief hierarchical timer wheel driven by one simulator event at a time
+ *
+ *  The wheel has four levels of 256 slots each; a slot on level L covers 256^L ticks.
+ *  Scheduling and cancelling are O(1).  Entries on upper levels are cascaded to lower levels
+ *  when their slot comes due, and all entries expiring in the same tick are fired from
+ *  a single simulator event.
+ *
+ *  The wheel keeps at most one pending simulator event, at the next tick that has either
+ *  entries to fire or a non-empty slot to cascade, so an idle wheel costs nothing.
+ *  All simulator events are scheduled from the wheel's own context, so events fire
+ *  in the context of the node that scheduled them.
+ *
+ *  \note Expiration is rounded up to the next tick boundary.
+ */
+class TimerWheel : noncopyable
+{
+public:
+  explicit
+  TimerWheel(const time::nanoseconds& tick);
+
+  ~TimerWheel();
+
+  /** \brief schedule \p event to fire after \p after
+   *  \pre after >= tick
+   */
+  EventId
+  schedule(const time::nanoseconds& after, const Scheduler::Event& event);
+
+  /** \brief cancel a pending event
+   *  \pre eventId->wheel == this
+   */
+  void
+  cancel(EventIdImpl& eventId);
+
+  bool
+  empty() const
+  {
+    return m_nEntries == 0;
+  }
+
+private:
+  typedef std::list<TimerWheelEntry> Slot;
+
+  static const size_t N_LEVELS = 4;
+  static const size_t SLOT_BITS = 8;
+  static const size_t N_SLOTS = 1 << SLOT_BITS;
+
+  struct Level
+  {
+    std::array<Slot, N_SLOTS> slots;
+    std::array<uint64_t, N_SLOTS / 64> occupied;
+  };
+
+  uint64_t
+  getNowTick() const;
+
+  /** \brief advance m_current over ticks known to have no work
+   */
+  void
+  catchUp();
+
+  /** \brief place an entry into a slot according to its expiry
+   *  \param entries list currently holding the entry
+   *  \return tick at which the slot comes due
+   */
+  uint64_t
+  place(Slot& entries, Slot::iterator entry);
+
+  void
+  markSlot(size_t level, size_t index, bool isOccupied);
+
+  /** \return whether the slot has entries; lazily clears the occupied mark of a slot
+   *          emptied by cancellation
+   */
+  bool
+  checkSlot(size_t level, size_t index);
+
+  /** \brief cascade a slot to lower levels
+   */
+  void
+  cascade(size_t level, size_t index);
+
+  /** \return next tick with work, or 0 if the wheel is empty
+   */
+  uint64_t
+  findNextTick();
+
+  /** \brief (re)schedule the simulator event at \p tick, or cancel it if \p tick is 0
+   */
+  void
+  setWakeup(uint64_t tick);
+
+  void
+  onWakeup();
+
+private:
+  time::nanoseconds m_tick;
+  std::array<Level, N_LEVELS> m_levels;
+  uint64_t m_current; ///< last processed tick
+  size_t m_nEntries;
+
+  ns3::EventId m_wakeupEvent;
+  uint64_t m_wakeupTick; ///< tick of m_wakeupEvent, 0 if none
+};
+
+} // namespace scheduler
+} // namespace util
+} // namespace ndn
+
+#endif // NDN_UTIL_DETAIL_TIMER_WHEEL_HPP
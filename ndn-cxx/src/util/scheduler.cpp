@@ -22,6 +22,7 @@
 #include "common.hpp"
 
 #include "scheduler.hpp"
+#include "detail/timer-wheel.hpp"
 
 namespace ns3 {
 
@@ -45,6 +46,13 @@ namespace ndn {
 namespace util {
 namespace scheduler {
 
+#ifdef NDN_CXX_SCHEDULER_TIMER_WHEEL
+static Scheduler::Backend g_defaultBackend = Scheduler::Backend::TIMER_WHEEL;
+#else
+static Scheduler::Backend g_defaultBackend = Scheduler::Backend::SIMULATOR;
+#endif // NDN_CXX_SCHEDULER_TIMER_WHEEL
+static time::nanoseconds g_defaultTick = time::milliseconds(1);
+
 Scheduler::EventInfo::EventInfo(const time::nanoseconds& after,
                                 const Event& event)
   : m_scheduledTime(time::steady_clock::now() + after)
@@ -73,6 +81,8 @@ Scheduler::EventInfo::expiresFromNow() const
 
 Scheduler::Scheduler(boost::asio::io_service& ioService)
   : m_scheduledEvent(m_events.end())
+  , m_backend(g_defaultBackend)
+  , m_tick(g_defaultTick)
 {
 }
 
@@ -81,14 +91,36 @@ Scheduler::~Scheduler()
   cancelAllEvents();
 }
 
+void
+Scheduler::setDefaultBackend(Backend backend, const time::nanoseconds& tick)
+{
+  BOOST_ASSERT(tick > time::nanoseconds::zero());
+  g_defaultBackend = backend;
+  g_defaultTick = tick;
+}
+
+TimerWheel&
+Scheduler::getTimerWheel()
+{
+  unique_ptr<TimerWheel>& wheel = m_wheels[ns3::Simulator::GetContext()];
+  if (wheel == nullptr) {
+    wheel.reset(new TimerWheel(m_tick));
+  }
+  return *wheel;
+}
+
 EventId
 Scheduler::scheduleEvent(const time::nanoseconds& after, const Event& event)
 {
-  EventId eventId = std::make_shared<ns3::EventId>();
-  weak_ptr<ns3::EventId> eventWeak = eventId;
+  if (m_backend == Backend::TIMER_WHEEL && after >= m_tick) {
+    return this->getTimerWheel().schedule(after, event);
+  }
+
+  EventId eventId = std::make_shared<EventIdImpl>();
+  weak_ptr<EventIdImpl> eventWeak = eventId;
   std::function<void()> eventWithCleanup = [this, event, eventWeak] () {
     event();
-    shared_ptr<ns3::EventId> eventId = eventWeak.lock();
+    shared_ptr<EventIdImpl> eventId = eventWeak.lock();
     if (eventId != nullptr) {
       this->m_events.erase(eventId); // remove the event from the set after it is executed
     }
@@ -96,7 +128,7 @@ Scheduler::scheduleEvent(const time::nanoseconds& after, const Event& event)
 
   ns3::EventId id = ns3::Simulator::Schedule(ns3::NanoSeconds(after.count()),
                                              &std::function<void()>::operator(), eventWithCleanup);
-  *eventId = std::move(id);
+  eventId->simulatorEvent = std::move(id);
   m_events.insert(eventId);
 
   return eventId;
@@ -105,11 +137,18 @@ Scheduler::scheduleEvent(const time::nanoseconds& after, const Event& event)
 void
 Scheduler::cancelEvent(const EventId& eventId)
 {
-  if (eventId != nullptr) {
-    ns3::Simulator::Remove(*eventId);
-    const_cast<EventId&>(eventId).reset();
+  if (eventId == nullptr) {
+    return;
+  }
+
+  if (eventId->wheel != nullptr) {
+    eventId->wheel->cancel(*eventId);
+  }
+  else {
+    ns3::Simulator::Remove(eventId->simulatorEvent);
     m_events.erase(eventId);
   }
+  const_cast<EventId&>(eventId).reset();
 }
 
 void
@@ -120,12 +159,13 @@ Scheduler::cancelAllEvents()
     auto next = i;
     ++next; // ns3::Simulator::Remove can call cancelEvent
     if ((*i) != nullptr) {
-      ns3::Simulator::Remove((**i));
+      ns3::Simulator::Remove((*i)->simulatorEvent);
       const_cast<EventId&>(*i).reset();
     }
     i = next;
   }
   m_events.clear();
+  m_wheels.clear();
   //ymz ncc
 
   // for (auto i = m_events.begin(); i != m_events.end(); i++) {
@@ -27,25 +27,45 @@
 
 #include "ns3/simulator.h"
 
+#include <map>
 #include <set>
 
 namespace ndn {
 namespace util {
 namespace scheduler {
 
+class EventIdImpl;
+class TimerWheel;
+
 /** \class EventId
  *  \brief Opaque type (shared_ptr) representing ID of a scheduled event
  */
-typedef std::shared_ptr<ns3::EventId> EventId;
+typedef std::shared_ptr<EventIdImpl> EventId;
 
 /**
  * \brief Generic scheduler
+ *
+ * Two backends are available:
+ * - SIMULATOR: every event is a separate ns3::Simulator event
+ * - TIMER_WHEEL: events are kept in a hierarchical timer wheel per simulation context
+ *   (i.e., per node), which is driven by a single ns3::Simulator event at a time.
+ *   Expiration is rounded up to the wheel tick; events due sooner than one tick
+ *   are still passed to ns3::Simulator directly.
+ *
+ * The backend is fixed when the Scheduler is constructed.  The default is SIMULATOR,
+ * or TIMER_WHEEL when compiled with NDN_CXX_SCHEDULER_TIMER_WHEEL defined, and can be
+ * changed with setDefaultBackend.
  */
 class Scheduler
 {
 public:
   typedef function<void()> Event;
 
+  enum class Backend {
+    SIMULATOR,
+    TIMER_WHEEL
+  };
+
   Scheduler(boost::asio::io_service& ioService);
 
   ~Scheduler();
@@ -69,6 +89,24 @@ public:
   void
   cancelAllEvents();
 
+  /**
+   * \brief Set backend for Schedulers constructed afterwards
+   * \param backend the backend
+   * \param tick resolution of TIMER_WHEEL backend
+   */
+  static void
+  setDefaultBackend(Backend backend, const time::nanoseconds& tick = time::milliseconds(1));
+
+  Backend
+  getBackend() const
+  {
+    return m_backend;
+  }
+
+private:
+  TimerWheel&
+  getTimerWheel();
+
 private:
   struct EventInfo
   {
@@ -100,6 +138,10 @@ private:
 
   EventQueue m_events;
   EventQueue::iterator m_scheduledEvent;
+
+  Backend m_backend;
+  time::nanoseconds m_tick;
+  std::map<uint32_t, unique_ptr<TimerWheel>> m_wheels; ///< simulation context => wheel
 };
 
 } // namespace scheduler
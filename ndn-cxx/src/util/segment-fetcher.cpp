@@ -30,42 +30,97 @@ namespace util {
 
 const uint32_t SegmentFetcher::MAX_INTEREST_REEXPRESS = 3;
 
+static const uint64_t UNKNOWN_SEGMENT = std::numeric_limits<uint64_t>::max();
+
+SegmentFetcher::Options::Options()
+  : isPipelined(false)
+  , initCwnd(1.0)
+  , initSsthresh(std::numeric_limits<double>::max())
+  , maxCwnd(std::numeric_limits<double>::max())
+  , aiStep(1.0)
+  , mdCoef(0.5)
+  , maxRetransmissions(3)
+{
+}
+
 SegmentFetcher::SegmentFetcher(Face& face,
                                shared_ptr<Validator> validator,
+                               const Options& options,
                                const CompleteCallback& completeCallback,
                                const ErrorCallback& errorCallback)
   : m_face(face)
   , m_scheduler(m_face.getIoService())
   , m_validator(validator)
+  , m_options(options)
   , m_completeCallback(completeCallback)
   , m_errorCallback(errorCallback)
   , m_buffer(make_shared<OBufferStream>())
+  , m_isStopped(false)
+  , m_cwnd(options.initCwnd)
+  , m_ssthresh(options.initSsthresh)
+  , m_nSent(0)
+  , m_recoveryPoint(0)
+  , m_firstSegmentNo(UNKNOWN_SEGMENT)
+  , m_nextSegmentNo(0)
+  , m_finalSegmentNo(UNKNOWN_SEGMENT)
+  , m_nextSegmentToWrite(0)
+  , m_nInFlight(0)
+{
+  BOOST_ASSERT(m_options.initCwnd >= 1.0);
+  BOOST_ASSERT(m_options.mdCoef > 0.0 && m_options.mdCoef < 1.0);
+}
+
+void
+SegmentFetcher::fetch(Face& face,
+                      const Interest& baseInterest,
+                      Validator& validator,
+                      const CompleteCallback& completeCallback,
+                      const ErrorCallback& errorCallback)
+{
+  fetch(face, baseInterest, validator, Options(), completeCallback, errorCallback);
+}
+
+void
+SegmentFetcher::fetch(Face& face,
+                      const Interest& baseInterest,
+                      shared_ptr<Validator> validator,
+                      const CompleteCallback& completeCallback,
+                      const ErrorCallback& errorCallback)
 {
+  fetch(face, baseInterest, validator, Options(), completeCallback, errorCallback);
 }
 
 void
 SegmentFetcher::fetch(Face& face,
                       const Interest& baseInterest,
                       Validator& validator,
+                      const Options& options,
                       const CompleteCallback& completeCallback,
                       const ErrorCallback& errorCallback)
 {
   shared_ptr<Validator> sharedValidator = shared_ptr<Validator>(&validator, [] (Validator*) {});
 
-  fetch(face, baseInterest, sharedValidator, completeCallback, errorCallback);
+  fetch(face, baseInterest, sharedValidator, options, completeCallback, errorCallback);
 }
 
 void
 SegmentFetcher::fetch(Face& face,
                       const Interest& baseInterest,
                       shared_ptr<Validator> validator,
+                      const Options& options,
                       const CompleteCallback& completeCallback,
                       const ErrorCallback& errorCallback)
 {
-  shared_ptr<SegmentFetcher> fetcher(new SegmentFetcher(face, validator, completeCallback,
-                                                        errorCallback));
+  shared_ptr<SegmentFetcher> fetcher(new SegmentFetcher(face, validator, options,
+                                                        completeCallback, errorCallback));
 
-  fetcher->fetchFirstSegment(baseInterest, fetcher);
+  if (options.isPipelined) {
+    fetcher->m_baseInterest = baseInterest;
+    fetcher->pipelineFirstSegment(baseInterest, 0, fetcher);
+  }
+  else {
+    fetcher->fetchFirstSegment(baseInterest, fetcher);
+  }
 }
 
 void
@@ -184,5 +239,300 @@ SegmentFetcher::reExpressInterest(Interest interest, uint32_t reExpressCount,
                          bind(m_errorCallback, INTEREST_TIMEOUT, "Timeout"));
 }
 
+void
+SegmentFetcher::pipelineFirstSegment(const Interest& baseInterest, uint32_t reExpressCount,
+                                     shared_ptr<SegmentFetcher> self)
+{
+  Interest interest(baseInterest);
+  interest.setChildSelector(1);
+  interest.setMustBeFresh(true);
+  if (reExpressCount > 0) {
+    interest.refreshNonce();
+  }
+
+  m_face.expressInterest(interest,
+                         bind(&SegmentFetcher::pipelineAfterFirstData, this, _1, _2, self),
+                         bind(&SegmentFetcher::pipelineAfterFirstNack, this, _1, _2,
+                              reExpressCount, self),
+                         bind(m_errorCallback, INTEREST_TIMEOUT, "Timeout"));
+}
+
+void
+SegmentFetcher::pipelineAfterFirstData(const Interest& interest, const Data& data,
+                                       shared_ptr<SegmentFetcher> self)
+{
+  const name::Component& currentSegment = data.getName().get(-1);
+  if (!currentSegment.isSegment()) {
+    return pipelineFail(DATA_HAS_NO_SEGMENT, "Data Name has no segment number.");
+  }
+
+  m_versionedName = data.getName().getPrefix(-1);
+  m_firstSegmentNo = currentSegment.toSegment();
+  pipelineReceiveSegment(m_firstSegmentNo, data, self);
+}
+
+void
+SegmentFetcher::pipelineAfterFirstNack(const Interest& interest, const lp::Nack& nack,
+                                       uint32_t reExpressCount, shared_ptr<SegmentFetcher> self)
+{
+  if (reExpressCount >= MAX_INTEREST_REEXPRESS) {
+    return m_errorCallback(NACK_ERROR, "Nack Error");
+  }
+
+  switch (nack.getReason()) {
+    case lp::NackReason::DUPLICATE:
+      pipelineFirstSegment(m_baseInterest, reExpressCount + 1, self);
+      break;
+    case lp::NackReason::CONGESTION:
+      m_scheduler.scheduleEvent(time::milliseconds(1 << (reExpressCount + 1)),
+                                bind(&SegmentFetcher::pipelineFirstSegment, this,
+                                     m_baseInterest, reExpressCount + 1, self));
+      break;
+    default:
+      m_errorCallback(NACK_ERROR, "Nack Error");
+      break;
+  }
+}
+
+void
+SegmentFetcher::pipelineSendInterests(shared_ptr<SegmentFetcher> self)
+{
+  while (!m_isStopped && m_nInFlight < std::max<size_t>(1, static_cast<size_t>(m_cwnd))) {
+    uint64_t segmentNo = 0;
+    if (!m_retxQueue.empty()) {
+      segmentNo = *m_retxQueue.begin();
+      m_retxQueue.erase(m_retxQueue.begin());
+    }
+    else {
+      if (m_nextSegmentNo == m_firstSegmentNo) {
+        ++m_nextSegmentNo;
+      }
+      if (m_nextSegmentNo > m_finalSegmentNo) {
+        break;
+      }
+      segmentNo = m_nextSegmentNo++;
+      m_segments[segmentNo] = SegmentState{nullptr, 0, 0, 0};
+    }
+
+    pipelineSendInterest(segmentNo, self);
+  }
+}
+
+void
+SegmentFetcher::pipelineSendInterest(uint64_t segmentNo, shared_ptr<SegmentFetcher> self)
+{
+  Interest interest(m_baseInterest); // to preserve any selectors
+  interest.refreshNonce();
+  interest.setChildSelector(0);
+  interest.setMustBeFresh(false);
+  interest.setName(Name(m_versionedName).appendSegment(segmentNo));
+
+  SegmentState& state = m_segments[segmentNo];
+  state.sendIndex = ++m_nSent;
+  state.pendingInterest =
+    m_face.expressInterest(interest,
+                           bind(&SegmentFetcher::pipelineAfterData, this, segmentNo, _2, self),
+                           bind(&SegmentFetcher::pipelineAfterNack, this, segmentNo, _2, self),
+                           bind(&SegmentFetcher::pipelineAfterTimeout, this, segmentNo, self));
+  ++m_nInFlight;
+}
+
+void
+SegmentFetcher::pipelineAfterData(uint64_t segmentNo, const Data& data,
+                                  shared_ptr<SegmentFetcher> self)
+{
+  auto it = m_segments.find(segmentNo);
+  if (m_isStopped || it == m_segments.end() || it->second.pendingInterest == nullptr) {
+    return;
+  }
+  m_segments.erase(it);
+  --m_nInFlight;
+
+  if (!data.getName().get(-1).isSegment()) {
+    return pipelineFail(DATA_HAS_NO_SEGMENT, "Data Name has no segment number.");
+  }
+
+  pipelineReceiveSegment(segmentNo, data, self);
+}
+
+void
+SegmentFetcher::pipelineAfterNack(uint64_t segmentNo, const lp::Nack& nack,
+                                  shared_ptr<SegmentFetcher> self)
+{
+  auto it = m_segments.find(segmentNo);
+  if (m_isStopped || it == m_segments.end() || it->second.pendingInterest == nullptr) {
+    return;
+  }
+  SegmentState& state = it->second;
+  state.pendingInterest = nullptr;
+  --m_nInFlight;
+
+  if (state.nReExpress >= MAX_INTEREST_REEXPRESS) {
+    return pipelineFail(NACK_ERROR, "Nack Error");
+  }
+  ++state.nReExpress;
+
+  switch (nack.getReason()) {
+    case lp::NackReason::DUPLICATE:
+      m_retxQueue.insert(segmentNo);
+      pipelineSendInterests(self);
+      break;
+    case lp::NackReason::CONGESTION:
+      pipelineDecreaseWindow(state.sendIndex);
+      m_scheduler.scheduleEvent(time::milliseconds(1 << state.nReExpress),
+        [this, segmentNo, self] {
+          if (!m_isStopped && segmentNo <= m_finalSegmentNo) {
+            m_retxQueue.insert(segmentNo);
+            pipelineSendInterests(self);
+          }
+        });
+      // other segments may be sent within the reduced window in the meantime
+      pipelineSendInterests(self);
+      break;
+    default:
+      pipelineFail(NACK_ERROR, "Nack Error");
+      break;
+  }
+}
+
+void
+SegmentFetcher::pipelineAfterTimeout(uint64_t segmentNo, shared_ptr<SegmentFetcher> self)
+{
+  auto it = m_segments.find(segmentNo);
+  if (m_isStopped || it == m_segments.end() || it->second.pendingInterest == nullptr) {
+    return;
+  }
+  SegmentState& state = it->second;
+  state.pendingInterest = nullptr;
+  --m_nInFlight;
+
+  pipelineDecreaseWindow(state.sendIndex);
+
+  if (state.nRetransmissions >= m_options.maxRetransmissions) {
+    return pipelineFail(INTEREST_TIMEOUT, "Timeout");
+  }
+  ++state.nRetransmissions;
+  m_retxQueue.insert(segmentNo);
+  pipelineSendInterests(self);
+}
+
+void
+SegmentFetcher::pipelineReceiveSegment(uint64_t segmentNo, const Data& data,
+                                       shared_ptr<SegmentFetcher> self)
+{
+  const name::Component& currentSegment = data.getName().get(-1);
+  const name::Component& finalBlockId = data.getMetaInfo().getFinalBlockId();
+  if (!finalBlockId.empty()) {
+    if (!(finalBlockId > currentSegment)) {
+      pipelineSetFinalSegment(segmentNo);
+    }
+    else if (finalBlockId.isSegment()) {
+      pipelineSetFinalSegment(finalBlockId.toSegment());
+    }
+  }
+
+  pipelineIncreaseWindow();
+
+  // validation may complete asynchronously, while more segments are being fetched
+  m_validator->validate(data,
+                        [this, segmentNo, self] (const shared_ptr<const Data>& data) {
+                          pipelineAfterValidationSuccess(segmentNo, data);
+                        },
+                        [this, self] (const shared_ptr<const Data>&, const std::string&) {
+                          pipelineFail(SEGMENT_VALIDATION_FAIL, "Segment validation fail");
+                        });
+
+  pipelineSendInterests(self);
+}
+
+void
+SegmentFetcher::pipelineAfterValidationSuccess(uint64_t segmentNo,
+                                               const shared_ptr<const Data>& data)
+{
+  if (m_isStopped || segmentNo > m_finalSegmentNo || segmentNo < m_nextSegmentToWrite) {
+    return;
+  }
+  m_validatedSegments[segmentNo] = data;
+
+  auto it = m_validatedSegments.begin();
+  while (it != m_validatedSegments.end() && it->first == m_nextSegmentToWrite) {
+    const Block& content = it->second->getContent();
+    m_buffer->write(reinterpret_cast<const char*>(content.value()), content.value_size());
+    ++m_nextSegmentToWrite;
+    it = m_validatedSegments.erase(it);
+  }
+
+  if (m_finalSegmentNo != UNKNOWN_SEGMENT && m_nextSegmentToWrite > m_finalSegmentNo) {
+    m_isStopped = true;
+    m_completeCallback(m_buffer->buf());
+  }
+}
+
+void
+SegmentFetcher::pipelineSetFinalSegment(uint64_t finalSegmentNo)
+{
+  if (finalSegmentNo >= m_finalSegmentNo) {
+    return;
+  }
+  m_finalSegmentNo = finalSegmentNo;
+
+  // cancel Interests for segments beyond the end
+  for (auto it = m_segments.upper_bound(finalSegmentNo); it != m_segments.end();) {
+    if (it->second.pendingInterest != nullptr) {
+      m_face.removePendingInterest(it->second.pendingInterest);
+      --m_nInFlight;
+    }
+    it = m_segments.erase(it);
+  }
+  m_retxQueue.erase(m_retxQueue.upper_bound(finalSegmentNo), m_retxQueue.end());
+  m_validatedSegments.erase(m_validatedSegments.upper_bound(finalSegmentNo),
+                            m_validatedSegments.end());
+}
+
+void
+SegmentFetcher::pipelineIncreaseWindow()
+{
+  if (m_cwnd < m_ssthresh) {
+    m_cwnd += 1.0; // slow start
+  }
+  else {
+    m_cwnd += m_options.aiStep / m_cwnd; // congestion avoidance
+  }
+  m_cwnd = std::min(m_cwnd, m_options.maxCwnd);
+}
+
+void
+SegmentFetcher::pipelineDecreaseWindow(uint64_t sendIndex)
+{
+  if (sendIndex <= m_recoveryPoint) {
+    // the window has been decreased since this Interest was sent
+    return;
+  }
+
+  m_ssthresh = std::max(2.0, m_cwnd * m_options.mdCoef);
+  m_cwnd = std::max(m_options.initCwnd, std::min(m_ssthresh, m_options.maxCwnd));
+  m_recoveryPoint = m_nSent;
+}
+
+void
+SegmentFetcher::pipelineFail(uint32_t code, const std::string& msg)
+{
+  if (m_isStopped) {
+    return;
+  }
+  m_isStopped = true;
+
+  for (const auto& segment : m_segments) {
+    if (segment.second.pendingInterest != nullptr) {
+      m_face.removePendingInterest(segment.second.pendingInterest);
+    }
+  }
+  m_segments.clear();
+  m_retxQueue.clear();
+  m_nInFlight = 0;
+
+  m_errorCallback(code, msg);
+}
+
 } // namespace util
 } // namespace ndn
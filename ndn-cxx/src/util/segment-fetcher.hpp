@@ -27,6 +27,9 @@
 #include "../face.hpp"
 #include "../security/validator.hpp"
 
+#include <map>
+#include <set>
+
 namespace ndn {
 
 class OBufferStream;
@@ -77,6 +80,14 @@ namespace util {
  * If the segment validation is successful, afterValidationSuccess callback is fired, otherwise
  * afterValidationFailure callback.
  *
+ * In pipelined mode (see Options::isPipelined), step 5 sends Interests for several segments
+ * at a time.  The number of Interests in flight is limited by a congestion window that grows
+ * with every received segment (slow start, then additive increase) and is multiplicatively
+ * decreased at most once per window on a timeout or a congestion Nack.  Segments are validated
+ * as soon as they arrive and are buffered until all preceding segments have been validated.
+ * Timed out Interests are retransmitted up to Options::maxRetransmissions times before
+ * `INTEREST_TIMEOUT` is reported.
+ *
  * Examples:
  *
  *     void
@@ -119,6 +130,37 @@ public:
     NACK_ERROR = 4
   };
 
+  /**
+   * @brief Options of the fetching process
+   */
+  class Options
+  {
+  public:
+    Options();
+
+  public:
+    /// whether to keep a window of Interests in flight instead of fetching one segment at a time
+    bool isPipelined;
+
+    /// initial congestion window, in segments
+    double initCwnd;
+
+    /// initial slow start threshold, in segments
+    double initSsthresh;
+
+    /// upper limit of the congestion window, in segments
+    double maxCwnd;
+
+    /// additive increase of the congestion window per window of received segments
+    double aiStep;
+
+    /// multiplicative decrease coefficient applied on congestion
+    double mdCoef;
+
+    /// number of times a timed out segment Interest is retransmitted before failing
+    uint32_t maxRetransmissions;
+  };
+
   /**
    * @brief Initiate segment fetching
    *
@@ -167,9 +209,52 @@ public:
         const CompleteCallback& completeCallback,
         const ErrorCallback& errorCallback);
 
+  /**
+   * @brief Initiate segment fetching with the specified options
+   *
+   * @param face          Reference to the Face that should be used to fetch data
+   * @param baseInterest  An Interest for the initial segment of requested data
+   * @param validator     Reference to the Validator that should be used to validate data. Caller
+   *                      must ensure validator is valid until either completeCallback or errorCallback
+   *                      is invoked.
+   * @param options       Options of the fetching process
+   *
+   * @param completeCallback    Callback to be fired when all segments are fetched
+   * @param errorCallback       Callback to be fired when an error occurs (@see Errors)
+   */
+  static
+  void
+  fetch(Face& face,
+        const Interest& baseInterest,
+        Validator& validator,
+        const Options& options,
+        const CompleteCallback& completeCallback,
+        const ErrorCallback& errorCallback);
+
+  /**
+   * @brief Initiate segment fetching with the specified options
+   *
+   * @param face          Reference to the Face that should be used to fetch data
+   * @param baseInterest  An Interest for the initial segment of requested data
+   * @param validator     A shared_ptr to the Validator that should be used to validate data.
+   * @param options       Options of the fetching process
+   *
+   * @param completeCallback    Callback to be fired when all segments are fetched
+   * @param errorCallback       Callback to be fired when an error occurs (@see Errors)
+   */
+  static
+  void
+  fetch(Face& face,
+        const Interest& baseInterest,
+        shared_ptr<Validator> validator,
+        const Options& options,
+        const CompleteCallback& completeCallback,
+        const ErrorCallback& errorCallback);
+
 private:
   SegmentFetcher(Face& face,
                  shared_ptr<Validator> validator,
+                 const Options& options,
                  const CompleteCallback& completeCallback,
                  const ErrorCallback& errorCallback);
 
@@ -201,14 +286,92 @@ private:
   reExpressInterest(Interest interest, uint32_t reExpressCount,
                     shared_ptr<SegmentFetcher> self);
 
+private: // pipelined mode
+  void
+  pipelineFirstSegment(const Interest& baseInterest, uint32_t reExpressCount,
+                       shared_ptr<SegmentFetcher> self);
+
+  void
+  pipelineAfterFirstData(const Interest& interest, const Data& data,
+                         shared_ptr<SegmentFetcher> self);
+
+  void
+  pipelineAfterFirstNack(const Interest& interest, const lp::Nack& nack,
+                         uint32_t reExpressCount, shared_ptr<SegmentFetcher> self);
+
+  /** @brief send Interests for retransmitted and new segments while the window allows
+   */
+  void
+  pipelineSendInterests(shared_ptr<SegmentFetcher> self);
+
+  void
+  pipelineSendInterest(uint64_t segmentNo, shared_ptr<SegmentFetcher> self);
+
+  void
+  pipelineAfterData(uint64_t segmentNo, const Data& data, shared_ptr<SegmentFetcher> self);
+
+  void
+  pipelineAfterNack(uint64_t segmentNo, const lp::Nack& nack, shared_ptr<SegmentFetcher> self);
+
+  void
+  pipelineAfterTimeout(uint64_t segmentNo, shared_ptr<SegmentFetcher> self);
+
+  /** @brief process a segment whose Name has been checked, before it is validated
+   */
+  void
+  pipelineReceiveSegment(uint64_t segmentNo, const Data& data, shared_ptr<SegmentFetcher> self);
+
+  void
+  pipelineAfterValidationSuccess(uint64_t segmentNo, const shared_ptr<const Data>& data);
+
+  void
+  pipelineSetFinalSegment(uint64_t finalSegmentNo);
+
+  void
+  pipelineIncreaseWindow();
+
+  /** @brief decrease the window, unless it has been decreased since \p segmentNo was sent
+   */
+  void
+  pipelineDecreaseWindow(uint64_t segmentNo);
+
+  void
+  pipelineFail(uint32_t code, const std::string& msg);
+
 private:
   Face& m_face;
   Scheduler m_scheduler;
   shared_ptr<Validator> m_validator;
+  Options m_options;
   CompleteCallback m_completeCallback;
   ErrorCallback m_errorCallback;
 
   shared_ptr<OBufferStream> m_buffer;
+
+  // pipelined mode
+  struct SegmentState
+  {
+    const PendingInterestId* pendingInterest; ///< nullptr if the segment is not in flight
+    uint64_t sendIndex; ///< order of the last transmission
+    uint32_t nRetransmissions;
+    uint32_t nReExpress; ///< Interests re-expressed due to Nack
+  };
+
+  Interest m_baseInterest;
+  Name m_versionedName;
+  bool m_isStopped;
+  double m_cwnd;
+  double m_ssthresh;
+  uint64_t m_nSent; ///< Interests sent, including retransmissions
+  uint64_t m_recoveryPoint; ///< m_nSent at the last window decrease
+  uint64_t m_firstSegmentNo; ///< segment received in response to the first Interest
+  uint64_t m_nextSegmentNo; ///< next segment that has not been requested
+  uint64_t m_finalSegmentNo; ///< std::numeric_limits<uint64_t>::max() if unknown
+  uint64_t m_nextSegmentToWrite;
+  size_t m_nInFlight;
+  std::map<uint64_t, SegmentState> m_segments; ///< segments requested but not received
+  std::set<uint64_t> m_retxQueue;
+  std::map<uint64_t, shared_ptr<const Data>> m_validatedSegments; ///< out-of-order segments
 };
 
 } // namespace util
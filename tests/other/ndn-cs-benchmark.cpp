@@ -0,0 +1,336 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-cs-benchmark.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ns3/ndnSIM/model/cs/ndn-content-store.hpp"
+#include "ns3/ndnSIM/model/cs/ndn-cs-policy-probability.hpp"
+#include "ns3/ndnSIM/model/cs/ndn-cs-policy-freshness.hpp"
+#include "ns3/ndnSIM/model/cs/ndn-cs-policy-lifetime-stats.hpp"
+#include "ns3/ndnSIM/NFD/daemon/table/cs.hpp"
+#include "ns3/ndnSIM/NFD/daemon/table/cs-policy-lru.hpp"
+#include "ns3/ndnSIM/NFD/daemon/table/cs-policy-priority-fifo.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * Measures the throughput of the old (ndnSIM) content stores and of NFD's content store with
+ * each of its policies (as set with StackHelper::setPolicy), without any simulation.
+ *
+ * Each policy is first filled with cs-size Data packets, then looked up with Interests
+ * drawn from a Zipf-Mandelbrot distribution over a catalog of n-contents names:
+ *
+ *  - in the hit phase, the catalog is the cached content, so that every Interest is a hit
+ *  - in the Zipf phase, the catalog is larger than the cache, and every miss is followed by
+ *    the insertion of the missing Data, as the forwarder does when the Data comes back
+ *
+ * With --copy, every hit is copied, as the content stores did before Lookup returned the
+ * cached Data itself.  With --freshness, Data packets have a FreshnessPeriod, which the
+ * freshness policies have to track (nothing expires, as the simulation does not run).
+ * With --full-name, the Interests looked up in NFD's content store carry the full Name of the
+ * Data, including its implicit digest.
+ *
+ * Both exact Names and full Names are answered from the exact-match index of NFD's content
+ * store, whose advantage over the ordered table grows with the store, e.g. with --cs-size=200000.
+ *
+ *     ./waf --run "ndn-cs-benchmark --cs-size=10000 --n-contents=100000"
+ */
+class CsBenchmark {
+public:
+  CsBenchmark()
+    : m_csSize(10000)
+    , m_nContents(100000)
+    , m_nLookups(1000000)
+    , m_q(0.0)
+    , m_s(0.8)
+    , m_payloadSize(1024)
+    , m_shouldCopy(false)
+    , m_freshness(0)
+    , m_cacheProbability(0.5)
+    , m_useFullName(false)
+  {
+  }
+
+  int
+  run(int argc, char* argv[]);
+
+private:
+  struct Result {
+    double lookupsPerSecond;
+    double hitRatio;
+  };
+
+  shared_ptr<Data>
+  makeData(uint32_t seq) const;
+
+  /**
+   * @brief Draw m_nLookups content sequence numbers in [0, nContents)
+   */
+  std::vector<uint32_t>
+  makeWorkload(uint32_t nContents) const;
+
+  Result
+  measure(Ptr<ContentStore> cs, const std::vector<shared_ptr<Interest>>& interests,
+          const std::vector<shared_ptr<Data>>& datas, const std::vector<uint32_t>& workload);
+
+  Ptr<ContentStore>
+  createCs(const std::string& policy) const;
+
+  Result
+  measure(nfd::Cs& cs, const std::vector<shared_ptr<Interest>>& interests,
+          const std::vector<shared_ptr<Data>>& datas, const std::vector<uint32_t>& workload);
+
+  std::unique_ptr<nfd::Cs>
+  createNfdCs(const std::string& policy) const;
+
+private:
+  size_t m_csSize;
+  uint32_t m_nContents;
+  uint32_t m_nLookups;
+  double m_q;
+  double m_s;
+  uint32_t m_payloadSize;
+  bool m_shouldCopy;
+  uint32_t m_freshness;
+  double m_cacheProbability;
+  bool m_useFullName;
+};
+
+shared_ptr<Data>
+CsBenchmark::makeData(uint32_t seq) const
+{
+  auto data = make_shared<Data>(Name("/cs/benchmark").appendSequenceNumber(seq));
+  data->setContent(make_shared< ::ndn::Buffer>(m_payloadSize));
+  if (m_freshness > 0) {
+    data->setFreshnessPeriod(time::milliseconds(m_freshness));
+  }
+
+  Signature signature;
+  signature.setInfo(SignatureInfo(static_cast< ::ndn::tlv::SignatureTypeValue>(255)));
+  signature.setValue(::ndn::nonNegativeIntegerBlock(::ndn::tlv::SignatureValue, 0));
+  data->setSignature(signature);
+
+  data->wireEncode();
+  return data;
+}
+
+std::vector<uint32_t>
+CsBenchmark::makeWorkload(uint32_t nContents) const
+{
+  // cumulative Zipf-Mandelbrot probabilities, as in ConsumerZipfMandelbrot
+  std::vector<double> cdf(nContents);
+  double sum = 0;
+  for (uint32_t i = 0; i < nContents; ++i) {
+    sum += 1.0 / std::pow(i + 1 + m_q, m_s);
+    cdf[i] = sum;
+  }
+
+  Ptr<UniformRandomVariable> random = CreateObject<UniformRandomVariable>();
+  std::vector<uint32_t> workload(m_nLookups);
+  for (uint32_t& seq : workload) {
+    double p = random->GetValue(0, sum);
+    seq = std::min<uint32_t>(std::upper_bound(cdf.begin(), cdf.end(), p) - cdf.begin(),
+                             nContents - 1);
+  }
+  return workload;
+}
+
+CsBenchmark::Result
+CsBenchmark::measure(Ptr<ContentStore> cs,
+                     const std::vector<shared_ptr<Interest>>& interests,
+                     const std::vector<shared_ptr<Data>>& datas,
+                     const std::vector<uint32_t>& workload)
+{
+  uint64_t nHits = 0;
+
+  auto begin = std::chrono::steady_clock::now();
+  for (uint32_t seq : workload) {
+    shared_ptr<const Data> match = cs->Lookup(interests[seq]);
+    if (match != nullptr) {
+      ++nHits;
+      if (m_shouldCopy) {
+        match = make_shared<Data>(*match);
+      }
+      // what a face does with the Data: reuse its wire encoding
+      match->wireEncode();
+    }
+    else {
+      cs->Add(datas[seq]);
+    }
+  }
+  auto end = std::chrono::steady_clock::now();
+
+  double seconds = std::chrono::duration<double>(end - begin).count();
+  return Result{workload.size() / seconds, static_cast<double>(nHits) / workload.size()};
+}
+
+Ptr<ContentStore>
+CsBenchmark::createCs(const std::string& policy) const
+{
+  ObjectFactory factory;
+  factory.SetTypeId(policy);
+  factory.Set("MaxSize", StringValue(std::to_string(m_csSize)));
+
+  Ptr<ContentStore> cs = factory.Create<ContentStore>();
+  for (uint32_t seq = 0; seq < m_csSize; ++seq) {
+    cs->Add(makeData(seq));
+  }
+  return cs;
+}
+
+CsBenchmark::Result
+CsBenchmark::measure(nfd::Cs& cs,
+                     const std::vector<shared_ptr<Interest>>& interests,
+                     const std::vector<shared_ptr<Data>>& datas,
+                     const std::vector<uint32_t>& workload)
+{
+  uint64_t nHits = 0;
+
+  auto begin = std::chrono::steady_clock::now();
+  for (uint32_t seq : workload) {
+    // as in the incoming Interest pipeline of the forwarder
+    cs.find(*interests[seq],
+            [&nHits] (const Interest&, const Data& match) {
+              ++nHits;
+              match.wireEncode();
+            },
+            [&cs, &datas, seq] (const Interest&) {
+              cs.insert(*datas[seq]);
+            });
+  }
+  auto end = std::chrono::steady_clock::now();
+
+  double seconds = std::chrono::duration<double>(end - begin).count();
+  return Result{workload.size() / seconds, static_cast<double>(nHits) / workload.size()};
+}
+
+std::unique_ptr<nfd::Cs>
+CsBenchmark::createNfdCs(const std::string& policy) const
+{
+  auto makeLru = [] { return std::unique_ptr<nfd::cs::Policy>(new nfd::cs::LruPolicy()); };
+
+  std::unique_ptr<nfd::cs::Policy> csPolicy;
+  if (policy == "nfd::cs::lru") {
+    csPolicy = makeLru();
+  }
+  else if (policy == "nfd::cs::priority_fifo") {
+    csPolicy.reset(new nfd::cs::PriorityFifoPolicy());
+  }
+  else if (policy == "nfd::cs::probability::lru") {
+    csPolicy.reset(new cs::ProbabilityPolicy(makeLru(), m_cacheProbability));
+  }
+  else if (policy == "nfd::cs::freshness::lru") {
+    csPolicy.reset(new cs::FreshnessPolicy(makeLru()));
+  }
+  else if (policy == "nfd::cs::lifetime_stats::lru") {
+    csPolicy.reset(new cs::LifetimeStatsPolicy(makeLru()));
+  }
+  else {
+    NS_FATAL_ERROR("Unknown policy " << policy);
+  }
+
+  std::unique_ptr<nfd::Cs> cs(new nfd::Cs(m_csSize, std::move(csPolicy)));
+  for (uint32_t seq = 0; seq < m_csSize; ++seq) {
+    cs->insert(*makeData(seq));
+  }
+  return cs;
+}
+
+int
+CsBenchmark::run(int argc, char* argv[])
+{
+  CommandLine cmd;
+  cmd.AddValue("cs-size", "Maximum number of cached packets", m_csSize);
+  cmd.AddValue("n-contents", "Number of contents in the Zipf phase", m_nContents);
+  cmd.AddValue("lookups", "Number of lookups per phase", m_nLookups);
+  cmd.AddValue("q", "Zipf-Mandelbrot q parameter", m_q);
+  cmd.AddValue("s", "Zipf-Mandelbrot s parameter", m_s);
+  cmd.AddValue("payload-size", "Size of Data content", m_payloadSize);
+  cmd.AddValue("copy", "Copy every hit, as the content stores used to", m_shouldCopy);
+  cmd.AddValue("freshness", "FreshnessPeriod of Data, in milliseconds (0 for none)", m_freshness);
+  cmd.AddValue("cache-probability", "Probability of nfd::cs::probability::lru to cache Data",
+               m_cacheProbability);
+  cmd.AddValue("full-name", "Look up NFD's content store with full Names", m_useFullName);
+  cmd.Parse(argc, argv);
+
+  m_nContents = std::max<uint32_t>(m_nContents, m_csSize);
+
+  std::vector<shared_ptr<Interest>> interests;
+  std::vector<shared_ptr<Interest>> nfdInterests;
+  std::vector<shared_ptr<Data>> datas;
+  for (uint32_t seq = 0; seq < m_nContents; ++seq) {
+    datas.push_back(makeData(seq));
+    interests.push_back(make_shared<Interest>(datas.back()->getName()));
+    nfdInterests.push_back(m_useFullName ? make_shared<Interest>(datas.back()->getFullName()) :
+                                           interests.back());
+  }
+
+  std::vector<uint32_t> hitWorkload = makeWorkload(m_csSize);
+  std::vector<uint32_t> zipfWorkload = makeWorkload(m_nContents);
+
+  std::cout << "Policy"
+            << "\t"
+            << "HitLookupsPerSecond"
+            << "\t"
+            << "ZipfLookupsPerSecond"
+            << "\t"
+            << "ZipfHitRatio"
+            << "\n";
+
+  for (const std::string& policy : {"ns3::ndn::cs::Lru", "ns3::ndn::cs::Lfu",
+                                    "ns3::ndn::cs::BucketLfu", "ns3::ndn::cs::TinyLfu",
+                                    "ns3::ndn::cs::Fifo", "ns3::ndn::cs::Random"}) {
+    Result hit = measure(createCs(policy), interests, datas, hitWorkload);
+    Result zipf = measure(createCs(policy), interests, datas, zipfWorkload);
+
+    std::cout << policy << "\t" << hit.lookupsPerSecond << "\t" << zipf.lookupsPerSecond << "\t"
+              << zipf.hitRatio << "\n";
+  }
+
+  for (const std::string& policy : {"nfd::cs::lru", "nfd::cs::priority_fifo",
+                                    "nfd::cs::probability::lru", "nfd::cs::freshness::lru",
+                                    "nfd::cs::lifetime_stats::lru"}) {
+    Result hit = measure(*createNfdCs(policy), nfdInterests, datas, hitWorkload);
+    Result zipf = measure(*createNfdCs(policy), nfdInterests, datas, zipfWorkload);
+
+    std::cout << policy << "\t" << hit.lookupsPerSecond << "\t" << zipf.lookupsPerSecond << "\t"
+              << zipf.hitRatio << "\n";
+  }
+
+  return 0;
+}
+
+} // namespace ndn
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  ns3::ndn::CsBenchmark benchmark;
+  return benchmark.run(argc, argv);
+}
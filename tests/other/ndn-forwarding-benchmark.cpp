@@ -0,0 +1,176 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-forwarding-benchmark.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ns3/ndnSIM/NFD/daemon/fw/forwarder.hpp"
+#include "ns3/ndnSIM/NFD/daemon/face/null-face.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * Measures the per-packet cost of NFD's forwarding pipelines with each of the built-in
+ * strategies, with and without fixed strategy dispatch (see
+ * StackHelper::enableFixedStrategyDispatch), outside of any network simulation.
+ *
+ * Interests arrive on one face of a standalone forwarder and are forwarded to n-upstreams
+ * faces, and each is satisfied by a Data from the first upstream.  Faces drop everything
+ * they send.  Names have depth components below the prefix on which the strategy is chosen,
+ * so that the effective strategy lookup walks that many name tree entries.
+ *
+ *     ./waf --run "ndn-forwarding-benchmark --packets=1000000 --depth=4"
+ */
+class ForwardingBenchmark {
+public:
+  ForwardingBenchmark()
+    : m_nPackets(1000000)
+    , m_batchSize(10000)
+    , m_depth(4)
+    , m_nUpstreams(2)
+  {
+  }
+
+  int
+  run(int argc, char* argv[]);
+
+private:
+  /**
+   * @return nanoseconds of wall-clock time per Interest-Data exchange
+   */
+  double
+  measure(const Name& strategy, bool isFixedStrategyDispatchEnabled);
+
+private:
+  uint32_t m_nPackets;
+  uint32_t m_batchSize;
+  uint32_t m_depth;
+  uint32_t m_nUpstreams;
+};
+
+double
+ForwardingBenchmark::measure(const Name& strategy, bool isFixedStrategyDispatchEnabled)
+{
+  nfd::Forwarder forwarder;
+  forwarder.setFixedStrategyDispatch(isFixedStrategyDispatchEnabled);
+
+  shared_ptr<nfd::Face> downstream = nfd::face::makeNullFace();
+  forwarder.addFace(downstream);
+
+  Name prefix("/forwarding/benchmark");
+  shared_ptr<nfd::fib::Entry> fibEntry = forwarder.getFib().insert(prefix).first;
+  std::vector<shared_ptr<nfd::Face>> upstreams;
+  for (uint32_t i = 0; i < m_nUpstreams; ++i) {
+    upstreams.push_back(nfd::face::makeNullFace());
+    forwarder.addFace(upstreams.back());
+    fibEntry->addNextHop(upstreams.back(), i);
+  }
+
+  forwarder.getStrategyChoice().insert(prefix, strategy);
+
+  Name base(prefix);
+  for (uint32_t i = 0; i < m_depth; ++i) {
+    base.append("component");
+  }
+
+  Signature signature;
+  signature.setInfo(SignatureInfo(static_cast< ::ndn::tlv::SignatureTypeValue>(255)));
+  signature.setValue(::ndn::nonNegativeIntegerBlock(::ndn::tlv::SignatureValue, 0));
+
+  double seconds = 0;
+  for (uint32_t seq = 0; seq < m_nPackets;) {
+    // packets are created outside of the measured loop
+    std::vector<shared_ptr<Interest>> interests;
+    std::vector<shared_ptr<Data>> datas;
+    for (uint32_t i = 0; i < m_batchSize && seq < m_nPackets; ++i, ++seq) {
+      Name name = Name(base).appendSequenceNumber(seq);
+      interests.push_back(make_shared<Interest>(name));
+      interests.back()->setNonce(seq);
+      interests.back()->wireEncode();
+
+      datas.push_back(make_shared<Data>(name));
+      datas.back()->setSignature(signature);
+      datas.back()->wireEncode();
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < interests.size(); ++i) {
+      forwarder.startProcessInterest(*downstream, *interests[i]);
+      forwarder.startProcessData(*upstreams.front(), *datas[i]);
+    }
+    // let straggler timers erase the satisfied PIT entries
+    Simulator::Stop(Seconds(1));
+    Simulator::Run();
+    auto end = std::chrono::steady_clock::now();
+
+    seconds += std::chrono::duration<double>(end - begin).count();
+  }
+
+  return seconds * 1e9 / m_nPackets;
+}
+
+int
+ForwardingBenchmark::run(int argc, char* argv[])
+{
+  CommandLine cmd;
+  cmd.AddValue("packets", "Number of Interest-Data exchanges per measurement", m_nPackets);
+  cmd.AddValue("batch-size", "Number of exchanges between runs of the scheduler", m_batchSize);
+  cmd.AddValue("depth", "Number of name components below the strategy prefix", m_depth);
+  cmd.AddValue("n-upstreams", "Number of nexthops of the FIB entry", m_nUpstreams);
+  cmd.Parse(argc, argv);
+
+  m_batchSize = std::max<uint32_t>(m_batchSize, 1);
+  m_nUpstreams = std::max<uint32_t>(m_nUpstreams, 1);
+
+  std::cout << "Strategy"
+            << "\t"
+            << "NanosecondsPerPacket"
+            << "\t"
+            << "NanosecondsPerPacket (fixed dispatch)"
+            << "\n";
+
+  for (const std::string& strategy : {"/localhost/nfd/strategy/best-route",
+                                      "/localhost/nfd/strategy/multicast",
+                                      "/localhost/nfd/strategy/ncc"}) {
+    double dynamic = measure(strategy, false);
+    double fixed = measure(strategy, true);
+
+    std::cout << strategy << "\t" << dynamic << "\t" << fixed << "\n";
+  }
+
+  Simulator::Destroy();
+  return 0;
+}
+
+} // namespace ndn
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  ns3::ndn::ForwardingBenchmark benchmark;
+  return benchmark.run(argc, argv);
+}
@@ -0,0 +1,187 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-trie-benchmark.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ns3/ndnSIM/utils/mem-usage.hpp"
+#include "ns3/ndnSIM/utils/trie/trie-with-policy.hpp"
+#include "ns3/ndnSIM/utils/trie/lru-policy.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * Measures the memory footprint and lookup speed of the name trie used by the old (ndnSIM)
+ * content stores, without any simulation.
+ *
+ * For each name shape, n-entries names are inserted in an unbounded LRU trie, then looked up
+ * in random order, both with the longest prefix match done by ContentStore::Lookup and with
+ * exact matches of their parent prefixes:
+ *
+ *  - flat: /prefix/<seq>, all the entries are children of the same node
+ *  - chain: /ndn/edu/ucla/video/<version>/<segment>, long single-child chains
+ *  - tree: /site/<100>/<40>/<n>, moderate fan-out at every level
+ *
+ *     ./waf --run "ndn-trie-benchmark --n-entries=200000"
+ */
+class TrieBenchmark {
+public:
+  TrieBenchmark()
+    : m_nEntries(200000)
+    , m_nRounds(5)
+  {
+  }
+
+  int
+  run(int argc, char* argv[]);
+
+private:
+  struct Entry {
+  };
+
+  typedef ndnSIM::trie_with_policy<Name, ndnSIM::pointer_payload_traits<Entry>,
+                                   ndnSIM::lru_policy_traits> Trie;
+
+  void
+  measure(const std::string& shape, const std::vector<Name>& names);
+
+  template<class Lookup>
+  double
+  lookupsPerSecond(const std::vector<Name>& names, Lookup lookup) const;
+
+private:
+  uint32_t m_nEntries;
+  uint32_t m_nRounds;
+};
+
+template<class Lookup>
+double
+TrieBenchmark::lookupsPerSecond(const std::vector<Name>& names, Lookup lookup) const
+{
+  std::vector<uint32_t> order(names.size());
+  for (uint32_t i = 0; i < order.size(); ++i) {
+    order[i] = i;
+  }
+  std::shuffle(order.begin(), order.end(), std::mt19937(1));
+
+  uint64_t nFound = 0;
+  auto begin = std::chrono::steady_clock::now();
+  for (uint32_t round = 0; round < m_nRounds; ++round) {
+    for (uint32_t i : order) {
+      nFound += lookup(names[i]);
+    }
+  }
+  auto end = std::chrono::steady_clock::now();
+
+  if (nFound != static_cast<uint64_t>(m_nRounds) * names.size()) {
+    NS_FATAL_ERROR("Only " << nFound << " lookups out of " << m_nRounds * names.size()
+                           << " found their entry");
+  }
+
+  double seconds = std::chrono::duration<double>(end - begin).count();
+  return m_nRounds * names.size() / seconds;
+}
+
+void
+TrieBenchmark::measure(const std::string& shape, const std::vector<Name>& names)
+{
+  Entry entry;
+
+  int64_t memBefore = MemUsage::Get();
+  auto begin = std::chrono::steady_clock::now();
+
+  Trie* trie = new Trie();
+  trie->getPolicy().set_max_size(0);
+  for (const Name& name : names) {
+    trie->insert(name, &entry);
+  }
+
+  auto end = std::chrono::steady_clock::now();
+  int64_t memAfter = MemUsage::Get();
+
+  double insertsPerSecond =
+    names.size() / std::chrono::duration<double>(end - begin).count();
+
+  double prefixLookups = lookupsPerSecond(names, [trie](const Name& name) {
+    return trie->deepest_prefix_match(name) != trie->end();
+  });
+
+  double exactLookups = lookupsPerSecond(names, [trie](const Name& name) {
+    return trie->find_exact(name.getPrefix(-1)) != trie->end();
+  });
+
+  delete trie;
+
+  std::cout << shape << "\t" << static_cast<double>(memAfter - memBefore) / names.size() << "\t"
+            << insertsPerSecond << "\t" << prefixLookups << "\t" << exactLookups << "\n";
+}
+
+int
+TrieBenchmark::run(int argc, char* argv[])
+{
+  CommandLine cmd;
+  cmd.AddValue("n-entries", "Number of names inserted in the trie", m_nEntries);
+  cmd.AddValue("rounds", "Number of times every name is looked up", m_nRounds);
+  cmd.Parse(argc, argv);
+
+  std::vector<Name> flat, chain, tree;
+  for (uint32_t i = 0; i < m_nEntries; ++i) {
+    flat.push_back(Name("/prefix").appendSequenceNumber(i));
+    chain.push_back(Name("/ndn/edu/ucla/video").appendVersion(i).appendSegment(0));
+    tree.push_back(Name("/site")
+                     .append(std::to_string(i % 100))
+                     .append(std::to_string(i / 100 % 40))
+                     .append(std::to_string(i)));
+  }
+
+  std::cout << "Names"
+            << "\t"
+            << "BytesPerEntry"
+            << "\t"
+            << "InsertsPerSecond"
+            << "\t"
+            << "PrefixLookupsPerSecond"
+            << "\t"
+            << "ExactLookupsPerSecond"
+            << "\n";
+
+  measure("flat", flat);
+  measure("chain", chain);
+  measure("tree", tree);
+
+  return 0;
+}
+
+} // namespace ndn
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  ns3::ndn::TrieBenchmark benchmark;
+  return benchmark.run(argc, argv);
+}
@@ -0,0 +1,116 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "NFD/daemon/table/cs.hpp"
+
+#include "helper/ndn-stack-helper.hpp"
+
+#include "../../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class CsFixture : public CleanupFixture
+{
+public:
+  static shared_ptr<Data>
+  makeData(const Name& name, const std::string& content = "")
+  {
+    auto data = make_shared<Data>(name);
+    data->setFreshnessPeriod(time::seconds(10));
+    data->setContent(reinterpret_cast<const uint8_t*>(content.data()), content.size());
+    StackHelper::getKeyChain().sign(*data);
+    return data;
+  }
+
+  /** \return full Name of the Data found for \p interest, or an empty Name on a miss
+   */
+  static Name
+  find(const nfd::Cs& cs, const Interest& interest)
+  {
+    Name found;
+    cs.find(interest,
+            [&found] (const Interest&, const Data& data) { found = data.getFullName(); },
+            [] (const Interest&) {});
+    return found;
+  }
+};
+
+BOOST_FIXTURE_TEST_SUITE(NfdDaemonTableCs, CsFixture)
+
+BOOST_AUTO_TEST_CASE(ExactMatch)
+{
+  nfd::Cs cs(10);
+  shared_ptr<Data> a1 = makeData("/A/1");
+  shared_ptr<Data> a2 = makeData("/A/2");
+  shared_ptr<Data> b = makeData("/B");
+  cs.insert(*a1);
+  cs.insert(*a2);
+  cs.insert(*b);
+
+  // Names that equal a stored Name, and full Names, are answered by the exact-match index
+  BOOST_CHECK_EQUAL(find(cs, Interest("/A/2")), a2->getFullName());
+  BOOST_CHECK_EQUAL(find(cs, Interest(b->getFullName())), b->getFullName());
+  BOOST_CHECK_EQUAL(find(cs, Interest(makeData("/B", "other")->getFullName())), Name());
+  BOOST_CHECK_EQUAL(find(cs, Interest("/A/3")), Name());
+
+  // prefix and rightmost lookups still use the ordered table
+  BOOST_CHECK_EQUAL(find(cs, Interest("/A")), a1->getFullName());
+  Interest rightmost("/A");
+  rightmost.setChildSelector(1);
+  BOOST_CHECK_EQUAL(find(cs, rightmost), a2->getFullName());
+}
+
+// The exact-match index must follow entries as they are evicted by the policy.
+BOOST_AUTO_TEST_CASE(ExactIndexEviction)
+{
+  // two Data with the same Name; the index points to the leftmost one
+  shared_ptr<Data> first = makeData("/A", "1");
+  shared_ptr<Data> second = makeData("/A", "2");
+  if (second->getFullName() < first->getFullName()) {
+    std::swap(first, second);
+  }
+
+  nfd::Cs cs(3);
+  cs.insert(*first);
+  cs.insert(*second);
+  cs.insert(*makeData("/B"));
+  BOOST_CHECK_EQUAL(find(cs, Interest("/A")), first->getFullName());
+
+  // FIFO eviction of the leftmost entry moves the index to the next entry with the same Name
+  cs.insert(*makeData("/C"));
+  BOOST_CHECK_EQUAL(cs.size(), 3);
+  BOOST_CHECK_EQUAL(find(cs, Interest(first->getFullName())), Name());
+  BOOST_CHECK_EQUAL(find(cs, Interest("/A")), second->getFullName());
+
+  // the last entry with that Name removes it from the index
+  cs.insert(*makeData("/D"));
+  BOOST_CHECK_EQUAL(find(cs, Interest("/A")), Name());
+  BOOST_CHECK(!find(cs, Interest("/B")).empty());
+
+  // and reinserting adds it back
+  cs.insert(*first);
+  BOOST_CHECK_EQUAL(find(cs, Interest("/A")), first->getFullName());
+  BOOST_CHECK_EQUAL(find(cs, Interest("/B")), Name());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
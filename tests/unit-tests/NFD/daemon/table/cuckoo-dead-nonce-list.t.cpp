@@ -0,0 +1,158 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "NFD/daemon/table/cuckoo-dead-nonce-list.hpp"
+
+#include "../../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+using nfd::CuckooDeadNonceList;
+
+BOOST_FIXTURE_TEST_SUITE(NfdDaemonTableCuckooDeadNonceList, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(Basic)
+{
+  Name nameA("ndn:/A");
+  Name nameB("ndn:/B");
+  const uint32_t nonce1 = 0x53b4eaa8;
+  const uint32_t nonce2 = 0x1f46372b;
+
+  CuckooDeadNonceList dnl;
+  BOOST_CHECK_EQUAL(dnl.size(), 0);
+  BOOST_CHECK_EQUAL(dnl.has(nameA, nonce1), false);
+
+  dnl.add(nameA, nonce1);
+  BOOST_CHECK_EQUAL(dnl.size(), 1);
+  BOOST_CHECK_EQUAL(dnl.has(nameA, nonce1), true);
+  BOOST_CHECK_EQUAL(dnl.has(nameA, nonce2), false);
+  BOOST_CHECK_EQUAL(dnl.has(nameB, nonce1), false);
+}
+
+BOOST_AUTO_TEST_CASE(InvalidArguments)
+{
+  BOOST_CHECK_THROW(CuckooDeadNonceList dnl(time::milliseconds::zero()), std::invalid_argument);
+  BOOST_CHECK_THROW(CuckooDeadNonceList dnl(time::seconds(6), 4), std::invalid_argument);
+  BOOST_CHECK_THROW(CuckooDeadNonceList dnl(time::seconds(6), 33), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(Overflow)
+{
+  CuckooDeadNonceList dnl;
+  Name name("ndn:/N");
+  size_t initialMemoryUsage = dnl.getMemoryUsage();
+
+  // more nonces than the initial filters hold
+  const uint32_t N_NONCES = 100000;
+  for (uint32_t nonce = 0; nonce < N_NONCES; ++nonce) {
+    dnl.add(name, nonce);
+  }
+  BOOST_CHECK_EQUAL(dnl.size(), N_NONCES);
+  BOOST_CHECK_GT(dnl.getMemoryUsage(), initialMemoryUsage);
+
+  // no false negatives
+  size_t nFound = 0;
+  for (uint32_t nonce = 0; nonce < N_NONCES; ++nonce) {
+    nFound += dnl.has(name, nonce);
+  }
+  BOOST_CHECK_EQUAL(nFound, N_NONCES);
+}
+
+BOOST_AUTO_TEST_CASE(FalsePositiveRate)
+{
+  CuckooDeadNonceList dnl(CuckooDeadNonceList::DEFAULT_LIFETIME, 12);
+  Name name("ndn:/N");
+
+  for (uint32_t nonce = 0; nonce < 1000; ++nonce) {
+    dnl.add(name, nonce);
+  }
+
+  const uint32_t N_PROBES = 100000;
+  size_t nFalsePositives = 0;
+  for (uint32_t nonce = 1000; nonce < 1000 + N_PROBES; ++nonce) {
+    nFalsePositives += dnl.has(name, nonce);
+  }
+  BOOST_CHECK_LE(static_cast<double>(nFalsePositives) / N_PROBES,
+                 dnl.getFalsePositiveBound() * 1.5);
+}
+
+class CuckooLifetimeFixture : public CleanupFixture
+{
+protected:
+  CuckooLifetimeFixture()
+    : dnl(time::milliseconds(200))
+    , name("ndn:/N")
+  {
+  }
+
+  /** \brief advance simulated time by lifetime*t, inserting \p nNonces every 1/20 lifetime
+   */
+  void
+  advanceClocksByLifetime(double t, size_t nNonces = 0)
+  {
+    for (int step = 0; step < t * 20; ++step) {
+      for (size_t i = 0; i < nNonces; ++i) {
+        dnl.add(name, ++lastNonce);
+      }
+      Simulator::Stop(MilliSeconds(10));
+      Simulator::Run();
+    }
+  }
+
+protected:
+  CuckooDeadNonceList dnl;
+  Name name;
+  uint32_t lastNonce = 0;
+};
+
+BOOST_FIXTURE_TEST_CASE(Lifetime, CuckooLifetimeFixture)
+{
+  BOOST_CHECK(dnl.getLifetime() == time::milliseconds(200));
+  this->advanceClocksByLifetime(10.0, 2);
+
+  Name nameC("ndn:/C");
+  const uint32_t nonceC = 0x25390656;
+  BOOST_CHECK_EQUAL(dnl.has(nameC, nonceC), false);
+  dnl.add(nameC, nonceC);
+  BOOST_CHECK_EQUAL(dnl.has(nameC, nonceC), true);
+
+  this->advanceClocksByLifetime(0.5); // -50%, entry should exist
+  BOOST_CHECK_EQUAL(dnl.has(nameC, nonceC), true);
+
+  this->advanceClocksByLifetime(1.0); // +50%, entry should be gone
+  BOOST_CHECK_EQUAL(dnl.has(nameC, nonceC), false);
+}
+
+BOOST_FIXTURE_TEST_CASE(Resize, CuckooLifetimeFixture)
+{
+  // steady high rate: partitions are resized once, then the memory usage stays the same
+  const size_t N_NONCES_PER_STEP = 1000;
+  this->advanceClocksByLifetime(3.0, N_NONCES_PER_STEP);
+  size_t memoryUsage = dnl.getMemoryUsage();
+
+  this->advanceClocksByLifetime(3.0, N_NONCES_PER_STEP);
+  BOOST_CHECK_LE(dnl.getMemoryUsage(), memoryUsage);
+  BOOST_CHECK_LE(dnl.size(), N_NONCES_PER_STEP * 20 * 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,61 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "NFD/daemon/table/strategy-choice.hpp"
+#include "NFD/daemon/fw/forwarder.hpp"
+#include "NFD/daemon/fw/best-route-strategy2.hpp"
+#include "NFD/daemon/fw/multicast-strategy.hpp"
+
+#include "../../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(NfdDaemonTableStrategyChoice, CleanupFixture)
+
+// The version changes whenever the effective strategy of some prefix changes, which
+// invalidates the strategies cached in PIT entries by the fixed strategy dispatch.
+BOOST_AUTO_TEST_CASE(GetVersion)
+{
+  nfd::Forwarder forwarder;
+  const Name& nameP = nfd::fw::BestRouteStrategy2::STRATEGY_NAME;
+  const Name& nameQ = nfd::fw::MulticastStrategy::STRATEGY_NAME;
+
+  nfd::StrategyChoice& table = forwarder.getStrategyChoice();
+  BOOST_CHECK(table.insert("ndn:/", nameP));
+  uint64_t version = table.getVersion();
+
+  // effective strategy of no prefix is changed
+  BOOST_CHECK(table.insert("ndn:/", nameP));
+  BOOST_CHECK(table.insert("ndn:/A", nameP));
+  table.erase("ndn:/A");
+  BOOST_CHECK_EQUAL(table.getVersion(), version);
+
+  BOOST_CHECK(table.insert("ndn:/A", nameQ));
+  BOOST_CHECK_GT(table.getVersion(), version);
+  version = table.getVersion();
+
+  table.erase("ndn:/A");
+  BOOST_CHECK_GT(table.getVersion(), version);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
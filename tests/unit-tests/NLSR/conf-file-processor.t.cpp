@@ -0,0 +1,55 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "conf-file-processor.hpp"
+#include "nlsr.hpp"
+
+#include "nlsr-app-fixture.hpp"
+
+namespace nlsr {
+namespace test {
+
+BOOST_FIXTURE_TEST_SUITE(NlsrConfFileProcessor, ns3::ndn::NlsrAppFixture)
+
+BOOST_AUTO_TEST_CASE(ParsedTree)
+{
+  auto config = makeConfig("A", "B");
+  boost::property_tree::ptree original = *config;
+
+  // A.conf does not exist: the configuration is taken from the parsed tree only
+  auto app = installNlsr("A", config);
+  installNlsr("B", makeConfig("B", "A"));
+  advanceClocks(ns3::MilliSeconds(100));
+
+  Nlsr& nlsr = app->GetNlsr();
+  ConfParameter& conf = nlsr.getConfParameter();
+  BOOST_CHECK_EQUAL(conf.getRouterPrefix(), "/ndn/site/%C1.router/A");
+  BOOST_CHECK_EQUAL(conf.getFirstHelloInterval(), 10);
+  BOOST_CHECK_EQUAL(conf.getInfoInterestInterval(), 30);
+  BOOST_CHECK(nlsr.getAdjacencyList().isNeighbor("/ndn/site/%C1.router/B"));
+  BOOST_CHECK_EQUAL(nlsr.getNamePrefixList().getSize(), 1);
+
+  // the tree is shared with NlsrConfReader and left as it was parsed
+  BOOST_CHECK(*config == original);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace test
+} // namespace nlsr
@@ -0,0 +1,116 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "nlsr.hpp"
+
+#include "helper/ndn-link-control-helper.hpp"
+
+#include "ns3/point-to-point-channel.h"
+#include "ns3/point-to-point-net-device.h"
+
+#include "nlsr-app-fixture.hpp"
+
+namespace nlsr {
+namespace test {
+
+using ns3::ndn::LinkControlHelper;
+
+class FaceEventsFixture : public ns3::ndn::NlsrAppFixture
+{
+public:
+  FaceEventsFixture()
+    : routerB("/ndn/site/%C1.router/B")
+  {
+    auto configA = makeConfig("A", "B");
+    configA->put("neighbors.face-down-hold-down", 5);
+    auto configB = makeConfig("B", "A");
+    configB->put("neighbors.face-down-hold-down", 5);
+
+    appA = installNlsr("A", configA);
+    installNlsr("B", configB);
+
+    // after the first HELLO round
+    advanceClocks(ns3::Seconds(12));
+  }
+
+public:
+  ns3::Ptr<ns3::ndn::NlsrApp> appA;
+  ndn::Name routerB;
+};
+
+BOOST_FIXTURE_TEST_SUITE(NlsrFaceEvents, FaceEventsFixture)
+
+BOOST_AUTO_TEST_CASE(DownAndUp)
+{
+  Nlsr& nlsr = appA->GetNlsr();
+  AdjacencyList& neighbors = nlsr.getAdjacencyList();
+  BOOST_REQUIRE_EQUAL(neighbors.getStatusOfNeighbor(routerB), Adjacent::STATUS_ACTIVE);
+  uint64_t faceId = neighbors.findAdjacent(routerB)->getFaceId();
+  BOOST_REQUIRE_NE(faceId, 0);
+
+  // A link coming back up during the hold-down does not change the neighbor
+  LinkControlHelper::FailLink(getNode("A"), getNode("B"));
+  advanceClocks(ns3::Seconds(4));
+  BOOST_CHECK(!nlsr.isQuiescent());
+  BOOST_CHECK_EQUAL(neighbors.getStatusOfNeighbor(routerB), Adjacent::STATUS_ACTIVE);
+
+  LinkControlHelper::UpLink(getNode("A"), getNode("B"));
+  advanceClocks(ns3::Seconds(5));
+  BOOST_CHECK_EQUAL(neighbors.getStatusOfNeighbor(routerB), Adjacent::STATUS_ACTIVE);
+
+  // After the hold-down, the neighbor is INACTIVE without waiting for HELLO timeouts
+  LinkControlHelper::FailLink(getNode("A"), getNode("B"));
+  advanceClocks(ns3::Seconds(6));
+  BOOST_CHECK_EQUAL(neighbors.getStatusOfNeighbor(routerB), Adjacent::STATUS_INACTIVE);
+  BOOST_CHECK_EQUAL(neighbors.getTimedOutInterestCount(routerB),
+                    nlsr.getConfParameter().getInterestRetryNumber());
+  BOOST_CHECK_EQUAL(neighbors.findAdjacent(routerB)->getFaceId(), faceId);
+
+  // The neighbor is probed right away when the link comes back up, well before the next
+  // HELLO round at 40 seconds
+  LinkControlHelper::UpLink(getNode("A"), getNode("B"));
+  advanceClocks(ns3::Seconds(1));
+  BOOST_CHECK_EQUAL(neighbors.getStatusOfNeighbor(routerB), Adjacent::STATUS_ACTIVE);
+}
+
+BOOST_AUTO_TEST_CASE(LinkChangeAfterFaceDestroyed)
+{
+  Nlsr& nlsr = appA->GetNlsr();
+  AdjacencyList& neighbors = nlsr.getAdjacencyList();
+  BOOST_REQUIRE_EQUAL(neighbors.getStatusOfNeighbor(routerB), Adjacent::STATUS_ACTIVE);
+
+  ns3::Ptr<ns3::PointToPointNetDevice> netDevice =
+    ns3::DynamicCast<ns3::PointToPointNetDevice>(getNetDevice("A", "B"));
+  BOOST_REQUIRE(netDevice != nullptr);
+
+  getFace("A", "B")->close();
+  advanceClocks(ns3::Seconds(1));
+  BOOST_CHECK_EQUAL(neighbors.getStatusOfNeighbor(routerB), Adjacent::STATUS_INACTIVE);
+  BOOST_CHECK_EQUAL(neighbors.findAdjacent(routerB)->getFaceId(), 0);
+
+  // attaching the NetDevice to a channel notifies the link service of the destroyed face
+  BOOST_CHECK_NO_THROW(netDevice->Attach(ns3::CreateObject<ns3::PointToPointChannel>()));
+  BOOST_CHECK_NO_THROW(advanceClocks(ns3::Seconds(6)));
+  BOOST_CHECK_EQUAL(neighbors.getStatusOfNeighbor(routerB), Adjacent::STATUS_INACTIVE);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace test
+} // namespace nlsr
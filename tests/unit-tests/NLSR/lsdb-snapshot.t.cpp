@@ -0,0 +1,166 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "lsdb-snapshot.hpp"
+#include "nlsr.hpp"
+
+#include "nlsr-app-fixture.hpp"
+
+#include <sstream>
+
+namespace nlsr {
+namespace test {
+
+const std::string ROUTER_CONFIG =
+  "general\n"
+  "{\n"
+  "  network /ndn/\n"
+  "  site /memphis.edu/\n"
+  "  router /cs/pollux/\n"
+  "}\n"
+  "neighbors\n"
+  "{\n"
+  "  neighbor\n"
+  "  {\n"
+  "    name /ndn/memphis.edu/cs/castor\n"
+  "    face-uri udp4://10.0.0.1\n"
+  "    link-cost 20\n"
+  "  }\n"
+  "  neighbor\n"
+  "  {\n"
+  "    name /ndn/memphis.edu/cs/mira\n"
+  "    face-uri udp4://10.0.0.2\n"
+  "  }\n"
+  "}\n"
+  "hyperbolic\n"
+  "{\n"
+  "  state dry-run\n"
+  "  radius 123.456\n"
+  "  angle 1.45\n"
+  "}\n"
+  "advertising\n"
+  "{\n"
+  "  prefix /ndn/edu/memphis/cs/netlab\n"
+  "}\n";
+
+BOOST_FIXTURE_TEST_SUITE(NlsrLsdbSnapshot, ns3::ndn::NlsrAppFixture)
+
+BOOST_AUTO_TEST_CASE(FromConfig)
+{
+  boost::property_tree::ptree config;
+  std::istringstream input(ROUTER_CONFIG);
+  boost::property_tree::read_info(input, config);
+
+  LsdbSnapshot snapshot;
+  snapshot.addRouter(config);
+
+  // Round trip through the snapshot format
+  std::ostringstream output;
+  snapshot.save(output);
+  std::istringstream savedInput(output.str());
+  LsdbSnapshot loaded;
+  loaded.load(savedInput);
+
+  for (const LsdbSnapshot* s : {&snapshot, &loaded}) {
+    BOOST_REQUIRE_EQUAL(s->getNameLsas().size(), 1);
+    NameLsa nameLsa = s->getNameLsas().front();
+    BOOST_CHECK_EQUAL(nameLsa.getOrigRouter(), "/ndn/memphis.edu/cs/pollux");
+    BOOST_CHECK_EQUAL(nameLsa.getLsSeqNo(), 1);
+    BOOST_REQUIRE_EQUAL(nameLsa.getNpl().getSize(), 1);
+    BOOST_CHECK_EQUAL(nameLsa.getNpl().getNameList().front(), "/ndn/edu/memphis/cs/netlab");
+
+    BOOST_REQUIRE_EQUAL(s->getAdjLsas().size(), 1);
+    AdjLsa adjLsa = s->getAdjLsas().front();
+    BOOST_CHECK_EQUAL(adjLsa.getLsSeqNo(), 1);
+    BOOST_CHECK_EQUAL(adjLsa.getNoLink(), 2);
+    BOOST_REQUIRE(adjLsa.getAdl().findAdjacent(ndn::Name("/ndn/memphis.edu/cs/castor")) != nullptr);
+    Adjacent castor = adjLsa.getAdl().getAdjacent("/ndn/memphis.edu/cs/castor");
+    BOOST_CHECK_EQUAL(castor.getConnectingFaceUri(), "udp4://10.0.0.1");
+    BOOST_CHECK_EQUAL(castor.getLinkCost(), 20);
+    Adjacent mira = adjLsa.getAdl().getAdjacent("/ndn/memphis.edu/cs/mira");
+    BOOST_CHECK_EQUAL(mira.getLinkCost(), Adjacent::DEFAULT_LINK_COST);
+
+    BOOST_REQUIRE_EQUAL(s->getCoordinateLsas().size(), 1);
+    BOOST_CHECK_CLOSE(s->getCoordinateLsas().front().getCorRadius(), 123.456, 0.0001);
+    BOOST_CHECK_CLOSE(s->getCoordinateLsas().front().getCorTheta(), 1.45, 0.0001);
+  }
+
+  std::istringstream invalid("router\n{\n  name-lsa\n  {\n  }\n}\n");
+  BOOST_CHECK_THROW(loaded.load(invalid), LsdbSnapshot::Error);
+}
+
+BOOST_AUTO_TEST_CASE(Restore)
+{
+  auto configA = makeConfig("A", "B");
+  auto configB = makeConfig("B", "A");
+
+  // the snapshot of the converged network, as NlsrConfReader::WriteLsdbSnapshot writes it
+  auto snapshot = std::make_shared<LsdbSnapshot>();
+  snapshot->addRouter(*configA);
+  snapshot->addRouter(*configB);
+
+  auto appA = installNlsr("A", configA, snapshot);
+  installNlsr("B", configB, snapshot);
+
+  advanceClocks(ns3::MilliSeconds(100));
+
+  Nlsr& nlsr = appA->GetNlsr();
+  ConfParameter& conf = nlsr.getConfParameter();
+  AdjacencyList& neighbors = nlsr.getAdjacencyList();
+
+  // Own LSAs keep their sequence numbers
+  BOOST_CHECK_EQUAL(nlsr.getSequencingManager().getNameLsaSeq(), 1);
+  BOOST_CHECK_EQUAL(nlsr.getSequencingManager().getAdjLsaSeq(), 1);
+
+  Lsdb& lsdb = nlsr.getLsdb();
+  NameLsa* ownNameLsa = lsdb.findNameLsa(ndn::Name(conf.getRouterPrefix()).append(NameLsa::TYPE_STRING));
+  BOOST_REQUIRE(ownNameLsa != nullptr);
+  BOOST_CHECK_EQUAL(ownNameLsa->getLsSeqNo(), 1);
+
+  ndn::Name routerB("/ndn/site/%C1.router/B");
+  AdjLsa* otherAdjLsa = lsdb.findAdjLsa(ndn::Name(routerB).append(AdjLsa::TYPE_STRING));
+  BOOST_REQUIRE(otherAdjLsa != nullptr);
+  BOOST_CHECK_EQUAL(otherAdjLsa->getLsSeqNo(), 1);
+  BOOST_CHECK(lsdb.findNameLsa(ndn::Name(routerB).append(NameLsa::TYPE_STRING)) != nullptr);
+
+  // Neighbors in the own adjacency LSA are ACTIVE without waiting for HELLOs
+  BOOST_CHECK_EQUAL(neighbors.getStatusOfNeighbor(routerB), Adjacent::STATUS_ACTIVE);
+
+  // The routing table is calculated without waiting for the routing calculation interval
+  BOOST_CHECK_EQUAL(nlsr.getRoutingTable().getNCalculations(), 1);
+  BOOST_CHECK(nlsr.getRoutingTable().findRoutingTableEntry(routerB) != nullptr);
+  BOOST_CHECK(!nlsr.getIsRouteCalculationScheduled());
+}
+
+BOOST_AUTO_TEST_CASE(RestoreUnknownRouter)
+{
+  auto configA = makeConfig("A", "B");
+
+  // the snapshot has no LSA of router A
+  auto snapshot = std::make_shared<LsdbSnapshot>();
+  snapshot->addRouter(*makeConfig("B", "A"));
+
+  installNlsr("A", configA, snapshot);
+  BOOST_CHECK_THROW(advanceClocks(ns3::MilliSeconds(100)), LsdbSnapshot::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace test
+} // namespace nlsr
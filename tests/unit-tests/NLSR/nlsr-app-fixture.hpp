@@ -0,0 +1,139 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDNSIM_TESTS_UNIT_TESTS_NLSR_NLSR_APP_FIXTURE_HPP
+#define NDNSIM_TESTS_UNIT_TESTS_NLSR_NLSR_APP_FIXTURE_HPP
+
+#include "apps/ndn-nlsr-app.hpp"
+#include "lsdb-snapshot.hpp"
+
+#include <boost/filesystem.hpp>
+#include <boost/property_tree/info_parser.hpp>
+
+#include "../tests-common.hpp"
+
+#include <sstream>
+
+namespace ns3 {
+namespace ndn {
+
+/** \brief Two routers A and B running NlsrApp over a point-to-point link
+ */
+class NlsrAppFixture : public ScenarioHelperWithCleanupFixture
+{
+public:
+  NlsrAppFixture()
+    : nodeMap(std::make_shared<NlsrApp::NodeNameToIdMap>())
+  {
+    createTopology({
+        {"A", "B"}
+      });
+
+    (*nodeMap)["A"] = getNode("A")->GetId();
+    (*nodeMap)["B"] = getNode("B")->GetId();
+  }
+
+  ~NlsrAppFixture()
+  {
+    boost::filesystem::remove_all(boost::filesystem::path(TEST_CONFIG_PATH) / "nlsr");
+  }
+
+  /** \brief Parsed configuration of router \p node with the single neighbor \p neighbor
+   *
+   *  The first HELLO round is sent 10 seconds after the start, then one every 30 seconds.
+   */
+  std::shared_ptr<boost::property_tree::ptree>
+  makeConfig(const std::string& node, const std::string& neighbor)
+  {
+    std::string dir = (boost::filesystem::path(TEST_CONFIG_PATH) / "nlsr" / node).string();
+    boost::filesystem::create_directories(dir);
+
+    std::ostringstream os;
+    os << "general\n"
+       << "{\n"
+       << "  network /ndn\n"
+       << "  site /site\n"
+       << "  router /%C1.router/" << node << "\n"
+       << "  log-dir " << dir << "\n"
+       << "  seq-dir " << dir << "\n"
+       << "}\n"
+       << "neighbors\n"
+       << "{\n"
+       << "  first-hello-interval 10\n"
+       << "  hello-interval 30\n"
+       << "  neighbor\n"
+       << "  {\n"
+       << "    node-id " << neighbor << "\n"
+       << "    name /ndn/site/%C1.router/" << neighbor << "\n"
+       << "    face-uri udp4://10.0.0." << (*nodeMap)[neighbor] << "\n"
+       << "    link-cost 10\n"
+       << "  }\n"
+       << "}\n"
+       << "advertising\n"
+       << "{\n"
+       << "  prefix /ndn/site/" << node << "/content\n"
+       << "}\n"
+       << "security\n"
+       << "{\n"
+       << "  validator\n"
+       << "  {\n"
+       << "    trust-anchor\n"
+       << "    {\n"
+       << "      type any\n"
+       << "    }\n"
+       << "  }\n"
+       << "}\n";
+
+    auto config = std::make_shared<boost::property_tree::ptree>();
+    std::istringstream input(os.str());
+    boost::property_tree::read_info(input, *config);
+    return config;
+  }
+
+  /** \brief Installs NlsrApp on \p node, started at time 0
+   */
+  Ptr<NlsrApp>
+  installNlsr(const std::string& node, std::shared_ptr<const boost::property_tree::ptree> config,
+              std::shared_ptr<const nlsr::LsdbSnapshot> snapshot = nullptr)
+  {
+    Ptr<NlsrApp> app = CreateObject<NlsrApp>();
+    getNode(node)->AddApplication(app);
+    app->SetNodeNameToIdMap(nodeMap);
+    app->SetLsdbSnapshot(snapshot);
+    app->SetNodeName(node);
+    app->Initialize(node + ".conf", config);
+    app->SetStartTime(Seconds(0));
+    return app;
+  }
+
+  void
+  advanceClocks(const Time& delay)
+  {
+    Simulator::Stop(delay);
+    Simulator::Run();
+  }
+
+public:
+  std::shared_ptr<NlsrApp::NodeNameToIdMap> nodeMap;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDNSIM_TESTS_UNIT_TESTS_NLSR_NLSR_APP_FIXTURE_HPP
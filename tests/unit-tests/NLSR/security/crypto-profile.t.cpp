@@ -0,0 +1,198 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "security/crypto-profile.hpp"
+
+#include "helper/ndn-stack-helper.hpp"
+
+#include "../../tests-common.hpp"
+
+namespace nlsr {
+namespace security {
+namespace test {
+
+using ns3::Simulator;
+
+class FaceStub
+{
+public:
+  void
+  put(const ndn::Data& data)
+  {
+    sentData.push_back(data);
+  }
+
+public:
+  std::vector<ndn::Data> sentData;
+};
+
+class CryptoProfileFixture : public ns3::ndn::CleanupFixture
+{
+public:
+  CryptoProfileFixture()
+    : scheduler(io)
+    , profile(ns3::ndn::StackHelper::getKeyChain(), scheduler)
+  {
+    // make ndn::time::steady_clock follow the simulated time
+    ns3::ndn::StackHelper().setCustomNdnCxxClocks();
+  }
+
+  shared_ptr<ndn::Data>
+  makeData(const std::string& name)
+  {
+    shared_ptr<ndn::Data> data = make_shared<ndn::Data>(ndn::Name(name));
+    data->setContent(reinterpret_cast<const uint8_t*>("content"), 7);
+    return data;
+  }
+
+  void
+  advanceClocks(const ns3::Time& delay)
+  {
+    Simulator::Stop(delay);
+    Simulator::Run();
+  }
+
+public:
+  boost::asio::io_service io;
+  ndn::Scheduler scheduler;
+  CryptoProfile profile;
+  FaceStub face;
+};
+
+BOOST_FIXTURE_TEST_SUITE(NlsrSecurityCryptoProfile, CryptoProfileFixture)
+
+BOOST_AUTO_TEST_CASE(ParseMode)
+{
+  CryptoProfile::Mode mode = CryptoProfile::MODE_REAL;
+  BOOST_CHECK(CryptoProfile::parseMode("null", mode));
+  BOOST_CHECK_EQUAL(mode, CryptoProfile::MODE_NULL);
+  BOOST_CHECK(CryptoProfile::parseMode("digest-sha256", mode));
+  BOOST_CHECK_EQUAL(mode, CryptoProfile::MODE_DIGEST_SHA256);
+  BOOST_CHECK(CryptoProfile::parseMode("real", mode));
+  BOOST_CHECK_EQUAL(mode, CryptoProfile::MODE_REAL);
+  BOOST_CHECK(!CryptoProfile::parseMode("rsa", mode));
+  BOOST_CHECK_EQUAL(mode, CryptoProfile::MODE_REAL);
+}
+
+BOOST_AUTO_TEST_CASE(SignNull)
+{
+  profile.setMode(CryptoProfile::MODE_NULL);
+  BOOST_CHECK(profile.isValidationBypassed());
+
+  shared_ptr<ndn::Data> data = makeData("/test/null");
+  profile.sign(*data);
+
+  BOOST_CHECK(data->hasWire());
+  BOOST_CHECK_EQUAL(data->getSignature().getType(), ndn::tlv::DigestSha256);
+  BOOST_CHECK_EQUAL(data->getSignature().getValue().value_size(), 32);
+  BOOST_CHECK_EQUAL(profile.getNSignatures(), 1);
+
+  ndn::Data decoded(data->wireEncode());
+  BOOST_CHECK_EQUAL(decoded.getName(), data->getName());
+}
+
+BOOST_AUTO_TEST_CASE(SignDigest)
+{
+  profile.setMode(CryptoProfile::MODE_DIGEST_SHA256);
+
+  shared_ptr<ndn::Data> data = makeData("/test/digest");
+  profile.sign(*data);
+
+  BOOST_CHECK_EQUAL(data->getSignature().getType(), ndn::tlv::DigestSha256);
+  BOOST_CHECK_EQUAL(profile.getNSignatures(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(CommandSigningInfo)
+{
+  profile.setMode(CryptoProfile::MODE_REAL);
+  BOOST_CHECK_EQUAL(profile.getCommandSigningInfo().getSignerType(),
+                    ndn::security::SigningInfo::SIGNER_TYPE_NULL);
+
+  profile.setMode(CryptoProfile::MODE_NULL);
+  BOOST_CHECK_EQUAL(profile.getCommandSigningInfo().getSignerType(),
+                    ndn::security::SigningInfo::SIGNER_TYPE_SHA256);
+}
+
+BOOST_AUTO_TEST_CASE(SigningDelay)
+{
+  profile.setMode(CryptoProfile::MODE_NULL);
+  profile.setSigningDelay(ndn::time::milliseconds(10));
+
+  shared_ptr<ndn::Data> data1 = makeData("/test/1");
+  profile.sign(*data1);
+  profile.put(face, data1);
+
+  shared_ptr<ndn::Data> data2 = makeData("/test/2");
+  profile.sign(*data2);
+  profile.put(face, data2);
+
+  BOOST_CHECK_EQUAL(face.sentData.size(), 0);
+
+  advanceClocks(ns3::MilliSeconds(10));
+  BOOST_REQUIRE_EQUAL(face.sentData.size(), 1);
+  BOOST_CHECK_EQUAL(face.sentData[0].getName(), data1->getName());
+
+  advanceClocks(ns3::MilliSeconds(10));
+  BOOST_REQUIRE_EQUAL(face.sentData.size(), 2);
+  BOOST_CHECK_EQUAL(face.sentData[1].getName(), data2->getName());
+}
+
+BOOST_AUTO_TEST_CASE(NoDelay)
+{
+  profile.setMode(CryptoProfile::MODE_DIGEST_SHA256);
+
+  shared_ptr<ndn::Data> data = makeData("/test/now");
+  profile.sign(*data);
+  profile.put(face, data);
+  BOOST_CHECK_EQUAL(face.sentData.size(), 1);
+
+  bool isVerified = false;
+  profile.verify([&isVerified] { isVerified = true; });
+  BOOST_CHECK(isVerified);
+  BOOST_CHECK_EQUAL(profile.getNVerifications(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(ValidationDelay)
+{
+  profile.setMode(CryptoProfile::MODE_NULL);
+  profile.setSigningDelay(ndn::time::milliseconds(5));
+  profile.setValidationDelay(ndn::time::milliseconds(20));
+
+  shared_ptr<ndn::Data> data = makeData("/test/signed");
+  profile.sign(*data);
+
+  int nVerified = 0;
+  profile.verify([&nVerified] { ++nVerified; });
+  profile.verify([&nVerified] { ++nVerified; });
+  BOOST_CHECK_EQUAL(profile.getNVerifications(), 2);
+
+  // the CPU signs for 5ms, then verifies for 20ms each
+  advanceClocks(ns3::MilliSeconds(24));
+  BOOST_CHECK_EQUAL(nVerified, 0);
+  advanceClocks(ns3::MilliSeconds(1));
+  BOOST_CHECK_EQUAL(nVerified, 1);
+  advanceClocks(ns3::MilliSeconds(20));
+  BOOST_CHECK_EQUAL(nVerified, 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace test
+} // namespace security
+} // namespace nlsr
@@ -0,0 +1,79 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utility/shared-pool.hpp"
+#include "adjacent.hpp"
+#include "lsa.hpp"
+
+#include "../../tests-common.hpp"
+
+namespace nlsr {
+namespace test {
+
+BOOST_AUTO_TEST_SUITE(NlsrUtilitySharedPool)
+
+BOOST_AUTO_TEST_CASE(GetAndRelease)
+{
+  size_t size = util::NamePool::size();
+
+  util::NamePool::ValuePtr a = util::NamePool::get(ndn::Name("/ndn/site/%C1.Router/router-a"));
+  util::NamePool::ValuePtr b = util::NamePool::get(ndn::Name("/ndn/site/%C1.Router/router-a"));
+  util::NamePool::ValuePtr c = util::NamePool::get(ndn::Name("/ndn/site/%C1.Router/router-c"));
+
+  BOOST_CHECK(a == b);
+  BOOST_CHECK(a != c);
+  BOOST_CHECK_EQUAL(*a, ndn::Name("/ndn/site/%C1.Router/router-a"));
+  BOOST_CHECK_EQUAL(util::NamePool::size(), size + 2);
+
+  a.reset();
+  BOOST_CHECK_EQUAL(util::NamePool::size(), size + 2);
+  b.reset();
+  BOOST_CHECK_EQUAL(util::NamePool::size(), size + 1);
+  c.reset();
+  BOOST_CHECK_EQUAL(util::NamePool::size(), size);
+}
+
+BOOST_AUTO_TEST_CASE(SharedByRouters)
+{
+  ndn::Name routerA("/ndn/site/%C1.Router/router-a");
+  ndn::Name routerB("/ndn/site/%C1.Router/router-b");
+
+  // the LSA of router A, and the neighbor B, as held by two routers
+  NameLsa lsa1;
+  lsa1.setOrigRouter(routerA);
+  NameLsa lsa2;
+  lsa2.setOrigRouter(ndn::Name(routerA.toUri()));
+  BOOST_CHECK_EQUAL(&lsa1.getOrigRouter(), &lsa2.getOrigRouter());
+
+  Adjacent adjacent1(routerB, "udp4://10.0.0.2", 10, Adjacent::STATUS_ACTIVE, 0, 0);
+  Adjacent adjacent2(routerB, "udp4://10.0.0.2", 10, Adjacent::STATUS_INACTIVE, 0, 0);
+  BOOST_CHECK_EQUAL(&adjacent1.getName(), &adjacent2.getName());
+  BOOST_CHECK_EQUAL(&adjacent1.getConnectingFaceUri(), &adjacent2.getConnectingFaceUri());
+  BOOST_CHECK(adjacent1 == adjacent2);
+
+  adjacent2.setConnectingFaceUri("udp4://10.0.0.3");
+  BOOST_CHECK_EQUAL(adjacent1.getConnectingFaceUri(), "udp4://10.0.0.2");
+  BOOST_CHECK_EQUAL(adjacent2.getConnectingFaceUri(), "udp4://10.0.0.3");
+  BOOST_CHECK(!(adjacent1 == adjacent2));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace test
+} // namespace nlsr
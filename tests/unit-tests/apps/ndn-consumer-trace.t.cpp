@@ -0,0 +1,151 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "apps/ndn-consumer-trace.hpp"
+#include "helper/ndn-stack-helper.hpp"
+
+#include <boost/filesystem.hpp>
+#include <algorithm>
+#include <fstream>
+#include <map>
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+const boost::filesystem::path TEST_REQUESTS =
+  boost::filesystem::path(TEST_CONFIG_PATH) / "requests.txt";
+
+class ConsumerTraceFixture : public ScenarioHelperWithCleanupFixture
+{
+public:
+  ConsumerTraceFixture()
+  {
+    boost::filesystem::create_directories(TEST_CONFIG_PATH);
+
+    // sequence numbers out of order, 5 requested again while waiting for its Data,
+    // and 2 never answered
+    std::ofstream os(TEST_REQUESTS.string().c_str());
+    os << "# time seq\n"
+       << "0.1 5\n"
+       << "0.2 3\n"
+       << "\n"
+       << "0.3 5\n"
+       << "0.4 7\n"
+       << "0.45 2\n";
+    os.close();
+
+    // nothing answers the Interests of node 1: Data are given to the consumer by the test
+    createTopology({
+        {"1", "2"}
+      });
+
+    addApps({
+        {"1", "ns3::ndn::ConsumerTrace",
+            {{"Prefix", "/prefix"}, {"TraceFile", TEST_REQUESTS.string()}},
+            "0s", "100s"}
+      });
+
+    consumer = DynamicCast<ConsumerTrace>(getNode("1")->GetApplication(0));
+    consumer->TraceConnectWithoutContext("TransmittedInterests",
+                                         MakeCallback(&ConsumerTraceFixture::onInterest, this));
+    consumer->TraceConnectWithoutContext("FirstInterestDataDelay",
+                                         MakeCallback(&ConsumerTraceFixture::onFirstDelay, this));
+  }
+
+  ~ConsumerTraceFixture()
+  {
+    boost::filesystem::remove(TEST_REQUESTS);
+  }
+
+  void
+  receiveData(uint32_t seq, const Time& at)
+  {
+    auto data = make_shared<Data>(Name("/prefix").appendSequenceNumber(seq));
+    StackHelper::getKeyChain().sign(*data);
+    Simulator::ScheduleWithContext(getNode("1")->GetId(), at - Simulator::Now(),
+                                   &Consumer::OnData, consumer, shared_ptr<const Data>(data));
+  }
+
+  void
+  advanceClocks(const Time& until)
+  {
+    Simulator::Stop(until - Simulator::Now());
+    Simulator::Run();
+  }
+
+private:
+  void
+  onInterest(shared_ptr<const Interest> interest, Ptr<App>, shared_ptr<Face>)
+  {
+    interests.push_back(interest->getName().at(-1).toSequenceNumber());
+  }
+
+  void
+  onFirstDelay(Ptr<App>, uint32_t seq, Time delay, uint32_t retxCount, int32_t)
+  {
+    retxCounts[seq] = retxCount;
+    firstDelays[seq] = delay;
+  }
+
+public:
+  Ptr<ConsumerTrace> consumer;
+  std::vector<uint64_t> interests;
+  std::map<uint32_t, uint32_t> retxCounts;
+  std::map<uint32_t, Time> firstDelays;
+};
+
+BOOST_FIXTURE_TEST_SUITE(AppsNdnConsumerTrace, ConsumerTraceFixture)
+
+BOOST_AUTO_TEST_CASE(Replay)
+{
+  advanceClocks(MilliSeconds(460));
+  std::vector<uint64_t> expected = {5, 3, 5, 7, 2};
+  BOOST_CHECK_EQUAL_COLLECTIONS(interests.begin(), interests.end(),
+                                expected.begin(), expected.end());
+
+  receiveData(5, MilliSeconds(500));
+  receiveData(3, MilliSeconds(500));
+  receiveData(7, MilliSeconds(500));
+  advanceClocks(Seconds(10));
+
+  // a request for a sequence number still waiting for its Data is a retransmission
+  BOOST_CHECK_EQUAL(retxCounts.size(), 3);
+  BOOST_CHECK_EQUAL(retxCounts[5], 2);
+  BOOST_CHECK_EQUAL(firstDelays[5], MilliSeconds(400));
+  BOOST_CHECK_EQUAL(retxCounts[3], 1);
+  BOOST_CHECK_EQUAL(firstDelays[3], MilliSeconds(300));
+  BOOST_CHECK_EQUAL(retxCounts[7], 1);
+  BOOST_CHECK_EQUAL(firstDelays[7], MilliSeconds(100));
+
+  // only 2 times out, and it is retransmitted after each timeout
+  BOOST_REQUIRE_GT(interests.size(), expected.size());
+  BOOST_CHECK(std::all_of(interests.begin() + expected.size(), interests.end(),
+                          [] (uint64_t seq) { return seq == 2; }));
+  Consumer::Stats stats = consumer->GetStats();
+  BOOST_CHECK_EQUAL(stats.nOutInterests, interests.size());
+  BOOST_CHECK_EQUAL(stats.nTimedOutInterests, interests.size() - expected.size());
+  BOOST_CHECK_EQUAL(stats.nInData, 3);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,208 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "apps/ndn-consumer.hpp"
+#include "helper/ndn-stack-helper.hpp"
+
+#include "../tests-common.hpp"
+
+#include <algorithm>
+
+namespace ns3 {
+namespace ndn {
+
+/** \brief Consumer that requests new sequence numbers only when told to
+ *
+ *  Retransmissions are sent as soon as they are scheduled, as by the other consumers.
+ */
+class TestConsumer : public Consumer
+{
+public:
+  TestConsumer()
+  {
+    m_seqMax = std::numeric_limits<uint32_t>::max();
+  }
+
+  uint32_t
+  getRetxCount(uint32_t seq) const
+  {
+    auto it = m_seqStates.find(seq);
+    return it == m_seqStates.end() ? 0 : it->second.retxCount;
+  }
+
+  Time
+  getLastTime(uint32_t seq) const
+  {
+    return m_seqStates.at(seq).lastTime;
+  }
+
+  bool
+  isPending(uint32_t seq) const
+  {
+    return std::any_of(m_pendingSeqs.begin(), m_pendingSeqs.end(),
+                       [seq] (const SeqState& state) { return state.seq == seq; });
+  }
+
+  size_t
+  getNSeqStates() const
+  {
+    return m_seqStates.size();
+  }
+
+protected:
+  virtual void
+  ScheduleNextPacket()
+  {
+    if (!m_retxSeqs.empty() && !m_sendEvent.IsRunning()) {
+      m_sendEvent = Simulator::ScheduleNow(&Consumer::SendPacket, this);
+    }
+  }
+};
+
+class ConsumerFixture : public ScenarioHelperWithCleanupFixture
+{
+public:
+  ConsumerFixture()
+  {
+    // nothing answers the Interests of node 1: Data are given to the consumer by the test
+    createTopology({
+        {"1", "2"}
+      });
+
+    consumer = CreateObject<TestConsumer>();
+    consumer->SetAttribute("Prefix", StringValue("/prefix"));
+    consumer->SetAttribute("RetxTimer", StringValue("10ms"));
+    consumer->TraceConnectWithoutContext("LastRetransmittedInterestDataDelay",
+                                         MakeCallback(&ConsumerFixture::onLastDelay, this));
+    consumer->TraceConnectWithoutContext("FirstInterestDataDelay",
+                                         MakeCallback(&ConsumerFixture::onFirstDelay, this));
+    getNode("1")->AddApplication(consumer);
+    consumer->SetStartTime(Seconds(0));
+  }
+
+  void
+  sendInterest(const Time& at)
+  {
+    Simulator::ScheduleWithContext(getNode("1")->GetId(), at - Simulator::Now(),
+                                   &Consumer::SendPacket, consumer);
+  }
+
+  void
+  receiveData(uint32_t seq, const Time& at)
+  {
+    auto data = make_shared<Data>(Name("/prefix").appendSequenceNumber(seq));
+    StackHelper::getKeyChain().sign(*data);
+    Simulator::ScheduleWithContext(getNode("1")->GetId(), at - Simulator::Now(),
+                                   &Consumer::OnData, consumer, shared_ptr<const Data>(data));
+  }
+
+  void
+  advanceClocks(const Time& until)
+  {
+    Simulator::Stop(until - Simulator::Now());
+    Simulator::Run();
+  }
+
+private:
+  void
+  onLastDelay(Ptr<App>, uint32_t seq, Time delay, int32_t)
+  {
+    lastDelays.push_back(std::make_pair(seq, delay));
+  }
+
+  void
+  onFirstDelay(Ptr<App>, uint32_t seq, Time delay, uint32_t retxCount, int32_t)
+  {
+    firstDelays.push_back(std::make_pair(seq, delay));
+    retxCounts.push_back(retxCount);
+  }
+
+public:
+  Ptr<TestConsumer> consumer;
+  std::vector<std::pair<uint32_t, Time>> lastDelays;
+  std::vector<std::pair<uint32_t, Time>> firstDelays;
+  std::vector<uint32_t> retxCounts;
+};
+
+BOOST_FIXTURE_TEST_SUITE(AppsNdnConsumer, ConsumerFixture)
+
+BOOST_AUTO_TEST_CASE(DataBeforeTimeout)
+{
+  sendInterest(MilliSeconds(100));
+  advanceClocks(MilliSeconds(200));
+  BOOST_CHECK_EQUAL(consumer->getRetxCount(0), 1);
+  BOOST_CHECK(consumer->isPending(0));
+
+  receiveData(0, MilliSeconds(400));
+  advanceClocks(MilliSeconds(500));
+
+  BOOST_REQUIRE_EQUAL(lastDelays.size(), 1);
+  BOOST_CHECK_EQUAL(lastDelays[0].first, 0);
+  BOOST_CHECK_EQUAL(lastDelays[0].second, MilliSeconds(300));
+  BOOST_REQUIRE_EQUAL(firstDelays.size(), 1);
+  BOOST_CHECK_EQUAL(firstDelays[0].second, MilliSeconds(300));
+  BOOST_CHECK_EQUAL(retxCounts[0], 1);
+
+  // the sequence number is forgotten, and never times out
+  BOOST_CHECK_EQUAL(consumer->getNSeqStates(), 0);
+  BOOST_CHECK(!consumer->isPending(0));
+  advanceClocks(Seconds(5));
+  BOOST_CHECK_EQUAL(consumer->GetStats().nOutInterests, 1);
+  BOOST_CHECK_EQUAL(consumer->GetStats().nTimedOutInterests, 0);
+  BOOST_CHECK_EQUAL(consumer->GetStats().nInData, 1);
+}
+
+BOOST_AUTO_TEST_CASE(RetransmissionAndDuplicateData)
+{
+  // the initial RTO is 1 second
+  sendInterest(MilliSeconds(100));
+  advanceClocks(MilliSeconds(1500));
+  BOOST_CHECK_EQUAL(consumer->GetStats().nTimedOutInterests, 1);
+  BOOST_CHECK_EQUAL(consumer->GetStats().nOutInterests, 2);
+  BOOST_CHECK_EQUAL(consumer->getRetxCount(0), 2);
+  BOOST_CHECK(consumer->isPending(0));
+  Time lastTime = consumer->getLastTime(0);
+  BOOST_CHECK_GE(lastTime, MilliSeconds(1100));
+
+  receiveData(0, MilliSeconds(1600));
+  advanceClocks(MilliSeconds(1650));
+
+  BOOST_REQUIRE_EQUAL(lastDelays.size(), 1);
+  BOOST_CHECK_EQUAL(lastDelays[0].second, MilliSeconds(1600) - lastTime);
+  BOOST_REQUIRE_EQUAL(firstDelays.size(), 1);
+  BOOST_CHECK_EQUAL(firstDelays[0].second, MilliSeconds(1500));
+  BOOST_CHECK_EQUAL(retxCounts[0], 2);
+  BOOST_CHECK_EQUAL(consumer->getNSeqStates(), 0);
+  BOOST_CHECK(!consumer->isPending(0));
+
+  // the Data answering the other Interest is not traced again
+  receiveData(0, MilliSeconds(1700));
+  advanceClocks(Seconds(10));
+  BOOST_CHECK_EQUAL(lastDelays.size(), 1);
+  BOOST_CHECK_EQUAL(firstDelays.size(), 1);
+  BOOST_CHECK_EQUAL(consumer->getNSeqStates(), 0);
+  BOOST_CHECK_EQUAL(consumer->GetStats().nInData, 2);
+  BOOST_CHECK_EQUAL(consumer->GetStats().nOutInterests, 2);
+  BOOST_CHECK_EQUAL(consumer->GetStats().nTimedOutInterests, 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -36,6 +36,9 @@
 
 #include <boost/filesystem.hpp>
 
+#include <set>
+#include <tuple>
+
 namespace ns3 {
 namespace ndn {
 
@@ -147,6 +150,118 @@ BOOST_AUTO_TEST_CASE(CalculateRouteCase2)
   }
 }
 
+BOOST_AUTO_TEST_CASE(AlternativeRoutes)
+{
+  ofstream file1(TEST_TOPO_TXT.string().c_str());
+  file1 << "router\n\n"
+        << "#node city  y x mpi-partition\n"
+        << "A3  NA  1 1 1\n"
+        << "B3  NA  80  -40 1\n"
+        << "C3  NA  80  40  1\n\n"
+        << "link\n\n"
+        << "# from  to  capacity  metric  delay queue\n"
+        << "A3      B3  10Mbps    100 1ms 100\n"
+        << "A3      C3  10Mbps    50  1ms 100\n"
+        << "B3      C3  10Mbps    1 1ms 100\n";
+  file1.close();
+
+  AnnotatedTopologyReader topologyReader("");
+  topologyReader.SetFileName(TEST_TOPO_TXT.string().c_str());
+  topologyReader.Read();
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.InstallAll();
+
+  topologyReader.ApplyOspfMetric();
+
+  ndn::GlobalRoutingHelper ndnGlobalRoutingHelper;
+  ndnGlobalRoutingHelper.InstallAll();
+  ndnGlobalRoutingHelper.AddOrigins("/prefix", Names::Find<Node>("C3"));
+
+  // (node, neighbor, metric)
+  typedef std::set<std::tuple<std::string, std::string, int32_t>> Routes;
+  auto collect = [] (Routes& routes) {
+    return [&routes] (Ptr<Node> node, const Name& prefix, shared_ptr<Face> face, int32_t metric) {
+      BOOST_CHECK_EQUAL(prefix, Name("/prefix"));
+      auto linkService = dynamic_cast<NetDeviceLinkService*>(face->getLinkService());
+      BOOST_REQUIRE(linkService != nullptr);
+      Ptr<Channel> channel = linkService->GetNetDevice()->GetChannel();
+      Ptr<Node> neighbor = channel->GetDevice(0)->GetNode() == node ? channel->GetDevice(1)->GetNode()
+                                                                     : channel->GetDevice(0)->GetNode();
+      routes.insert(std::make_tuple(Names::FindName(node), Names::FindName(neighbor), metric));
+    };
+  };
+
+  Routes expected = {
+    std::make_tuple("A3", "C3", 50),
+    std::make_tuple("A3", "B3", 101),
+    std::make_tuple("B3", "C3", 1),
+    std::make_tuple("B3", "A3", 150)
+  };
+
+  for (uint32_t nThreads : {1, 4}) {
+    ndn::GlobalRoutingHelper::SetNumberOfThreads(nThreads);
+
+    Routes shortest;
+    ndn::GlobalRoutingHelper::CalculateRoutes(collect(shortest));
+    BOOST_CHECK(shortest == Routes({std::make_tuple("A3", "C3", 50),
+                                    std::make_tuple("B3", "C3", 1)}));
+
+    Routes allPossible;
+    ndn::GlobalRoutingHelper::CalculateAllPossibleRoutes(collect(allPossible));
+    BOOST_CHECK(allPossible == expected);
+
+    Routes loopFree;
+    ndn::GlobalRoutingHelper::CalculateLoopFreeAlternateRoutes(collect(loopFree));
+    BOOST_CHECK(loopFree == expected);
+  }
+  ndn::GlobalRoutingHelper::SetNumberOfThreads(0);
+}
+
+BOOST_AUTO_TEST_CASE(ThrowingRouteCallback)
+{
+  ofstream file1(TEST_TOPO_TXT.string().c_str());
+  file1 << "router\n\n"
+        << "#node city  y x mpi-partition\n"
+        << "A3  NA  1 1 1\n"
+        << "B3  NA  80  -40 1\n"
+        << "C3  NA  80  40  1\n\n"
+        << "link\n\n"
+        << "# from  to  capacity  metric  delay queue\n"
+        << "A3      B3  10Mbps    100 1ms 100\n"
+        << "A3      C3  10Mbps    50  1ms 100\n"
+        << "B3      C3  10Mbps    1 1ms 100\n";
+  file1.close();
+
+  AnnotatedTopologyReader topologyReader("");
+  topologyReader.SetFileName(TEST_TOPO_TXT.string().c_str());
+  topologyReader.Read();
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.InstallAll();
+
+  ndn::GlobalRoutingHelper ndnGlobalRoutingHelper;
+  ndnGlobalRoutingHelper.InstallAll();
+  ndnGlobalRoutingHelper.AddOrigins("/prefix", Names::Find<Node>("C3"));
+
+  // the exception reaches the caller after the threads are joined
+  ndn::GlobalRoutingHelper::SetNumberOfThreads(4);
+  auto fail = [] (Ptr<Node>, const Name&, shared_ptr<Face>, int32_t) {
+    throw std::runtime_error("route rejected");
+  };
+  BOOST_CHECK_THROW(ndn::GlobalRoutingHelper::CalculateRoutes(fail), std::runtime_error);
+  BOOST_CHECK_THROW(ndn::GlobalRoutingHelper::CalculateLoopFreeAlternateRoutes(fail),
+                    std::runtime_error);
+
+  size_t nRoutes = 0;
+  ndn::GlobalRoutingHelper::CalculateRoutes([&nRoutes] (Ptr<Node>, const Name&,
+                                                        shared_ptr<Face>, int32_t) {
+    ++nRoutes;
+  });
+  BOOST_CHECK_EQUAL(nRoutes, 2);
+  ndn::GlobalRoutingHelper::SetNumberOfThreads(0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace ndn
@@ -216,6 +216,40 @@ BOOST_AUTO_TEST_CASE(InstallAllCustomStrategy)
   BOOST_CHECK_EQUAL(getFace("A2", "C2")->getCounters().nOutInterests, 0);
 }
 
+BOOST_AUTO_TEST_CASE(FixedStrategyDispatch)
+{
+  for (const std::string& node : {"A1", "A2"}) {
+    getNode(node)->GetObject<L3Protocol>()->getForwarder()->setFixedStrategyDispatch(true);
+  }
+  StrategyChoiceHelper::Install(getNode("A2"), "/prefix", "/localhost/nfd/strategy/multicast");
+
+  Simulator::Stop(Seconds(5.0));
+  Simulator::Run();
+
+  BOOST_CHECK_EQUAL(getFace("A1", "B1")->getCounters().nOutInterests, 0);
+  BOOST_CHECK_EQUAL(getFace("A1", "C1")->getCounters().nOutInterests, 5);
+
+  BOOST_CHECK_EQUAL(getFace("A2", "B2")->getCounters().nOutInterests, 5);
+  BOOST_CHECK_EQUAL(getFace("A2", "C2")->getCounters().nOutInterests, 5);
+}
+
+BOOST_AUTO_TEST_CASE(FixedStrategyDispatchCustomStrategy)
+{
+  for (const std::string& node : {"A1", "A2"}) {
+    getNode(node)->GetObject<L3Protocol>()->getForwarder()->setFixedStrategyDispatch(true);
+  }
+  StrategyChoiceHelper::InstallAll<NullStrategy>("/prefix");
+
+  Simulator::Stop(Seconds(5.0));
+  Simulator::Run();
+
+  BOOST_CHECK_EQUAL(getFace("A1", "B1")->getCounters().nOutInterests, 0);
+  BOOST_CHECK_EQUAL(getFace("A1", "C1")->getCounters().nOutInterests, 0);
+
+  BOOST_CHECK_EQUAL(getFace("A2", "B2")->getCounters().nOutInterests, 0);
+  BOOST_CHECK_EQUAL(getFace("A2", "C2")->getCounters().nOutInterests, 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace ndn
@@ -0,0 +1,201 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "model/cs/ndn-cs-policy-probability.hpp"
+#include "model/cs/ndn-cs-policy-freshness.hpp"
+#include "model/cs/ndn-cs-policy-lifetime-stats.hpp"
+#include "model/ndn-l3-protocol.hpp"
+#include "helper/ndn-stack-helper.hpp"
+
+#include "NFD/daemon/table/cs.hpp"
+#include "NFD/daemon/table/cs-policy-lru.hpp"
+#include "NFD/core/scheduler.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class CsPoliciesFixture : public ScenarioHelperWithCleanupFixture
+{
+public:
+  CsPoliciesFixture()
+    : nHits(0)
+    , nMisses(0)
+  {
+  }
+
+  void
+  CacheHits(const Interest&, const Data&)
+  {
+    ++nHits;
+  }
+
+  void
+  CacheMisses(const Interest&)
+  {
+    ++nMisses;
+  }
+
+  static std::unique_ptr<nfd::cs::Policy>
+  makeLru()
+  {
+    return std::unique_ptr<nfd::cs::Policy>(new nfd::cs::LruPolicy());
+  }
+
+  static shared_ptr<Data>
+  makeData(const Name& name, time::milliseconds freshnessPeriod = time::milliseconds(-1))
+  {
+    auto data = make_shared<Data>(name);
+    if (freshnessPeriod >= time::milliseconds::zero()) {
+      data->setFreshnessPeriod(freshnessPeriod);
+    }
+    StackHelper::getKeyChain().sign(*data);
+    return data;
+  }
+
+  static bool
+  isCached(const nfd::Cs& cs, const Name& name)
+  {
+    bool isHit = false;
+    cs.find(Interest(name),
+            [&isHit] (const Interest&, const Data&) { isHit = true; },
+            [] (const Interest&) {});
+    return isHit;
+  }
+
+public:
+  size_t nHits;
+  size_t nMisses;
+};
+
+BOOST_FIXTURE_TEST_SUITE(ModelNdnCsPolicies, CsPoliciesFixture)
+
+BOOST_AUTO_TEST_CASE(Probability)
+{
+  nfd::Cs never(10, std::unique_ptr<nfd::cs::Policy>(new cs::ProbabilityPolicy(makeLru(), 0.0)));
+  nfd::Cs always(10, std::unique_ptr<nfd::cs::Policy>(new cs::ProbabilityPolicy(makeLru(), 1.0)));
+  for (int i = 0; i < 20; ++i) {
+    shared_ptr<Data> data = makeData(Name("/A").appendNumber(i));
+    never.insert(*data);
+    always.insert(*data);
+  }
+
+  BOOST_CHECK_EQUAL(never.size(), 0);
+  BOOST_CHECK_EQUAL(always.size(), 10);
+  BOOST_CHECK(!isCached(always, Name("/A").appendNumber(9)));
+  BOOST_CHECK(isCached(always, Name("/A").appendNumber(10)));
+}
+
+BOOST_AUTO_TEST_CASE(Freshness)
+{
+  nfd::Cs cs(10, std::unique_ptr<nfd::cs::Policy>(new cs::FreshnessPolicy(makeLru())));
+  cs.insert(*makeData("/short", time::seconds(1)));
+  shared_ptr<Data> longData = makeData("/long", time::seconds(3));
+  cs.insert(*longData);
+  cs.insert(*makeData("/forever"));
+
+  nfd::scheduler::schedule(time::seconds(2), [&cs, longData] {
+      BOOST_CHECK(!isCached(cs, "/short"));
+      BOOST_CHECK(isCached(cs, "/long"));
+      BOOST_CHECK(isCached(cs, "/forever"));
+
+      // refreshing restarts the FreshnessPeriod
+      cs.insert(*longData);
+    });
+  nfd::scheduler::schedule(time::seconds(4), [&cs] {
+      BOOST_CHECK(isCached(cs, "/long"));
+    });
+
+  Simulator::Stop(Seconds(10));
+  Simulator::Run();
+
+  BOOST_CHECK_EQUAL(cs.size(), 1);
+  BOOST_CHECK(isCached(cs, "/forever"));
+}
+
+BOOST_AUTO_TEST_CASE(LifetimeStats)
+{
+  auto policy = new cs::LifetimeStatsPolicy(makeLru());
+  std::vector<std::pair<Name, time::nanoseconds>> removed;
+  policy->willRemoveEntry.connect([&removed] (const Data& data, time::nanoseconds lifetime) {
+      removed.push_back({data.getName(), lifetime});
+    });
+  nfd::Cs cs(2, std::unique_ptr<nfd::cs::Policy>(policy));
+
+  nfd::scheduler::schedule(time::seconds(1), [&cs] { cs.insert(*makeData("/A")); });
+  nfd::scheduler::schedule(time::seconds(2), [&cs] { cs.insert(*makeData("/B")); });
+  nfd::scheduler::schedule(time::seconds(4), [&cs] { cs.insert(*makeData("/C")); });
+  Simulator::Run();
+
+  BOOST_REQUIRE_EQUAL(removed.size(), 1);
+  BOOST_CHECK_EQUAL(removed[0].first, "/A");
+  BOOST_CHECK(removed[0].second == time::seconds(3));
+}
+
+BOOST_AUTO_TEST_CASE(StackHelperPolicyAndTraces)
+{
+  Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("10Mbps"));
+  Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("10ms"));
+  Config::SetDefault("ns3::DropTailQueue::MaxPackets", StringValue("20"));
+
+  getStackHelper().setPolicy("nfd::cs::probability::lru");
+  getStackHelper().setCacheProbability(0.0);
+
+  createTopology({
+      {"1", "2"},
+      {"2", "3"}
+    });
+
+  addRoutes({
+      {"1", "2", "/prefix", 1},
+      {"2", "3", "/prefix", 1}
+    });
+
+  // consumers on nodes 1 and 2 request the same Data, which node 2 would cache with LRU
+  addApps({
+      {"1", "ns3::ndn::ConsumerCbr",
+          {{"Prefix", "/prefix"}, {"Frequency", "1"}},
+          "0s", "0.9s"},
+      {"2", "ns3::ndn::ConsumerCbr",
+          {{"Prefix", "/prefix"}, {"Frequency", "1"}},
+          "2s", "2.9s"},
+      {"3", "ns3::ndn::Producer",
+          {{"Prefix", "/prefix"}, {"PayloadSize", "1024"}},
+          "0s", "100s"}
+    });
+
+  Ptr<L3Protocol> l3 = getNode("2")->GetObject<L3Protocol>();
+  l3->TraceConnectWithoutContext("CacheHits", MakeCallback(&CsPoliciesFixture::CacheHits, this));
+  l3->TraceConnectWithoutContext("CacheMisses",
+                                 MakeCallback(&CsPoliciesFixture::CacheMisses, this));
+
+  Simulator::Stop(Seconds(4));
+  Simulator::Run();
+
+  BOOST_CHECK_EQUAL(l3->getForwarder()->getCs().getPolicy()->getName(), "probability");
+  BOOST_CHECK_EQUAL(l3->getForwarder()->getCs().size(), 0);
+  BOOST_CHECK_EQUAL(nHits, 0);
+  BOOST_CHECK_EQUAL(nMisses, 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -19,6 +19,10 @@
 
 
 #include "model/ndn-net-device-link-service.hpp"
+#include "model/null-transport.hpp"
+
+#include "ns3/point-to-point-channel.h"
+#include "ns3/point-to-point-net-device.h"
 
 #include "../tests-common.hpp"
 
@@ -139,6 +143,38 @@ BOOST_FIXTURE_TEST_CASE(Basic, FixtureWithTracers)
   BOOST_CHECK_EQUAL(boost::lexical_cast<std::string>(getFace("2", "1")->getRemoteUri()), "netdev://[00:00:00:ff:ff:01]");
 }
 
+BOOST_AUTO_TEST_CASE(LinkChangeAfterFaceDestroyed)
+{
+  createTopology({
+      {"1", "2"},
+    });
+
+  // attaching a NetDevice to a channel notifies its link change callbacks
+  Ptr<PointToPointNetDevice> netDevice =
+    DynamicCast<PointToPointNetDevice>(getNetDevice("1", "2"));
+  BOOST_REQUIRE(netDevice != nullptr);
+
+  shared_ptr<Face> face = getFace("1", "2");
+  auto transport = dynamic_cast<NullTransport*>(face->getTransport());
+  BOOST_REQUIRE(transport != nullptr);
+  transport->setLinkUp(false);
+  BOOST_CHECK(face->getState() == nfd::face::FaceState::DOWN);
+
+  netDevice->Attach(CreateObject<PointToPointChannel>());
+  BOOST_CHECK(face->getState() == nfd::face::FaceState::UP);
+
+  std::weak_ptr<Face> weakFace = face;
+  face->close();
+  face.reset();
+  Simulator::Stop(Seconds(1));
+  Simulator::Run();
+  BOOST_REQUIRE(weakFace.expired());
+
+  // the NetDevice still has the callback of the destroyed link service
+  BOOST_CHECK_NO_THROW(netDevice->Attach(CreateObject<PointToPointChannel>()));
+  BOOST_CHECK(netDevice->IsLinkUp());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace ndn
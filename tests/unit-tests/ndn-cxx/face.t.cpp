@@ -291,6 +291,145 @@ BOOST_AUTO_TEST_CASE(FaceShutdownFromTimeoutCallback)
   Simulator::Run();
 }
 
+/////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////
+
+typedef std::function<void(uint64_t)> FaceIdCallback;
+
+static uint64_t
+getIncomingFaceId(const ::ndn::TagHost& packet)
+{
+  auto tag = packet.getTag<::ndn::lp::IncomingFaceIdTag>();
+  return tag == nullptr ? 0 : *tag;
+}
+
+/**
+ * @return the forwarder-side face of the ndn::Face created on @p node
+ */
+static shared_ptr<Face>
+getAppFace(Ptr<Node> node)
+{
+  for (const auto& face : node->GetObject<L3Protocol>()->getForwarder()->getFaceTable()) {
+    if (face->getLocalUri().getScheme() == "ndnFace") {
+      return face;
+    }
+  }
+  return nullptr;
+}
+
+class IncomingFaceIdProducer : public BaseTesterApp
+{
+public:
+  IncomingFaceIdProducer(const Name& name, const FaceIdCallback& onInterest)
+  {
+    m_face.setInterestFilter(name,
+                             [this, onInterest] (const ::ndn::InterestFilter&,
+                                                 const Interest& interest) {
+                               onInterest(getIncomingFaceId(interest));
+                               auto data = make_shared<Data>(Name(interest.getName()));
+                               StackHelper::getKeyChain().sign(*data);
+                               m_face.put(*data);
+                             },
+                             std::bind([] {
+                                 BOOST_ERROR("Unexpected failure to set interest filter");
+                               }));
+  }
+};
+
+class IncomingFaceIdConsumer : public BaseTesterApp
+{
+public:
+  IncomingFaceIdConsumer(const Name& name, const FaceIdCallback& onData)
+  {
+    m_face.expressInterest(Interest(name),
+                           [onData] (const Interest&, const Data& data) {
+                             onData(getIncomingFaceId(data));
+                           },
+                           std::bind([] { BOOST_ERROR("Unexpected Nack"); }),
+                           std::bind([] { BOOST_ERROR("Unexpected timeout"); }));
+  }
+};
+
+BOOST_AUTO_TEST_CASE(TagsWithoutEncoding)
+{
+  uint64_t interestFaceId = 0;
+  FactoryCallbackApp::Install(getNode("B"), [&interestFaceId] () -> shared_ptr<void> {
+      return make_shared<IncomingFaceIdProducer>("/test", [&interestFaceId] (uint64_t faceId) {
+          interestFaceId = faceId;
+        });
+    })
+    .Start(Seconds(0.01));
+
+  uint64_t dataFaceId = 0;
+  FactoryCallbackApp::Install(getNode("A"), [&dataFaceId] () -> shared_ptr<void> {
+      return make_shared<IncomingFaceIdConsumer>("/test/prefix", [&dataFaceId] (uint64_t faceId) {
+          dataFaceId = faceId;
+        });
+    })
+    .Start(Seconds(1.01));
+
+  Simulator::Stop(Seconds(20));
+  Simulator::Run();
+
+  // tags set by the forwarder reach the applications
+  BOOST_CHECK_EQUAL(interestFaceId, getFace("B", "A")->getId());
+  BOOST_CHECK_EQUAL(dataFaceId, getFace("A", "B")->getId());
+
+  // packets are exchanged as objects, not through the transports of the application faces
+  shared_ptr<Face> consumerFace = getAppFace(getNode("A"));
+  shared_ptr<Face> producerFace = getAppFace(getNode("B"));
+  BOOST_REQUIRE(consumerFace != nullptr && producerFace != nullptr);
+  BOOST_CHECK_GT(consumerFace->getCounters().nInInterests, 0);
+  BOOST_CHECK_GT(producerFace->getCounters().nOutInterests, 0);
+  for (const shared_ptr<Face>& appFace : {consumerFace, producerFace}) {
+    BOOST_CHECK_EQUAL(appFace->getTransport()->getCounters().nInPackets, 0);
+    BOOST_CHECK_EQUAL(appFace->getTransport()->getCounters().nOutPackets, 0);
+  }
+}
+
+class TwoFacesInterest
+{
+public:
+  TwoFacesInterest(const Name& name, size_t& nData)
+  {
+    for (size_t i = 0; i < 2; ++i) {
+      m_faces[i].reset(new ::ndn::Face);
+    }
+
+    // both Interests are aggregated, and the forwarder sends Data to both faces at once
+    for (size_t i = 0; i < 2; ++i) {
+      m_faces[i]->expressInterest(Interest(name),
+                                  [this, i, &nData] (const Interest&, const Data&) {
+                                    ++nData;
+                                    // Data for the other face is already on its way
+                                    m_faces[1 - i].reset();
+                                  },
+                                  std::bind([] { BOOST_ERROR("Unexpected Nack"); }),
+                                  std::bind([] { BOOST_ERROR("Unexpected timeout"); }));
+    }
+  }
+
+private:
+  std::unique_ptr<::ndn::Face> m_faces[2];
+};
+
+BOOST_AUTO_TEST_CASE(DestroyFaceWithPacketsInFlight)
+{
+  addApps({{"B", "ns3::ndn::Producer", {{"Prefix", "/test"}}, "0s", "100s"}});
+
+  size_t nData = 0;
+  FactoryCallbackApp::Install(getNode("A"), [&nData] () -> shared_ptr<void> {
+      return make_shared<TwoFacesInterest>("/test/prefix", nData);
+    })
+    .Start(Seconds(1.01));
+
+  Simulator::Stop(Seconds(20));
+  BOOST_CHECK_NO_THROW(Simulator::Run());
+
+  BOOST_CHECK_EQUAL(nData, 1);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace ndn
@@ -0,0 +1,111 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include <ndn-cxx/util/scheduler.hpp>
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+using ::ndn::util::scheduler::Scheduler;
+using ::ndn::util::scheduler::EventId;
+
+class TimerWheelSchedulerFixture : public CleanupFixture
+{
+public:
+  TimerWheelSchedulerFixture()
+  {
+    Scheduler::setDefaultBackend(Scheduler::Backend::TIMER_WHEEL, ::ndn::time::milliseconds(1));
+  }
+
+  ~TimerWheelSchedulerFixture()
+  {
+    Scheduler::setDefaultBackend(Scheduler::Backend::SIMULATOR);
+  }
+
+protected:
+  boost::asio::io_service io;
+};
+
+BOOST_FIXTURE_TEST_SUITE(NdnCxxTimerWheelScheduler, TimerWheelSchedulerFixture)
+
+BOOST_AUTO_TEST_CASE(Events)
+{
+  Scheduler scheduler(io);
+  BOOST_CHECK(scheduler.getBackend() == Scheduler::Backend::TIMER_WHEEL);
+
+  std::vector<double> fired;
+  auto record = [&] { fired.push_back(Simulator::Now().ToDouble(Time::MS)); };
+
+  scheduler.scheduleEvent(::ndn::time::microseconds(2500), record);
+  scheduler.scheduleEvent(::ndn::time::milliseconds(300), record); // cascaded from level 1
+  scheduler.scheduleEvent(::ndn::time::seconds(3600), record); // cascaded from level 2
+  scheduler.scheduleEvent(::ndn::time::microseconds(100), record); // shorter than a tick
+
+  EventId cancelled = scheduler.scheduleEvent(::ndn::time::milliseconds(5), [] {
+      BOOST_ERROR("This event should not have been fired");
+    });
+  scheduler.cancelEvent(cancelled);
+  BOOST_CHECK(cancelled == nullptr);
+
+  Simulator::Run();
+
+  BOOST_REQUIRE_EQUAL(fired.size(), 4);
+  BOOST_CHECK_CLOSE(fired[0], 0.1, 0.001);
+  BOOST_CHECK_CLOSE(fired[1], 3, 0.001); // rounded up to the tick
+  BOOST_CHECK_CLOSE(fired[2], 300, 0.001);
+  BOOST_CHECK_CLOSE(fired[3], 3600000, 0.001);
+}
+
+BOOST_AUTO_TEST_CASE(CancelFromBatch)
+{
+  Scheduler scheduler(io);
+
+  EventId second;
+  size_t count = 0;
+  scheduler.scheduleEvent(::ndn::time::milliseconds(10), [&] {
+      ++count;
+      scheduler.cancelEvent(second);
+    });
+  second = scheduler.scheduleEvent(::ndn::time::milliseconds(10), [&] {
+      BOOST_ERROR("This event should not have been fired");
+    });
+
+  Simulator::Run();
+  BOOST_CHECK_EQUAL(count, 1);
+}
+
+BOOST_AUTO_TEST_CASE(CancelAll)
+{
+  Scheduler scheduler(io);
+
+  EventId eventId = scheduler.scheduleEvent(::ndn::time::seconds(1), [] {
+      BOOST_ERROR("This event should not have been fired");
+    });
+  scheduler.cancelAllEvents();
+  scheduler.cancelEvent(eventId); // wheel no longer exists
+
+  Simulator::Run();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
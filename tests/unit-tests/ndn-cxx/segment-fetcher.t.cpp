@@ -0,0 +1,217 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include <ndn-cxx/util/segment-fetcher.hpp>
+#include <ndn-cxx/security/validator-null.hpp>
+
+#include "ns3/ndnSIM/helper/ndn-app-helper.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+using ::ndn::util::SegmentFetcher;
+
+/**
+ * @brief Producer of the three segments of /hello/world/version0
+ */
+class SegmentProducer
+{
+public:
+  /**
+   * @return delay before answering the Interest for a segment, or a negative Time to drop it
+   */
+  typedef std::function<Time(uint64_t segmentNo)> Policy;
+
+  SegmentProducer(const Policy& policy, std::vector<Interest>& interests)
+    : m_policy(policy)
+    , m_interests(interests)
+  {
+    m_face.setInterestFilter("/hello/world",
+                             std::bind(&SegmentProducer::onInterest, this, _2),
+                             std::bind([] {
+                                 BOOST_ERROR("Unexpected failure to set interest filter");
+                               }));
+  }
+
+private:
+  void
+  onInterest(const Interest& interest)
+  {
+    m_interests.push_back(interest);
+
+    // the discovery Interest for /hello/world is answered with segment 0
+    uint64_t segmentNo = interest.getName().size() == 2 ? 0 : interest.getName()[-1].toSegment();
+    Time delay = m_policy(segmentNo);
+    if (delay.IsNegative()) {
+      return;
+    }
+
+    const uint8_t buffer[] = "Hello, world!";
+    auto data = make_shared<Data>(Name("/hello/world/version0").appendSegment(segmentNo));
+    data->setContent(buffer, sizeof(buffer));
+    data->setFreshnessPeriod(::ndn::time::seconds(1));
+    if (segmentNo == 2) {
+      data->setFinalBlockId(data->getName()[-1]);
+    }
+    StackHelper::getKeyChain().sign(*data);
+
+    Simulator::Schedule(delay, &SegmentProducer::put, this, data);
+  }
+
+  void
+  put(shared_ptr<Data> data)
+  {
+    m_face.put(*data);
+  }
+
+private:
+  ::ndn::Face m_face;
+  Policy m_policy;
+  std::vector<Interest>& m_interests;
+};
+
+class SegmentFetcherFixture : public ScenarioHelperWithCleanupFixture
+{
+public:
+  SegmentFetcherFixture()
+    : nErrors(0)
+    , lastError(0)
+    , nDatas(0)
+    , dataSize(0)
+  {
+    Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("10Mbps"));
+    Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("10ms"));
+    Config::SetDefault("ns3::DropTailQueue::MaxPackets", StringValue("20"));
+
+    createTopology({{"A", "B"}});
+    addRoutes({{"A", "B", "/hello", 1}});
+
+    options.isPipelined = true;
+  }
+
+  /**
+   * @brief Serve segments from B, and fetch them from A at 1s with @p interest
+   */
+  void
+  fetch(const Interest& interest, const SegmentProducer::Policy& policy, Time duration)
+  {
+    FactoryCallbackApp::Install(getNode("B"), [this, policy] () -> shared_ptr<void> {
+        return make_shared<SegmentProducer>(policy, interests);
+      })
+      .Start(Seconds(0.01));
+
+    FactoryCallbackApp::Install(getNode("A"), [this, interest] () -> shared_ptr<void> {
+        auto face = make_shared<::ndn::Face>();
+        SegmentFetcher::fetch(*face, interest, make_shared<::ndn::ValidatorNull>(), options,
+                              [this] (const ::ndn::ConstBufferPtr& data) {
+                                ++nDatas;
+                                dataSize = data->size();
+                                completionTime = Simulator::Now();
+                              },
+                              [this] (uint32_t code, const std::string&) {
+                                ++nErrors;
+                                lastError = code;
+                              });
+        return face;
+      })
+      .Start(Seconds(1));
+
+    Simulator::Stop(duration);
+    Simulator::Run();
+  }
+
+public:
+  SegmentFetcher::Options options;
+  std::vector<Interest> interests; ///< Interests received by the producer
+
+  uint32_t nErrors;
+  uint32_t lastError;
+  uint32_t nDatas;
+  size_t dataSize;
+  Time completionTime;
+};
+
+BOOST_FIXTURE_TEST_SUITE(NdnCxxSegmentFetcher, SegmentFetcherFixture)
+
+BOOST_AUTO_TEST_CASE(PipelinedOutOfOrder)
+{
+  // segment 2 arrives before segment 1
+  fetch(Interest("/hello/world", ::ndn::time::seconds(1000)),
+        [] (uint64_t segmentNo) { return segmentNo == 1 ? MilliSeconds(100) : Seconds(0); },
+        Seconds(5));
+
+  // window has grown to two segments after the first one
+  BOOST_REQUIRE_EQUAL(interests.size(), 3);
+  BOOST_CHECK_EQUAL(interests[0].getName(), "/hello/world");
+  BOOST_CHECK_EQUAL(interests[1].getName(), "/hello/world/version0/%00%01");
+  BOOST_CHECK_EQUAL(interests[1].getMustBeFresh(), false);
+  BOOST_CHECK_EQUAL(interests[1].getChildSelector(), 0);
+  BOOST_CHECK_EQUAL(interests[2].getName(), "/hello/world/version0/%00%02");
+
+  // segment 2 is kept until segment 1 arrives, rather than fetched again
+  BOOST_CHECK_EQUAL(nErrors, 0);
+  BOOST_CHECK_EQUAL(nDatas, 1);
+  BOOST_CHECK_EQUAL(dataSize, 42);
+  BOOST_CHECK_GT(completionTime, Seconds(1.1));
+}
+
+BOOST_AUTO_TEST_CASE(PipelinedBeyondFinal)
+{
+  // segments 3 and 4 are requested before the final segment 2 arrives, and never answered
+  fetch(Interest("/hello/world", ::ndn::time::seconds(10)),
+        [] (uint64_t segmentNo) {
+          return segmentNo == 2 ? MilliSeconds(50) : segmentNo > 2 ? Seconds(-1) : Seconds(0);
+        },
+        Seconds(30));
+
+  BOOST_REQUIRE_EQUAL(interests.size(), 5);
+  BOOST_CHECK_EQUAL(interests[3].getName(), "/hello/world/version0/%00%03");
+  BOOST_CHECK_EQUAL(interests[4].getName(), "/hello/world/version0/%00%04");
+
+  // Interests beyond the final segment are cancelled: they neither time out nor are retransmitted
+  BOOST_CHECK_EQUAL(nErrors, 0);
+  BOOST_CHECK_EQUAL(nDatas, 1);
+  BOOST_CHECK_EQUAL(dataSize, 42);
+}
+
+BOOST_AUTO_TEST_CASE(PipelinedTimeout)
+{
+  options.maxRetransmissions = 1;
+
+  // only the discovery Interest is answered
+  fetch(Interest("/hello/world", ::ndn::time::milliseconds(100)),
+        [] (uint64_t segmentNo) { return segmentNo == 0 ? Seconds(0) : Seconds(-1); },
+        Seconds(5));
+
+  // both segments are retransmitted once, then the fetch fails
+  BOOST_REQUIRE_EQUAL(interests.size(), 5);
+  BOOST_CHECK_EQUAL(interests[3].getName(), "/hello/world/version0/%00%01");
+  BOOST_CHECK_EQUAL(interests[4].getName(), "/hello/world/version0/%00%02");
+
+  BOOST_CHECK_EQUAL(nErrors, 1);
+  BOOST_CHECK_EQUAL(lastError, static_cast<uint32_t>(SegmentFetcher::INTEREST_TIMEOUT));
+  BOOST_CHECK_EQUAL(nDatas, 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,148 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/ndn-nlsr-fast-forward.hpp"
+
+#include "helper/ndn-link-control-helper.hpp"
+
+#include "nlsr.hpp"
+
+#include "../NLSR/nlsr-app-fixture.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class NlsrFastForwardFixture : public NlsrAppFixture
+{
+public:
+  NlsrFastForwardFixture()
+  {
+    auto configA = makeConfig("A", "B");
+    auto configB = makeConfig("B", "A");
+
+    // start from the converged network, so that only periodic tasks remain
+    auto snapshot = std::make_shared<nlsr::LsdbSnapshot>();
+    snapshot->addRouter(*configA);
+    snapshot->addRouter(*configB);
+
+    appA = installNlsr("A", configA, snapshot);
+    appB = installNlsr("B", configB, snapshot);
+
+    nodes.Add(getNode("A"));
+    nodes.Add(getNode("B"));
+  }
+
+  uint64_t
+  getNInInterests()
+  {
+    return getFace("B", "A")->getCounters().nInInterests;
+  }
+
+public:
+  Ptr<NlsrApp> appA;
+  Ptr<NlsrApp> appB;
+  NodeContainer nodes;
+};
+
+BOOST_FIXTURE_TEST_SUITE(UtilsNdnNlsrFastForward, NlsrFastForwardFixture)
+
+BOOST_AUTO_TEST_CASE(Quiescence)
+{
+  advanceClocks(Seconds(1));
+
+  nlsr::Nlsr& nlsr = appA->GetNlsr();
+  BOOST_CHECK(nlsr.isQuiescent());
+
+  // A HELLO retry is under way
+  ::ndn::Name neighbor("/ndn/site/%C1.router/B");
+  nlsr.getAdjacencyList().incrementTimedOutInterestCount(neighbor);
+  BOOST_CHECK(!nlsr.isQuiescent());
+  nlsr.getAdjacencyList().setTimedOutInterestCount(neighbor, 0);
+  BOOST_CHECK(nlsr.isQuiescent());
+}
+
+BOOST_AUTO_TEST_CASE(SuspendAndResume)
+{
+  NlsrFastForward fastForward(nodes, Seconds(10));
+  fastForward.Start(Seconds(0));
+
+  advanceClocks(Seconds(30));
+  BOOST_REQUIRE(fastForward.IsSuspended());
+  BOOST_CHECK_EQUAL(fastForward.GetNSuspensions(), 1);
+
+  ::ndn::Name key("/ndn/site/%C1.router/B");
+  key.append(nlsr::NameLsa::TYPE_STRING);
+  nlsr::NameLsa* lsa = appA->GetNlsr().getLsdb().findNameLsa(key);
+  BOOST_REQUIRE(lsa != nullptr);
+  ::ndn::time::system_clock::TimePoint expiration = lsa->getExpirationTimePoint();
+
+  // no HELLO or sync Interest while suspended
+  uint64_t nInInterests = getNInInterests();
+  advanceClocks(Seconds(100));
+  BOOST_CHECK_EQUAL(getNInInterests(), nInInterests);
+
+  fastForward.Wake();
+  advanceClocks(Seconds(0));
+  BOOST_CHECK(!fastForward.IsSuspended());
+
+  // LSA lifetimes are extended by the suspended time
+  BOOST_CHECK_GT(fastForward.GetSuspendedTime(), Seconds(100));
+  ::ndn::time::nanoseconds suspended(fastForward.GetSuspendedTime().GetNanoSeconds());
+  BOOST_CHECK(lsa->getExpirationTimePoint() == expiration + suspended);
+
+  // at least three HELLO rounds were skipped on each router
+  BOOST_CHECK_GE(fastForward.GetNSuppressedInterests(), 6);
+
+  // HELLOs are sent again, until the network is quiescent for another quiet period
+  advanceClocks(Seconds(5));
+  BOOST_CHECK_GT(getNInInterests(), nInInterests);
+
+  advanceClocks(Seconds(30));
+  BOOST_CHECK(fastForward.IsSuspended());
+  BOOST_CHECK_EQUAL(fastForward.GetNSuspensions(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(WakeBeforeQuietPeriodEnds)
+{
+  // longer than the HELLO interval, so that a failure is detected within a quiet period
+  NlsrFastForward fastForward(nodes, Seconds(40));
+  fastForward.Start(Seconds(0));
+
+  advanceClocks(Seconds(39.5));
+  BOOST_REQUIRE(!fastForward.IsSuspended());
+
+  // the failure happens while NLSR still looks quiescent: the next HELLO is only due at 40s
+  fastForward.Wake();
+  LinkControlHelper::FailLink(getNode("A"), getNode("B"));
+
+  advanceClocks(Seconds(1));
+  BOOST_CHECK(!fastForward.IsSuspended());
+  BOOST_CHECK_EQUAL(fastForward.GetNSuspensions(), 0);
+
+  advanceClocks(Seconds(30));
+  ::ndn::Name neighbor("/ndn/site/%C1.router/B");
+  BOOST_CHECK_EQUAL(appA->GetNlsr().getAdjacencyList().getStatusOfNeighbor(neighbor),
+                    nlsr::Adjacent::STATUS_INACTIVE);
+  BOOST_CHECK_EQUAL(fastForward.GetNSuspensions(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,92 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/ndn-zipf-mandelbrot-sampler.hpp"
+
+#include "../tests-common.hpp"
+
+#include <cmath>
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_AUTO_TEST_SUITE(UtilsNdnZipfMandelbrotSampler)
+
+BOOST_AUTO_TEST_CASE(Shared)
+{
+  shared_ptr<const ZipfMandelbrotSampler> sampler = ZipfMandelbrotSampler::Get(100, 0.7, 0.7);
+  BOOST_CHECK_EQUAL(sampler, ZipfMandelbrotSampler::Get(100, 0.7, 0.7));
+  BOOST_CHECK_NE(sampler, ZipfMandelbrotSampler::Get(100, 0.7, 0.8));
+  BOOST_CHECK_NE(sampler, ZipfMandelbrotSampler::Get(200, 0.7, 0.7));
+  BOOST_CHECK_EQUAL(sampler->GetNumberOfContents(), 100);
+}
+
+BOOST_AUTO_TEST_CASE(Released)
+{
+  shared_ptr<const ZipfMandelbrotSampler> sampler = ZipfMandelbrotSampler::Get(300, 0.7, 0.7);
+  std::weak_ptr<const ZipfMandelbrotSampler> weak = sampler;
+  sampler.reset();
+  BOOST_CHECK(weak.expired());
+
+  // the expired entry is dropped, and the sampler built again when needed
+  BOOST_CHECK(ZipfMandelbrotSampler::Get(100, 0.7, 0.9) != nullptr);
+  sampler = ZipfMandelbrotSampler::Get(300, 0.7, 0.7);
+  BOOST_REQUIRE(sampler != nullptr);
+  BOOST_CHECK_EQUAL(sampler->GetNumberOfContents(), 300);
+}
+
+BOOST_AUTO_TEST_CASE(Distribution)
+{
+  const uint32_t nContents = 100;
+  const double q = 0.7;
+  const double s = 0.7;
+  const uint32_t nSamples = 100000;
+
+  ZipfMandelbrotSampler sampler(nContents, q, s);
+
+  // stratified uniform values, so that frequencies only deviate by discretization
+  std::vector<uint32_t> counts(nContents + 1);
+  for (uint32_t i = 0; i < nSamples; ++i) {
+    uint32_t rank = sampler.Sample((i + 0.5) / nSamples);
+    BOOST_REQUIRE_GE(rank, 1);
+    BOOST_REQUIRE_LE(rank, nContents);
+    ++counts[rank];
+  }
+
+  double sum = 0;
+  for (uint32_t rank = 1; rank <= nContents; ++rank) {
+    sum += 1.0 / std::pow(rank + q, s);
+  }
+  for (uint32_t rank = 1; rank <= nContents; ++rank) {
+    double expected = 1.0 / std::pow(rank + q, s) / sum;
+    BOOST_CHECK_SMALL(static_cast<double>(counts[rank]) / nSamples - expected, 0.001);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(SingleContent)
+{
+  ZipfMandelbrotSampler sampler(1, 0.7, 0.7);
+  BOOST_CHECK_EQUAL(sampler.Sample(0.0), 1);
+  BOOST_CHECK_EQUAL(sampler.Sample(0.999999), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,114 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/topology/graph-partitioner.hpp"
+
+#include "../../tests-common.hpp"
+
+#include <algorithm>
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_AUTO_TEST_SUITE(UtilsTopologyGraphPartitioner)
+
+static GraphPartitioner
+makeGrid(uint32_t width)
+{
+  GraphPartitioner graph(width * width);
+  for (uint32_t row = 0; row < width; ++row) {
+    for (uint32_t column = 0; column < width; ++column) {
+      uint32_t v = row * width + column;
+      if (column + 1 < width) {
+        graph.AddEdge(v, v + 1);
+      }
+      if (row + 1 < width) {
+        graph.AddEdge(v, v + width);
+      }
+    }
+  }
+  return graph;
+}
+
+BOOST_AUTO_TEST_CASE(SinglePart)
+{
+  GraphPartitioner graph = makeGrid(4);
+  std::vector<uint32_t> parts = graph.Partition(1);
+  BOOST_CHECK_EQUAL(parts.size(), 16);
+  BOOST_CHECK_EQUAL(graph.GetEdgeCut(parts), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Grid)
+{
+  const uint32_t width = 40;
+  GraphPartitioner graph = makeGrid(width);
+
+  // the optimal bisection cuts one row of links
+  std::vector<uint32_t> parts = graph.Partition(2);
+  BOOST_CHECK_EQUAL(graph.GetEdgeCut(parts), width);
+
+  parts = graph.Partition(4);
+  BOOST_CHECK_LE(graph.GetEdgeCut(parts), 4 * width);
+
+  std::vector<uint64_t> weights(4, 0);
+  uint64_t totalWeight = 0;
+  for (uint32_t v = 0; v < parts.size(); ++v) {
+    BOOST_REQUIRE_LT(parts[v], 4);
+    weights[parts[v]] += graph.GetVertexWeight(v);
+    totalWeight += graph.GetVertexWeight(v);
+  }
+  for (uint64_t weight : weights) {
+    BOOST_CHECK_LE(weight, totalWeight / 4 * 1.1);
+    BOOST_CHECK_GE(weight, totalWeight / 4 * 0.9);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(DegreeWeights)
+{
+  // star: the hub weighs as much as all its leaves
+  GraphPartitioner graph(9);
+  for (uint32_t leaf = 1; leaf < 9; ++leaf) {
+    graph.AddEdge(0, leaf);
+  }
+  BOOST_CHECK_EQUAL(graph.GetVertexWeight(0), 8);
+  BOOST_CHECK_EQUAL(graph.GetVertexWeight(1), 1);
+
+  std::vector<uint32_t> parts = graph.Partition(2);
+  uint32_t nWithHub = std::count(parts.begin(), parts.end(), parts[0]);
+  BOOST_CHECK_LE(nWithHub, 2);
+}
+
+BOOST_AUTO_TEST_CASE(Disconnected)
+{
+  // two components, partitioned without cutting a link
+  GraphPartitioner graph(8);
+  for (uint32_t v = 0; v < 3; ++v) {
+    graph.AddEdge(v, v + 1);
+    graph.AddEdge(v + 4, v + 5);
+  }
+
+  std::vector<uint32_t> parts = graph.Partition(2);
+  BOOST_CHECK_EQUAL(graph.GetEdgeCut(parts), 0);
+  BOOST_CHECK_NE(parts[0], parts[4]);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
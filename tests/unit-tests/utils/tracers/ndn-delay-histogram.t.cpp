@@ -0,0 +1,84 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/tracers/ndn-delay-histogram.hpp"
+
+#include "../../tests-common.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_AUTO_TEST_SUITE(UtilsTracersNdnDelayHistogram)
+
+BOOST_AUTO_TEST_CASE(Empty)
+{
+  DelayHistogram histogram;
+  BOOST_CHECK_EQUAL(histogram.GetCount(), 0);
+  BOOST_CHECK_EQUAL(histogram.GetQuantile(0.5), Seconds(0));
+  BOOST_CHECK_EQUAL(histogram.GetMean(), Seconds(0));
+  BOOST_CHECK_EQUAL(histogram.GetMax(), Seconds(0));
+}
+
+BOOST_AUTO_TEST_CASE(SmallDelaysAreExact)
+{
+  DelayHistogram histogram;
+  for (int i = 1; i <= 100; ++i) {
+    histogram.Record(NanoSeconds(i));
+  }
+
+  BOOST_CHECK_EQUAL(histogram.GetCount(), 100);
+  BOOST_CHECK_EQUAL(histogram.GetMin(), NanoSeconds(1));
+  BOOST_CHECK_EQUAL(histogram.GetMax(), NanoSeconds(100));
+  BOOST_CHECK_EQUAL(histogram.GetQuantile(0.5), NanoSeconds(50));
+  BOOST_CHECK_EQUAL(histogram.GetQuantile(0.99), NanoSeconds(99));
+  BOOST_CHECK_EQUAL(histogram.GetQuantile(1.0), NanoSeconds(100));
+
+  histogram.Reset();
+  BOOST_CHECK_EQUAL(histogram.GetCount(), 0);
+  histogram.Record(NanoSeconds(7));
+  BOOST_CHECK_EQUAL(histogram.GetQuantile(0.5), NanoSeconds(7));
+}
+
+BOOST_AUTO_TEST_CASE(RelativeError)
+{
+  DelayHistogram histogram;
+  std::vector<int64_t> delays;
+  for (int i = 0; i < 10000; ++i) {
+    // from microseconds to seconds
+    int64_t delay = static_cast<int64_t>(std::pow(10.0, 3 + 6.0 * i / 10000));
+    delays.push_back(delay);
+    histogram.Record(NanoSeconds(delay));
+  }
+  std::sort(delays.begin(), delays.end());
+
+  for (double q : {0.01, 0.1, 0.5, 0.9, 0.99, 0.999}) {
+    double exact = delays[static_cast<size_t>(std::ceil(q * delays.size())) - 1];
+    double estimate = histogram.GetQuantile(q).GetNanoSeconds();
+    BOOST_CHECK_LE(std::abs(estimate - exact) / exact, 1.0 / (2 << DelayHistogram::PRECISION_BITS));
+  }
+  BOOST_CHECK_EQUAL(histogram.GetMax(), NanoSeconds(delays.back()));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,210 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/tracers/ndn-l3-rate-binary-tracer.hpp"
+
+#include <boost/filesystem.hpp>
+
+#include "../../tests-common.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <map>
+
+namespace ns3 {
+namespace ndn {
+
+const boost::filesystem::path TEST_BINARY_TRACE =
+  boost::filesystem::path(TEST_CONFIG_PATH) / "rate-trace.bin";
+
+class L3RateBinaryTracerFixture : public ScenarioHelperWithCleanupFixture
+{
+public:
+  L3RateBinaryTracerFixture()
+  {
+    boost::filesystem::create_directories(TEST_CONFIG_PATH);
+
+    Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("10Mbps"));
+    Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("10ms"));
+    Config::SetDefault("ns3::DropTailQueue::MaxPackets", StringValue("20"));
+
+    createTopology({
+        {"1", "2"},
+        {"2", "3"}
+      });
+
+    addRoutes({
+        {"1", "2", "/prefix", 1},
+        {"2", "3", "/prefix", 1}
+      });
+
+    addApps({
+        {"1", "ns3::ndn::ConsumerCbr",
+            {{"Prefix", "/prefix"}, {"Frequency", "10"}},
+            "0s", "100s"},
+        {"3", "ns3::ndn::Producer",
+            {{"Prefix", "/prefix"}, {"PayloadSize", "1024"}},
+            "0s", "100s"}
+      });
+  }
+
+  ~L3RateBinaryTracerFixture()
+  {
+    L3RateBinaryTracer::Destroy();
+    boost::filesystem::remove(TEST_BINARY_TRACE);
+  }
+
+  struct Period {
+    int64_t time;
+    std::map<std::string, uint64_t> inInterests; ///< node name => InInterests on all faces
+    std::map<std::string, uint64_t> inDataBytes; ///< node name => InData bytes on all faces
+  };
+
+  struct Trace {
+    int64_t period;
+    std::map<uint32_t, std::string> nodes;
+    std::map<std::pair<uint32_t, uint32_t>, std::string> faces;
+    std::vector<Period> periods;
+  };
+
+  template<typename T>
+  static T
+  readValue(std::istream& is)
+  {
+    T value = 0;
+    is.read(reinterpret_cast<char*>(&value), sizeof(value));
+    return value;
+  }
+
+  static std::string
+  readString(std::istream& is)
+  {
+    std::string str(readValue<uint16_t>(is), '\0');
+    is.read(&str[0], str.size());
+    return str;
+  }
+
+  Trace
+  readTrace()
+  {
+    std::ifstream is(TEST_BINARY_TRACE.string().c_str(), std::ios_base::binary);
+    char magic[8];
+    is.read(magic, sizeof(magic));
+    BOOST_REQUIRE(is && std::memcmp(magic, "NDNL3RB1", sizeof(magic)) == 0);
+
+    Trace trace;
+    trace.period = readValue<int64_t>(is);
+
+    char type;
+    while (is.get(type)) {
+      switch (type) {
+        case 'N': {
+          uint32_t node = readValue<uint32_t>(is);
+          trace.nodes[node] = readString(is);
+          break;
+        }
+        case 'T':
+          trace.periods.push_back(Period{readValue<int64_t>(is)});
+          break;
+        case 'F': {
+          uint32_t node = readValue<uint32_t>(is);
+          uint32_t face = readValue<uint32_t>(is);
+          trace.faces[{node, face}] = readString(is);
+          break;
+        }
+        case 'S': {
+          BOOST_REQUIRE(!trace.periods.empty());
+          const std::string& node = trace.nodes.at(readValue<uint32_t>(is));
+          uint32_t nRows = readValue<uint32_t>(is);
+
+          std::vector<uint32_t> faces(nRows);
+          is.read(reinterpret_cast<char*>(faces.data()), nRows * sizeof(uint32_t));
+
+          std::vector<uint32_t> packets(nRows * L3RateBinaryTracer::N_COUNTERS);
+          is.read(reinterpret_cast<char*>(packets.data()), packets.size() * sizeof(uint32_t));
+
+          std::vector<uint64_t> bytes(nRows * L3RateBinaryTracer::N_BYTE_COUNTERS);
+          is.read(reinterpret_cast<char*>(bytes.data()), bytes.size() * sizeof(uint64_t));
+
+          Period& period = trace.periods.back();
+          for (uint32_t row = 0; row < nRows; ++row) {
+            period.inInterests[node] += packets[L3RateBinaryTracer::IN_INTERESTS * nRows + row];
+            period.inDataBytes[node] += bytes[L3RateBinaryTracer::IN_DATA * nRows + row];
+          }
+          break;
+        }
+        default:
+          BOOST_FAIL("unexpected record type " << type);
+      }
+      BOOST_REQUIRE(is);
+    }
+    return trace;
+  }
+};
+
+BOOST_FIXTURE_TEST_SUITE(UtilsTracersNdnL3RateBinaryTracer, L3RateBinaryTracerFixture)
+
+BOOST_AUTO_TEST_CASE(InstallAll)
+{
+  L3RateBinaryTracer::InstallAll(TEST_BINARY_TRACE.string(), Seconds(1));
+
+  Simulator::Stop(Seconds(3.5));
+  Simulator::Run();
+
+  L3RateBinaryTracer::Destroy(); // to force the last period to be written
+
+  Trace trace = readTrace();
+  BOOST_CHECK_EQUAL(trace.period, Seconds(1).GetNanoSeconds());
+  BOOST_CHECK_EQUAL(trace.nodes.size(), 3);
+  BOOST_CHECK(!trace.faces.empty());
+
+  BOOST_REQUIRE_EQUAL(trace.periods.size(), 4);
+  BOOST_CHECK_EQUAL(trace.periods[0].time, Seconds(1).GetNanoSeconds());
+  BOOST_CHECK_EQUAL(trace.periods[3].time, Seconds(3.5).GetNanoSeconds());
+
+  for (auto& period : trace.periods) {
+    BOOST_CHECK_GT(period.inInterests["2"], 0);
+    BOOST_CHECK_GT(period.inInterests["3"], 0);
+    BOOST_CHECK_GT(period.inDataBytes["1"], 1024);
+  }
+  // the last period is half as long
+  BOOST_CHECK_LT(trace.periods[3].inInterests["3"], trace.periods[1].inInterests["3"]);
+}
+
+BOOST_AUTO_TEST_CASE(SimulationEnd)
+{
+  NodeContainer nodes;
+  nodes.Add(getNode("2"));
+  L3RateBinaryTracer::Install(nodes, TEST_BINARY_TRACE.string(), Seconds(1));
+
+  Simulator::Stop(Seconds(2.5));
+  Simulator::Run();
+  Simulator::Destroy(); // writes the last period without an explicit Destroy()
+
+  Trace trace = readTrace();
+  BOOST_CHECK_EQUAL(trace.nodes.size(), 1);
+  BOOST_REQUIRE_EQUAL(trace.periods.size(), 3);
+  BOOST_CHECK_EQUAL(trace.periods[2].time, Seconds(2.5).GetNanoSeconds());
+  BOOST_CHECK_GT(trace.periods[2].inInterests["2"], 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
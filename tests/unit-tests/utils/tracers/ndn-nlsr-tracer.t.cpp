@@ -0,0 +1,199 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/tracers/ndn-nlsr-tracer.hpp"
+
+#include "ns3/node-container.h"
+
+#include "../../tests-common.hpp"
+
+#include <cstring>
+#include <limits>
+#include <map>
+
+namespace ns3 {
+namespace ndn {
+
+const std::string TEST_NLSR_TRACE_PREFIX = "nlsr-tracer-test";
+const boost::filesystem::path TEST_NLSR_TRACE =
+  boost::filesystem::current_path() / (TEST_NLSR_TRACE_PREFIX + "-node-nlsr-trace.bin");
+
+static void
+TraceName(NlsrTracer::Event event, std::string name, uint64_t count, uint64_t size)
+{
+  NlsrTracer::Instance().Trace(event, ::ndn::Name(name), count, size);
+}
+
+static void
+TraceCount(NlsrTracer::Event event, uint64_t count)
+{
+  NlsrTracer::Instance().Trace(event, count);
+}
+
+class NlsrTracerFixture : public CleanupFixture
+{
+public:
+  ~NlsrTracerFixture()
+  {
+    boost::filesystem::remove(TEST_NLSR_TRACE);
+  }
+
+  struct Record {
+    int64_t time;
+    uint32_t node;
+    uint8_t event;
+    uint32_t nameId;
+    uint64_t count;
+    uint64_t size;
+  };
+
+  struct Trace {
+    std::map<uint32_t, std::string> nodes;
+    std::map<uint32_t, std::string> names;
+    std::vector<Record> events;
+  };
+
+  template<typename T>
+  static T
+  readValue(std::istream& is)
+  {
+    T value = 0;
+    is.read(reinterpret_cast<char*>(&value), sizeof(value));
+    return value;
+  }
+
+  static std::string
+  readString(std::istream& is)
+  {
+    std::string str(readValue<uint16_t>(is), '\0');
+    is.read(&str[0], str.size());
+    return str;
+  }
+
+  Trace
+  readTrace()
+  {
+    std::ifstream is(TEST_NLSR_TRACE.string().c_str(), std::ios_base::binary);
+    char magic[8];
+    is.read(magic, sizeof(magic));
+    BOOST_REQUIRE(is && std::memcmp(magic, "NLSRTRB1", sizeof(magic)) == 0);
+
+    Trace trace;
+    char type;
+    while (is.get(type)) {
+      switch (type) {
+        case 'N': {
+          uint32_t node = readValue<uint32_t>(is);
+          trace.nodes[node] = readString(is);
+          break;
+        }
+        case 'S': {
+          uint32_t nameId = readValue<uint32_t>(is);
+          trace.names[nameId] = readString(is);
+          break;
+        }
+        case 'R':
+          trace.names.clear();
+          break;
+        case 'E': {
+          Record record;
+          record.time = readValue<int64_t>(is);
+          record.node = readValue<uint32_t>(is);
+          record.event = readValue<uint8_t>(is);
+          record.nameId = readValue<uint32_t>(is);
+          record.count = readValue<uint64_t>(is);
+          record.size = readValue<uint64_t>(is);
+          // a node or name is defined before the first event that refers to it
+          BOOST_CHECK_EQUAL(trace.nodes.count(record.node), 1);
+          BOOST_CHECK(record.nameId == 0xFFFFFFFF || trace.names.count(record.nameId) == 1);
+          trace.events.push_back(record);
+          break;
+        }
+        default:
+          BOOST_FAIL("unexpected record type " << type);
+      }
+      BOOST_REQUIRE(is);
+    }
+    return trace;
+  }
+};
+
+BOOST_FIXTURE_TEST_SUITE(UtilsTracersNdnNlsrTracer, NlsrTracerFixture)
+
+BOOST_AUTO_TEST_CASE(BinaryRoundTrip)
+{
+  NodeContainer nodes;
+  nodes.Create(2);
+  Names::Add("A", nodes.Get(0));
+
+  NlsrTracer& tracer = NlsrTracer::Instance();
+  BOOST_REQUIRE(tracer.IsEnabled());
+  tracer.InitializeTracer(TEST_NLSR_TRACE_PREFIX, NlsrTracer::BINARY);
+
+  uint32_t a = nodes.Get(0)->GetId();
+  uint32_t b = nodes.Get(1)->GetId();
+  Simulator::ScheduleWithContext(a, Seconds(1), &TraceName, NlsrTracer::OUT_HELLO_INTEREST,
+                                 "/ndn/A/INFO", 1, 120);
+  Simulator::ScheduleWithContext(b, Seconds(1.5), &TraceName, NlsrTracer::IN_HELLO_INTEREST,
+                                 "/ndn/A/INFO", 1, 120);
+  Simulator::ScheduleWithContext(b, Seconds(2), &TraceName, NlsrTracer::OUT_ADJ_LSA_DATA,
+                                 "/ndn/B/LSA/adjacency", 3, 2000);
+  Simulator::ScheduleWithContext(a, Seconds(3), &TraceCount, NlsrTracer::DIJK_SINGLE_PATH, 7);
+
+  Simulator::Run();
+  Simulator::Destroy(); // closes the binary file
+
+  Trace trace = readTrace();
+  BOOST_CHECK_EQUAL(trace.nodes[a], "A");
+  BOOST_CHECK_EQUAL(trace.nodes[b], std::to_string(b));
+  BOOST_CHECK_EQUAL(trace.names.size(), 2); // "/ndn/A/INFO" is defined once
+
+  BOOST_REQUIRE_EQUAL(trace.events.size(), 4);
+
+  const Record& outHello = trace.events[0];
+  BOOST_CHECK_EQUAL(outHello.time, Seconds(1).GetNanoSeconds());
+  BOOST_CHECK_EQUAL(outHello.node, a);
+  BOOST_CHECK_EQUAL(outHello.event, NlsrTracer::OUT_HELLO_INTEREST);
+  BOOST_CHECK_EQUAL(trace.names[outHello.nameId], "/ndn/A/INFO");
+  BOOST_CHECK_EQUAL(outHello.count, 1);
+  BOOST_CHECK_EQUAL(outHello.size, 120);
+
+  const Record& inHello = trace.events[1];
+  BOOST_CHECK_EQUAL(inHello.node, b);
+  BOOST_CHECK_EQUAL(inHello.event, NlsrTracer::IN_HELLO_INTEREST);
+  BOOST_CHECK_EQUAL(inHello.nameId, outHello.nameId);
+
+  const Record& adjData = trace.events[2];
+  BOOST_CHECK_EQUAL(adjData.event, NlsrTracer::OUT_ADJ_LSA_DATA);
+  BOOST_CHECK_EQUAL(trace.names[adjData.nameId], "/ndn/B/LSA/adjacency");
+  BOOST_CHECK_EQUAL(adjData.count, 3);
+  BOOST_CHECK_EQUAL(adjData.size, 2000);
+
+  const Record& dijkstra = trace.events[3];
+  BOOST_CHECK_EQUAL(dijkstra.time, Seconds(3).GetNanoSeconds());
+  BOOST_CHECK_EQUAL(dijkstra.event, NlsrTracer::DIJK_SINGLE_PATH);
+  BOOST_CHECK_EQUAL(dijkstra.nameId, 0xFFFFFFFF);
+  BOOST_CHECK_EQUAL(dijkstra.count, 7);
+  BOOST_CHECK_EQUAL(dijkstra.size, std::numeric_limits<uint64_t>::max());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,164 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/tracers/ndn-summary-tracer.hpp"
+
+#include <boost/filesystem.hpp>
+
+#include "../../tests-common.hpp"
+
+#include <algorithm>
+#include <map>
+
+namespace ns3 {
+namespace ndn {
+
+const boost::filesystem::path TEST_SUMMARY_TRACE =
+  boost::filesystem::path(TEST_CONFIG_PATH) / "summary-trace.txt";
+
+class SummaryTracerFixture : public ScenarioHelperWithCleanupFixture
+{
+public:
+  SummaryTracerFixture()
+  {
+    boost::filesystem::create_directories(TEST_CONFIG_PATH);
+
+    Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("10Mbps"));
+    Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("10ms"));
+    Config::SetDefault("ns3::DropTailQueue::MaxPackets", StringValue("20"));
+
+    createTopology({
+        {"1", "2"},
+        {"2", "3"}
+      });
+
+    addRoutes({
+        {"1", "2", "/prefix", 1},
+        {"2", "3", "/prefix", 1}
+      });
+
+    addApps({
+        {"1", "ns3::ndn::ConsumerCbr",
+            {{"Prefix", "/prefix"}, {"Frequency", "1"}},
+            "0s", "0.9s"}, // send just one packet
+        {"2", "ns3::ndn::ConsumerCbr",
+            {{"Prefix", "/prefix"}, {"Frequency", "1"}},
+            "2s", "100s"},
+        {"3", "ns3::ndn::Producer",
+            {{"Prefix", "/prefix"}, {"PayloadSize", "1024"}},
+            "0s", "100s"}
+      });
+  }
+
+  ~SummaryTracerFixture()
+  {
+    boost::filesystem::remove(TEST_SUMMARY_TRACE);
+    SummaryTracer::Destroy();
+  }
+
+  struct Totals {
+    size_t nRows;
+    std::map<std::string, double> sums; ///< Type => sum over periods of the "all" rows
+    std::map<std::string, double> maxs; ///< Type => max over periods of the "all" rows
+    std::map<std::string, double> nodeSums; ///< Node/Type => sum over periods
+  };
+
+  Totals
+  readTrace()
+  {
+    std::ifstream is(TEST_SUMMARY_TRACE.string().c_str());
+    std::string header;
+    std::getline(is, header);
+    BOOST_CHECK_EQUAL(header, "Time\tNode\tType\tValue");
+
+    Totals totals{0};
+    double time;
+    std::string node, type;
+    double value;
+    while (is >> time >> node >> type >> value) {
+      ++totals.nRows;
+      if (node == "all") {
+        totals.sums[type] += value;
+        totals.maxs[type] = std::max(totals.maxs[type], value);
+      }
+      else {
+        totals.nodeSums[node + "/" + type] += value;
+      }
+    }
+    return totals;
+  }
+};
+
+BOOST_FIXTURE_TEST_SUITE(UtilsTracersNdnSummaryTracer, SummaryTracerFixture)
+
+BOOST_AUTO_TEST_CASE(InstallAll)
+{
+  SummaryTracer::InstallAll(TEST_SUMMARY_TRACE.string(), Seconds(1));
+
+  Simulator::Stop(Seconds(4));
+  Simulator::Run();
+
+  SummaryTracer::Destroy(); // to force the last period to be written
+
+  Totals totals = readTrace();
+
+  // same delays as in AppDelayTracer tests: 41.7424 ms, 0 (cached on node 2) and 20.8712 ms
+  BOOST_CHECK_EQUAL(totals.sums["FullDelaySamples"], 3);
+  BOOST_CHECK_EQUAL(totals.sums["LastDelaySamples"], 3);
+  BOOST_CHECK_CLOSE(totals.maxs["FullDelayMax"], 0.0417424, 0.001);
+  BOOST_CHECK_CLOSE(totals.maxs["FullDelayP99"], 0.0417424, 0.001);
+
+  BOOST_CHECK_GT(totals.sums["InInterests"], 0);
+  BOOST_CHECK_GT(totals.sums["InData"], 0);
+  BOOST_CHECK_GT(totals.sums["InDataKilobytes"], 1);
+
+  // no per-node rows by default
+  BOOST_CHECK(totals.nodeSums.empty());
+}
+
+BOOST_AUTO_TEST_CASE(PerNodeAndSampling)
+{
+  NodeContainer nodes;
+  nodes.Add(getNode("1"));
+  nodes.Add(getNode("2"));
+
+  SummaryTracer::Install(nodes, TEST_SUMMARY_TRACE.string(), Seconds(1), 2, true);
+
+  Simulator::Stop(Seconds(4));
+  Simulator::Run();
+
+  SummaryTracer::Destroy();
+
+  Totals totals = readTrace();
+
+  // first and third delays
+  BOOST_CHECK_EQUAL(totals.sums["FullDelaySamples"], 2);
+  BOOST_CHECK_CLOSE(totals.maxs["FullDelayMax"], 0.0417424, 0.001);
+
+  BOOST_CHECK_GT(totals.nodeSums["1/OutInterests"], 0);
+  BOOST_CHECK_GT(totals.nodeSums["2/InInterests"], 0);
+  BOOST_CHECK_EQUAL(totals.nodeSums.count("3/InInterests"), 0);
+  BOOST_CHECK_EQUAL(totals.sums["InInterests"],
+                    totals.nodeSums["1/InInterests"] + totals.nodeSums["2/InInterests"]);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,146 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/trie/trie-with-policy.hpp"
+#include "utils/trie/bucket-lfu-policy.hpp"
+#include "utils/trie/lfu-policy.hpp"
+
+#include "../../tests-common.hpp"
+
+#include <random>
+
+namespace ns3 {
+namespace ndn {
+
+using ndnSIM::trie_with_policy;
+using ndnSIM::pointer_payload_traits;
+using ndnSIM::lfu_policy_traits;
+using ndnSIM::bucket_lfu_policy_traits;
+
+class BucketLfuPolicyFixture {
+protected:
+  struct Entry {
+    explicit Entry(int value = 0)
+      : value(value)
+    {
+    }
+
+    int value;
+  };
+
+  typedef trie_with_policy<Name, pointer_payload_traits<Entry>, bucket_lfu_policy_traits>
+    BucketLfuTrie;
+  typedef trie_with_policy<Name, pointer_payload_traits<Entry>, lfu_policy_traits> LfuTrie;
+
+  /**
+   * @brief Request the entry in the trie: a hit if present, an insertion otherwise
+   */
+  template<class Trie>
+  static void
+  request(Trie& trie, const Name& name, Entry* entry)
+  {
+    if (trie.find_exact(name) != trie.end()) {
+      trie.longest_prefix_match(name);
+    }
+    else {
+      trie.insert(name, entry);
+    }
+  }
+
+  /**
+   * @return values of the entries, from the next to be evicted to the last one
+   */
+  template<class Trie>
+  static std::vector<int>
+  getEvictionOrder(Trie& trie)
+  {
+    std::vector<int> order;
+    for (auto& item : trie.getPolicy()) {
+      order.push_back(item.payload()->value);
+    }
+    return order;
+  }
+};
+
+BOOST_FIXTURE_TEST_SUITE(UtilsTrieBucketLfuPolicy, BucketLfuPolicyFixture)
+
+BOOST_AUTO_TEST_CASE(SameOrderAsLfu)
+{
+  const int nNames = 8;
+  std::vector<Entry> entries;
+  for (int i = 0; i < nNames; ++i) {
+    entries.emplace_back(i);
+  }
+
+  BucketLfuTrie bucketLfu;
+  LfuTrie lfu;
+  bucketLfu.getPolicy().set_max_size(4);
+  lfu.getPolicy().set_max_size(4);
+
+  // the few names and small cache give many evictions and ties between frequencies
+  std::minstd_rand random(1);
+  for (int i = 0; i < 1000; ++i) {
+    int value = random() % nNames;
+    Name name = Name("/n").appendNumber(value);
+    request(bucketLfu, name, &entries[value]);
+    request(lfu, name, &entries[value]);
+
+    BOOST_REQUIRE_EQUAL(bucketLfu.getPolicy().size(), lfu.getPolicy().size());
+    std::vector<int> bucketLfuOrder = getEvictionOrder(bucketLfu);
+    std::vector<int> lfuOrder = getEvictionOrder(lfu);
+    BOOST_REQUIRE_EQUAL_COLLECTIONS(bucketLfuOrder.begin(), bucketLfuOrder.end(),
+                                    lfuOrder.begin(), lfuOrder.end());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(EraseAndClear)
+{
+  Entry a(0), b(1), c(2);
+  BucketLfuTrie trie;
+  trie.getPolicy().set_max_size(0);
+
+  request(trie, "/a", &a);
+  request(trie, "/b", &b);
+  request(trie, "/c", &c);
+  request(trie, "/b", &b);
+  request(trie, "/b", &b);
+  request(trie, "/c", &c);
+
+  std::vector<int> order = getEvictionOrder(trie);
+  std::vector<int> expected = {0, 2, 1};
+  BOOST_CHECK_EQUAL_COLLECTIONS(order.begin(), order.end(), expected.begin(), expected.end());
+
+  // erasing the only entry of a bucket removes the bucket and keeps the others valid
+  trie.erase("/c");
+  request(trie, "/a", &a);
+  trie.erase("/a");
+  request(trie, "/c", &c);
+  request(trie, "/c", &c);
+  order = getEvictionOrder(trie);
+  expected = {2, 1};
+  BOOST_CHECK_EQUAL_COLLECTIONS(order.begin(), order.end(), expected.begin(), expected.end());
+
+  trie.clear();
+  BOOST_CHECK_EQUAL(trie.getPolicy().size(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
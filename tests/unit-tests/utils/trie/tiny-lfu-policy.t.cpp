@@ -0,0 +1,140 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/trie/trie-with-policy.hpp"
+#include "utils/trie/tiny-lfu-policy.hpp"
+
+#include "../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+using ndnSIM::trie_with_policy;
+using ndnSIM::pointer_payload_traits;
+using ndnSIM::tiny_lfu_policy_traits;
+using ndnSIM::detail::frequency_sketch;
+
+class TinyLfuPolicyFixture {
+protected:
+  struct Entry {
+    explicit Entry(int value = 0)
+      : value(value)
+    {
+    }
+
+    int value;
+  };
+
+  typedef trie_with_policy<Name, pointer_payload_traits<Entry>, tiny_lfu_policy_traits> Trie;
+
+  TinyLfuPolicyFixture()
+  {
+    // the window holds a single entry
+    trie.getPolicy().set_max_size(10);
+  }
+
+  Trie::iterator
+  insert(const Name& name)
+  {
+    entries.push_back(make_shared<Entry>(entries.size()));
+    return trie.insert(name, entries.back().get()).first;
+  }
+
+  void
+  request(const Name& name, int nTimes)
+  {
+    for (int i = 0; i < nTimes; ++i) {
+      BOOST_REQUIRE(trie.longest_prefix_match(name) != trie.end());
+    }
+  }
+
+  bool
+  contains(const Name& name)
+  {
+    return trie.find_exact(name) != trie.end();
+  }
+
+protected:
+  Trie trie;
+  std::vector<shared_ptr<Entry>> entries;
+};
+
+BOOST_FIXTURE_TEST_SUITE(UtilsTrieTinyLfuPolicy, TinyLfuPolicyFixture)
+
+BOOST_AUTO_TEST_CASE(RefuseOneHitCandidate)
+{
+  insert("/popular");
+  request("/popular", 5);
+  for (int i = 1; i < 10; ++i) {
+    insert(Name("/one-hit").appendNumber(i));
+  }
+  BOOST_CHECK_EQUAL(trie.getPolicy().size(), 10);
+
+  // /one-hit/9 leaves the window, but is less popular than /popular, the LRU of the main part
+  insert("/new");
+  BOOST_CHECK_EQUAL(trie.getPolicy().size(), 10);
+  BOOST_CHECK(contains("/popular"));
+  BOOST_CHECK(!contains(Name("/one-hit").appendNumber(9)));
+  BOOST_CHECK(contains("/new"));
+}
+
+BOOST_AUTO_TEST_CASE(AdmitPopularCandidate)
+{
+  for (int i = 0; i < 10; ++i) {
+    insert(Name("/one-hit").appendNumber(i));
+  }
+  Name candidate = Name("/one-hit").appendNumber(9);
+  request(candidate, 7);
+
+  // the candidate leaving the window evicts /one-hit/0, the LRU of the main part
+  insert("/new");
+  BOOST_CHECK_EQUAL(trie.getPolicy().size(), 10);
+  BOOST_CHECK(contains(candidate));
+  BOOST_CHECK(!contains(Name("/one-hit").appendNumber(0)));
+  BOOST_CHECK(contains(Name("/one-hit").appendNumber(1)));
+}
+
+BOOST_AUTO_TEST_CASE(SketchAging)
+{
+  frequency_sketch sketch;
+  sketch.resize(1); // counters are halved every 10 increments
+  const size_t hash = 0x2a;
+
+  for (int i = 0; i < 9; ++i) {
+    sketch.increment(hash);
+  }
+  BOOST_CHECK_EQUAL(sketch.estimate(hash), 9);
+
+  sketch.increment(hash);
+  BOOST_CHECK_EQUAL(sketch.estimate(hash), 5);
+
+  // the count of increments is halved as well
+  for (int i = 0; i < 4; ++i) {
+    sketch.increment(hash);
+  }
+  BOOST_CHECK_EQUAL(sketch.estimate(hash), 9);
+
+  sketch.increment(hash);
+  BOOST_CHECK_EQUAL(sketch.estimate(hash), 5);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
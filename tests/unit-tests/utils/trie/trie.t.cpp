@@ -0,0 +1,158 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/trie/trie-with-policy.hpp"
+#include "utils/trie/lru-policy.hpp"
+
+#include "../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+using ndnSIM::trie_with_policy;
+using ndnSIM::pointer_payload_traits;
+using ndnSIM::lru_policy_traits;
+
+class TrieFixture {
+protected:
+  struct Entry {
+    explicit Entry(int value = 0)
+      : value(value)
+    {
+    }
+
+    int value;
+  };
+
+  typedef trie_with_policy<Name, pointer_payload_traits<Entry>, lru_policy_traits> Trie;
+
+  TrieFixture()
+  {
+    trie.getPolicy().set_max_size(0);
+  }
+
+  Trie::iterator
+  insert(const Name& name)
+  {
+    entries.push_back(make_shared<Entry>(entries.size()));
+    return trie.insert(name, entries.back().get()).first;
+  }
+
+protected:
+  Trie trie;
+  std::vector<shared_ptr<Entry>> entries;
+};
+
+BOOST_FIXTURE_TEST_SUITE(UtilsTrie, TrieFixture)
+
+BOOST_AUTO_TEST_CASE(CompressedChain)
+{
+  Trie::iterator leaf = insert("/a/b/c/d");
+
+  // a single node holds the whole name below the root
+  BOOST_CHECK_EQUAL(leaf->key(), name::Component("a"));
+  BOOST_CHECK_EQUAL(leaf->suffix().size(), 3);
+  BOOST_CHECK(leaf->parent() == &trie.getTrie());
+
+  BOOST_CHECK(trie.find_exact("/a/b/c/d") == leaf);
+  BOOST_CHECK(trie.find_exact("/a/b") == trie.end());
+  BOOST_CHECK(trie.find_exact("/a/b/c/d/e") == trie.end());
+}
+
+BOOST_AUTO_TEST_CASE(SplitAndMerge)
+{
+  Trie::iterator abcd = insert("/a/b/c/d");
+  Trie::iterator abxy = insert("/a/b/x/y");
+
+  // the chain is split at /a/b, and nodes with payload keep their identity
+  BOOST_CHECK(trie.find_exact("/a/b/c/d") == abcd);
+  BOOST_CHECK(trie.find_exact("/a/b/x/y") == abxy);
+  BOOST_CHECK_EQUAL(abcd->key(), name::Component("c"));
+  BOOST_CHECK_EQUAL(abcd->suffix().size(), 1);
+  BOOST_REQUIRE(abcd->parent() == abxy->parent());
+  BOOST_CHECK_EQUAL(abcd->parent()->key(), name::Component("a"));
+  BOOST_CHECK_EQUAL(abcd->parent()->suffix().size(), 1);
+  BOOST_CHECK(trie.find_exact("/a/b") == trie.end());
+
+  Trie::iterator ab = insert("/a/b");
+  BOOST_CHECK(ab == abcd->parent());
+  BOOST_CHECK_EQUAL(ab->payload(), entries.back().get());
+
+  // without its payload and with a single child left, /a/b is merged back into /a/b/c/d
+  trie.erase(abxy);
+  trie.erase(ab);
+  BOOST_CHECK(trie.find_exact("/a/b/c/d") == abcd);
+  BOOST_CHECK_EQUAL(abcd->key(), name::Component("a"));
+  BOOST_CHECK_EQUAL(abcd->suffix().size(), 3);
+  BOOST_CHECK(abcd->parent() == &trie.getTrie());
+
+  trie.erase(abcd);
+  BOOST_CHECK(trie.find_exact("/a/b/c/d") == trie.end());
+  BOOST_CHECK_EQUAL(trie.getPolicy().size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(PrefixWithinLabel)
+{
+  Trie::iterator abcd = insert("/a/b/c/d");
+
+  BOOST_CHECK(trie.longest_prefix_match("/a/b/c/d/e") == abcd);
+  BOOST_CHECK(trie.longest_prefix_match("/a/b") == trie.end());
+
+  // the key ends in the middle of the label of /a/b/c/d
+  BOOST_CHECK(trie.deepest_prefix_match("/a/b") == abcd);
+  BOOST_CHECK(trie.deepest_prefix_match("/a/x") == trie.end());
+
+  auto isC = [](const name::Component& component) { return component == name::Component("c"); };
+  BOOST_CHECK(trie.deepest_prefix_match_if_next_level("/a/b", isC) == abcd);
+  BOOST_CHECK(trie.deepest_prefix_match_if_next_level("/a", isC) == trie.end());
+}
+
+BOOST_AUTO_TEST_CASE(ManyChildren)
+{
+  const int nChildren = 3 * Trie::parent_trie::max_array_children;
+
+  // children move to a hash table past max_array_children, and back to the array
+  for (int i = 0; i < nChildren; ++i) {
+    insert(Name("/p").appendSequenceNumber(i));
+  }
+  for (int i = 0; i < nChildren; ++i) {
+    Trie::iterator item = trie.find_exact(Name("/p").appendSequenceNumber(i));
+    BOOST_REQUIRE(item != trie.end());
+    BOOST_CHECK_EQUAL(item->payload()->value, i);
+  }
+
+  int nRecursive = 0;
+  for (Trie::parent_trie::recursive_iterator node(trie.getTrie()), end(0); node != end; ++node) {
+    nRecursive += node->payload() != nullptr;
+  }
+  BOOST_CHECK_EQUAL(nRecursive, nChildren);
+
+  for (int i = 0; i < nChildren - 1; ++i) {
+    trie.erase(Name("/p").appendSequenceNumber(i));
+  }
+  Trie::iterator last = trie.find_exact(Name("/p").appendSequenceNumber(nChildren - 1));
+  BOOST_REQUIRE(last != trie.end());
+  BOOST_CHECK_EQUAL(last->suffix().size(), 1);
+  BOOST_CHECK(last->parent() == &trie.getTrie());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,166 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-nlsr-fast-forward.hpp"
+
+#include "apps/ndn-nlsr-app.hpp"
+
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+
+NS_LOG_COMPONENT_DEFINE("ndn.NlsrFastForward");
+
+namespace ns3 {
+namespace ndn {
+
+NlsrFastForward::NlsrFastForward(const NodeContainer& nodes, Time quietPeriod,
+                                 Time checkInterval)
+  : m_nodes(nodes)
+  , m_quietPeriod(quietPeriod)
+  , m_checkInterval(checkInterval)
+  , m_nCalculations(0)
+  , m_isSuspended(false)
+  , m_nSuspensions(0)
+  , m_nSuppressedInterests(0)
+{
+}
+
+void
+NlsrFastForward::Start(Time nlsrStartTime)
+{
+  // the first check sees NLSR instances created by application start events due at the
+  // same time
+  m_quietSince = nlsrStartTime;
+  m_checkEvent = Simulator::Schedule(nlsrStartTime + m_checkInterval, &NlsrFastForward::Check,
+                                     this);
+}
+
+void
+NlsrFastForward::Wake()
+{
+  // the quiet period restarts even if not suspended, so that the event that follows is given a
+  // full quiet period to be detected
+  m_quietSince = Simulator::Now();
+  m_digest.clear();
+
+  if (!m_isSuspended) {
+    return;
+  }
+
+  NS_LOG_INFO("Waking NLSR after " << (Simulator::Now() - m_suspendedSince).ToDouble(Time::S)
+              << "s");
+  m_isSuspended = false;
+  m_suspendedTime = m_suspendedTime + (Simulator::Now() - m_suspendedSince);
+
+  // instances resume in their own node context, before the events scheduled after Wake()
+  for (NodeContainer::Iterator node = m_nodes.Begin(); node != m_nodes.End(); ++node) {
+    Ptr<NlsrApp> app = GetNlsrApp(*node);
+    if (app != 0) {
+      Simulator::ScheduleWithContext((*node)->GetId(), Seconds(0), &NlsrFastForward::ResumeNlsr,
+                                     this, app);
+    }
+  }
+
+  m_checkEvent = Simulator::Schedule(m_checkInterval, &NlsrFastForward::Check, this);
+}
+
+void
+NlsrFastForward::Check()
+{
+  bool isQuiescent = true;
+  std::string digest;
+  uint64_t nCalculations = 0;
+  bool isFirst = true;
+
+  for (NodeContainer::Iterator node = m_nodes.Begin(); node != m_nodes.End(); ++node) {
+    Ptr<NlsrApp> app = GetNlsrApp(*node);
+    if (app == 0) {
+      continue;
+    }
+
+    nlsr::Nlsr& nlsr = app->GetNlsr();
+    nCalculations += nlsr.getRoutingTable().getNCalculations();
+    if (!isQuiescent) {
+      continue;
+    }
+
+    std::string nodeDigest = nlsr.getSyncLogicHandler().getRootDigest();
+    if (!nlsr.isQuiescent() || (!isFirst && nodeDigest != digest)) {
+      isQuiescent = false;
+    }
+    digest = nodeDigest;
+    isFirst = false;
+  }
+
+  if (!isQuiescent || digest != m_digest || nCalculations != m_nCalculations) {
+    m_quietSince = Simulator::Now();
+  }
+  else if (Simulator::Now() - m_quietSince >= m_quietPeriod) {
+    Suspend();
+    return;
+  }
+  m_digest = digest;
+  m_nCalculations = nCalculations;
+
+  m_checkEvent = Simulator::Schedule(m_checkInterval, &NlsrFastForward::Check, this);
+}
+
+void
+NlsrFastForward::Suspend()
+{
+  NS_LOG_INFO("NLSR is quiescent since " << m_quietSince.ToDouble(Time::S) << "s, suspending");
+  m_isSuspended = true;
+  m_suspendedSince = Simulator::Now();
+  ++m_nSuspensions;
+
+  for (NodeContainer::Iterator node = m_nodes.Begin(); node != m_nodes.End(); ++node) {
+    Ptr<NlsrApp> app = GetNlsrApp(*node);
+    if (app != 0) {
+      Simulator::ScheduleWithContext((*node)->GetId(), Seconds(0), &NlsrFastForward::SuspendNlsr,
+                                     app);
+    }
+  }
+}
+
+void
+NlsrFastForward::SuspendNlsr(Ptr<NlsrApp> app)
+{
+  app->GetNlsr().suspend();
+}
+
+void
+NlsrFastForward::ResumeNlsr(Ptr<NlsrApp> app)
+{
+  m_nSuppressedInterests += app->GetNlsr().resume();
+}
+
+Ptr<NlsrApp>
+NlsrFastForward::GetNlsrApp(Ptr<Node> node)
+{
+  for (uint32_t i = 0; i < node->GetNApplications(); ++i) {
+    Ptr<NlsrApp> app = DynamicCast<NlsrApp>(node->GetApplication(i));
+    if (app != 0) {
+      return app;
+    }
+  }
+  return 0;
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,146 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_NLSR_FAST_FORWARD_HPP
+#define NDN_NLSR_FAST_FORWARD_HPP
+
+#include "ns3/event-id.h"
+#include "ns3/node-container.h"
+#include "ns3/nstime.h"
+
+#include <string>
+
+namespace ns3 {
+namespace ndn {
+
+class NlsrApp;
+
+/**
+ * @brief Skips the steady-state periods of NLSR simulations
+ *
+ * Between failures, NLSR only exchanges periodic HELLOs, sync Interests and LSA refreshes,
+ * none of which changes routing state.  Every check interval, NlsrFastForward checks whether
+ * all NLSR instances are quiescent (nlsr::Nlsr::isQuiescent) and have the same sync digest.
+ * Once that has held, with no routing table calculation, for the quiet period, all instances
+ * are suspended: they send no HELLO or sync Interest, and the lifetimes of their LSAs are
+ * frozen.  The simulator then jumps straight to the next event of the scenario.
+ *
+ * Events that may change the topology, such as link failures, must call Wake() first.  The
+ * instances then resume with their HELLO and sync Interests in the phase they would have had,
+ * so failures are detected as fast as without fast-forward.  Interests that were not sent are
+ * traced by NlsrTracer as suppressedHelloInterest and suppressedSyncInterest events.
+ *
+ * NLSR instances on other ranks of a distributed simulation are not seen, so fast-forward
+ * is only meant for sequential simulations.
+ */
+class NlsrFastForward {
+public:
+  /**
+   * @param nodes Nodes running NlsrApp
+   * @param quietPeriod Time without changes after which the network is deemed quiescent
+   * @param checkInterval Time between two checks for quiescence
+   */
+  NlsrFastForward(const NodeContainer& nodes, Time quietPeriod, Time checkInterval = Seconds(1));
+
+  /**
+   * @brief Start checking for quiescence once NLSR instances, started at @p nlsrStartTime,
+   *        are running
+   */
+  void
+  Start(Time nlsrStartTime);
+
+  /**
+   * @brief Resume all NLSR instances, if suspended, and restart the quiet period
+   *
+   * Must be called before any event that may change the topology.
+   */
+  void
+  Wake();
+
+  bool
+  IsSuspended() const
+  {
+    return m_isSuspended;
+  }
+
+  /**
+   * @brief Get number of times NLSR instances were suspended
+   */
+  uint32_t
+  GetNSuspensions() const
+  {
+    return m_nSuspensions;
+  }
+
+  /**
+   * @brief Get total time NLSR instances have been suspended, up to the last Wake()
+   */
+  Time
+  GetSuspendedTime() const
+  {
+    return m_suspendedTime;
+  }
+
+  /**
+   * @brief Get number of HELLO and sync Interests that were not sent, up to the last Wake()
+   */
+  uint64_t
+  GetNSuppressedInterests() const
+  {
+    return m_nSuppressedInterests;
+  }
+
+private:
+  void
+  Check();
+
+  void
+  Suspend();
+
+  static void
+  SuspendNlsr(Ptr<NlsrApp> app);
+
+  void
+  ResumeNlsr(Ptr<NlsrApp> app);
+
+  static Ptr<NlsrApp>
+  GetNlsrApp(Ptr<Node> node);
+
+private:
+  NodeContainer m_nodes;
+  Time m_quietPeriod;
+  Time m_checkInterval;
+  EventId m_checkEvent;
+
+  // state of the last check; any change restarts the quiet period
+  Time m_quietSince;
+  std::string m_digest;
+  uint64_t m_nCalculations;
+
+  bool m_isSuspended;
+  Time m_suspendedSince;
+  uint32_t m_nSuspensions;
+  Time m_suspendedTime;
+  uint64_t m_nSuppressedInterests;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_NLSR_FAST_FORWARD_HPP
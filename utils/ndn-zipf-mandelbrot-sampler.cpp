@@ -0,0 +1,106 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-zipf-mandelbrot-sampler.hpp"
+
+#include "ns3/log.h"
+
+#include <cmath>
+#include <map>
+#include <tuple>
+
+NS_LOG_COMPONENT_DEFINE("ndn.ZipfMandelbrotSampler");
+
+namespace ns3 {
+namespace ndn {
+
+shared_ptr<const ZipfMandelbrotSampler>
+ZipfMandelbrotSampler::Get(uint32_t nContents, double q, double s)
+{
+  typedef std::tuple<uint32_t, double, double> Parameters;
+  // samplers are only kept while used
+  static std::map<Parameters, std::weak_ptr<const ZipfMandelbrotSampler>> samplers;
+
+  // forget the samplers no longer used, so that scenarios sweeping over parameters do not
+  // accumulate entries
+  for (auto it = samplers.begin(); it != samplers.end();) {
+    if (it->second.expired()) {
+      it = samplers.erase(it);
+    }
+    else {
+      ++it;
+    }
+  }
+
+  std::weak_ptr<const ZipfMandelbrotSampler>& weak = samplers[Parameters(nContents, q, s)];
+  shared_ptr<const ZipfMandelbrotSampler> sampler = weak.lock();
+  if (sampler == nullptr) {
+    sampler = make_shared<ZipfMandelbrotSampler>(nContents, q, s);
+    weak = sampler;
+  }
+  return sampler;
+}
+
+ZipfMandelbrotSampler::ZipfMandelbrotSampler(uint32_t nContents, double q, double s)
+  : m_prob(std::max<uint32_t>(nContents, 1))
+  , m_alias(m_prob.size())
+{
+  NS_LOG_FUNCTION(this << nContents << q << s);
+
+  uint32_t n = m_prob.size();
+  double sum = 0;
+  for (uint32_t i = 0; i < n; i++) {
+    m_prob[i] = 1.0 / std::pow(i + 1 + q, s);
+    sum += m_prob[i];
+  }
+
+  // Vose's construction: columns over the average probability give their excess to the ones
+  // below it
+  std::vector<uint32_t> small;
+  std::vector<uint32_t> large;
+  for (uint32_t i = 0; i < n; i++) {
+    m_prob[i] *= n / sum;
+    m_alias[i] = i;
+    (m_prob[i] < 1.0 ? small : large).push_back(i);
+  }
+
+  while (!small.empty() && !large.empty()) {
+    uint32_t less = small.back();
+    small.pop_back();
+    uint32_t more = large.back();
+
+    m_alias[less] = more;
+    m_prob[more] -= 1.0 - m_prob[less];
+    if (m_prob[more] < 1.0) {
+      large.pop_back();
+      small.push_back(more);
+    }
+  }
+
+  // left-overs are only off by rounding errors
+  for (uint32_t i : small) {
+    m_prob[i] = 1.0;
+  }
+  for (uint32_t i : large) {
+    m_prob[i] = 1.0;
+  }
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,80 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_ZIPF_MANDELBROT_SAMPLER_HPP
+#define NDN_ZIPF_MANDELBROT_SAMPLER_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include <boost/noncopyable.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-apps
+ * @brief Constant-time sampler of content ranks following the Zipf-Mandelbrot distribution
+ *
+ * Rank k in [1, N] has probability proportional to 1 / (k + q)^s.  Samples are drawn with
+ * Walker's alias method, from tables built in O(N) once per set of parameters: Get() returns
+ * the sampler already built for the same parameters, if any, so that all consumers requesting
+ * the same catalog share it.
+ */
+class ZipfMandelbrotSampler : boost::noncopyable {
+public:
+  /**
+   * @brief Get the sampler for @p nContents contents with parameters @p q and @p s
+   */
+  static shared_ptr<const ZipfMandelbrotSampler>
+  Get(uint32_t nContents, double q, double s);
+
+  ZipfMandelbrotSampler(uint32_t nContents, double q, double s);
+
+  /**
+   * @brief Get the content rank, in [1, N], for a uniform random value @p u in [0, 1)
+   */
+  uint32_t
+  Sample(double u) const
+  {
+    double scaled = u * m_prob.size();
+    uint32_t column = std::min<uint32_t>(static_cast<uint32_t>(scaled), m_prob.size() - 1);
+    if (scaled - column < m_prob[column]) {
+      return column + 1;
+    }
+    return m_alias[column] + 1;
+  }
+
+  uint32_t
+  GetNumberOfContents() const
+  {
+    return m_prob.size();
+  }
+
+private:
+  std::vector<double> m_prob;    ///< probability to keep the rank of each column
+  std::vector<uint32_t> m_alias; ///< rank taken otherwise, as a column index
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_ZIPF_MANDELBROT_SAMPLER_HPP
@@ -0,0 +1,316 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "graph-partitioner.hpp"
+
+#include "ns3/assert.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <queue>
+#include <utility>
+
+namespace ns3 {
+namespace ndn {
+
+/// maximum number of Fiduccia-Mattheyses passes per bisection
+static const int MAX_REFINE_PASSES = 10;
+
+/// a pass stops after this many moves (or 2% of the vertices) without a better cut
+static const size_t MIN_FRUITLESS_MOVES = 64;
+
+GraphPartitioner::GraphPartitioner(uint32_t nVertices)
+  : m_adjacency(nVertices)
+  , m_degrees(nVertices, 0)
+  , m_imbalance(0.05)
+{
+}
+
+void
+GraphPartitioner::AddEdge(uint32_t u, uint32_t v, uint32_t weight)
+{
+  NS_ASSERT(u < m_adjacency.size() && v < m_adjacency.size());
+  if (u == v) {
+    return;
+  }
+
+  m_adjacency[u].push_back({v, weight});
+  m_adjacency[v].push_back({u, weight});
+  m_degrees[u] += weight;
+  m_degrees[v] += weight;
+}
+
+uint64_t
+GraphPartitioner::GetVertexWeight(uint32_t v) const
+{
+  return std::max<uint64_t>(m_degrees[v], 1);
+}
+
+void
+GraphPartitioner::SetImbalance(double imbalance)
+{
+  m_imbalance = imbalance;
+}
+
+std::vector<uint32_t>
+GraphPartitioner::Partition(uint32_t nParts) const
+{
+  std::vector<uint32_t> parts(m_adjacency.size(), 0);
+  if (nParts <= 1 || m_adjacency.empty()) {
+    return parts;
+  }
+
+  std::vector<uint32_t> vertices(m_adjacency.size());
+  for (uint32_t v = 0; v < vertices.size(); ++v) {
+    vertices[v] = v;
+  }
+  std::vector<int32_t> local(m_adjacency.size(), -1);
+
+  Split(vertices, 0, nParts, parts, local);
+  return parts;
+}
+
+uint64_t
+GraphPartitioner::GetEdgeCut(const std::vector<uint32_t>& parts) const
+{
+  uint64_t cut = 0;
+  for (uint32_t u = 0; u < m_adjacency.size(); ++u) {
+    for (const Edge& edge : m_adjacency[u]) {
+      if (u < edge.to && parts[u] != parts[edge.to]) {
+        cut += edge.weight;
+      }
+    }
+  }
+  return cut;
+}
+
+void
+GraphPartitioner::Split(std::vector<uint32_t>& vertices, uint32_t firstPart, uint32_t nParts,
+                        std::vector<uint32_t>& parts, std::vector<int32_t>& local) const
+{
+  if (nParts == 1 || vertices.size() <= 1) {
+    for (uint32_t v : vertices) {
+      parts[v] = firstPart;
+    }
+    return;
+  }
+
+  // parts of the first half get a proportional share of the weight
+  uint32_t nFirst = nParts / 2;
+  uint64_t totalWeight = 0;
+  for (uint32_t v : vertices) {
+    totalWeight += GetVertexWeight(v);
+  }
+  uint64_t target = totalWeight * nFirst / nParts;
+
+  for (size_t i = 0; i < vertices.size(); ++i) {
+    local[vertices[i]] = static_cast<int32_t>(i);
+  }
+  std::vector<uint8_t> side;
+  Bisect(vertices, local, target, side);
+  for (uint32_t v : vertices) {
+    local[v] = -1;
+  }
+
+  std::vector<uint32_t> first;
+  std::vector<uint32_t> second;
+  for (size_t i = 0; i < vertices.size(); ++i) {
+    (side[i] == 0 ? first : second).push_back(vertices[i]);
+  }
+  vertices.clear();
+  vertices.shrink_to_fit();
+
+  Split(first, firstPart, nFirst, parts, local);
+  Split(second, firstPart + nFirst, nParts - nFirst, parts, local);
+}
+
+void
+GraphPartitioner::Bisect(const std::vector<uint32_t>& vertices, const std::vector<int32_t>& local,
+                         uint64_t target, std::vector<uint8_t>& side) const
+{
+  uint64_t totalWeight = 0;
+  for (uint32_t v : vertices) {
+    totalWeight += GetVertexWeight(v);
+  }
+  uint64_t share = std::min(target, totalWeight - target);
+  uint64_t tolerance = std::max<uint64_t>(1, static_cast<uint64_t>(m_imbalance * share));
+
+  Grow(vertices, local, target, side);
+  for (int pass = 0; pass < MAX_REFINE_PASSES; ++pass) {
+    if (!Refine(vertices, local, target, tolerance, side)) {
+      break;
+    }
+  }
+}
+
+void
+GraphPartitioner::Grow(const std::vector<uint32_t>& vertices, const std::vector<int32_t>& local,
+                       uint64_t target, std::vector<uint8_t>& side) const
+{
+  side.assign(vertices.size(), 1);
+  if (target == 0) {
+    return;
+  }
+
+  // the last vertex reached by BFS is a peripheral vertex of the first component
+  std::vector<uint8_t> isSeen(vertices.size(), 0);
+  std::queue<uint32_t> bfs;
+  uint32_t start = 0;
+  bfs.push(0);
+  isSeen[0] = 1;
+  while (!bfs.empty()) {
+    start = bfs.front();
+    bfs.pop();
+    for (const Edge& edge : m_adjacency[vertices[start]]) {
+      int32_t j = local[edge.to];
+      if (j >= 0 && !isSeen[j]) {
+        isSeen[j] = 1;
+        bfs.push(j);
+      }
+    }
+  }
+
+  // grow side 0 by the vertex most connected to it
+  typedef std::pair<uint64_t, uint32_t> Candidate; // (connection to side 0, index)
+  std::priority_queue<Candidate> candidates;
+  std::vector<uint64_t> connection(vertices.size(), 0);
+  candidates.push(Candidate(0, start));
+
+  uint64_t weight = 0;
+  size_t nextSeed = 0;
+  while (weight < target) {
+    if (candidates.empty()) {
+      // side 0 covers the whole component; continue in another one
+      while (nextSeed < vertices.size() && side[nextSeed] == 0) {
+        ++nextSeed;
+      }
+      if (nextSeed == vertices.size()) {
+        break;
+      }
+      candidates.push(Candidate(0, nextSeed));
+    }
+
+    Candidate candidate = candidates.top();
+    candidates.pop();
+    uint32_t i = candidate.second;
+    if (side[i] == 0 || candidate.first != connection[i]) {
+      continue; // stale
+    }
+
+    uint64_t vertexWeight = GetVertexWeight(vertices[i]);
+    if (weight + vertexWeight > target && weight + vertexWeight - target > target - weight) {
+      break; // adding the vertex gets further away from the target
+    }
+
+    side[i] = 0;
+    weight += vertexWeight;
+    for (const Edge& edge : m_adjacency[vertices[i]]) {
+      int32_t j = local[edge.to];
+      if (j >= 0 && side[j] == 1) {
+        connection[j] += edge.weight;
+        candidates.push(Candidate(connection[j], j));
+      }
+    }
+  }
+}
+
+bool
+GraphPartitioner::Refine(const std::vector<uint32_t>& vertices, const std::vector<int32_t>& local,
+                         uint64_t target, uint64_t tolerance, std::vector<uint8_t>& side) const
+{
+  auto distance = [target] (int64_t weight) {
+    return static_cast<uint64_t>(std::abs(weight - static_cast<int64_t>(target)));
+  };
+
+  // gain of a vertex is the reduction of the cut when it moves to the other side
+  std::vector<int64_t> gain(vertices.size(), 0);
+  int64_t weight = 0;
+  for (size_t i = 0; i < vertices.size(); ++i) {
+    if (side[i] == 0) {
+      weight += GetVertexWeight(vertices[i]);
+    }
+    for (const Edge& edge : m_adjacency[vertices[i]]) {
+      int32_t j = local[edge.to];
+      if (j >= 0) {
+        gain[i] += side[j] != side[i] ? edge.weight : -static_cast<int64_t>(edge.weight);
+      }
+    }
+  }
+
+  typedef std::pair<int64_t, uint32_t> Candidate; // (gain, index)
+  std::priority_queue<Candidate> candidates;
+  for (size_t i = 0; i < vertices.size(); ++i) {
+    candidates.push(Candidate(gain[i], i));
+  }
+
+  std::vector<uint8_t> isLocked(vertices.size(), 0);
+  std::vector<uint32_t> moves;
+  int64_t totalGain = 0;
+  int64_t bestGain = 0;
+  size_t nBestMoves = 0;
+  uint64_t bestDistance = distance(weight);
+  size_t maxFruitlessMoves = std::max(MIN_FRUITLESS_MOVES, vertices.size() / 50);
+
+  while (!candidates.empty() && moves.size() - nBestMoves < maxFruitlessMoves) {
+    Candidate candidate = candidates.top();
+    candidates.pop();
+    uint32_t i = candidate.second;
+    if (isLocked[i] || candidate.first != gain[i]) {
+      continue; // stale
+    }
+
+    int64_t vertexWeight = GetVertexWeight(vertices[i]);
+    int64_t newWeight = side[i] == 0 ? weight - vertexWeight : weight + vertexWeight;
+    if (distance(newWeight) > tolerance && distance(newWeight) > distance(weight)) {
+      continue; // would break the balance; may come back with a higher gain
+    }
+
+    side[i] ^= 1;
+    isLocked[i] = 1;
+    weight = newWeight;
+    totalGain += gain[i];
+    moves.push_back(i);
+
+    for (const Edge& edge : m_adjacency[vertices[i]]) {
+      int32_t j = local[edge.to];
+      if (j < 0 || isLocked[j]) {
+        continue;
+      }
+      gain[j] += side[j] == side[i] ? -2 * static_cast<int64_t>(edge.weight)
+                                    : 2 * static_cast<int64_t>(edge.weight);
+      candidates.push(Candidate(gain[j], j));
+    }
+
+    if (totalGain > bestGain || (totalGain == bestGain && distance(weight) < bestDistance)) {
+      bestGain = totalGain;
+      nBestMoves = moves.size();
+      bestDistance = distance(weight);
+    }
+  }
+
+  // undo the moves after the best prefix
+  for (size_t m = nBestMoves; m < moves.size(); ++m) {
+    side[moves[m]] ^= 1;
+  }
+
+  return bestGain > 0;
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,120 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_GRAPH_PARTITIONER_HPP
+#define NDN_GRAPH_PARTITIONER_HPP
+
+#include <cstdint>
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @brief Min-edge-cut partitioner of an undirected topology graph
+ *
+ * Used to assign nodes to MPI ranks (ns-3 system ids).  Vertices are weighted by their
+ * degree, as the per-node cost of link-state routing (hellos, LSA fetching, sync) grows
+ * with the number of adjacencies.  The graph is split by recursive bisection: each
+ * bisection grows a region from a peripheral vertex (greedy graph growing) and is then
+ * refined with Fiduccia-Mattheyses passes, keeping the weight of every part within
+ * the imbalance tolerance of its share.
+ *
+ * The result only depends on the graph and the vertex order, so all ranks compute the same
+ * partition without communicating.
+ */
+class GraphPartitioner {
+public:
+  /**
+   * @param nVertices Number of vertices, identified by 0 .. nVertices - 1
+   */
+  explicit GraphPartitioner(uint32_t nVertices);
+
+  /**
+   * @brief Add an undirected edge; parallel edges add up their weights
+   */
+  void
+  AddEdge(uint32_t u, uint32_t v, uint32_t weight = 1);
+
+  /**
+   * @brief Get weight of a vertex (its weighted degree, at least 1)
+   */
+  uint64_t
+  GetVertexWeight(uint32_t v) const;
+
+  /**
+   * @brief Set allowed imbalance of the parts, as a fraction of their share (default 0.05)
+   */
+  void
+  SetImbalance(double imbalance);
+
+  /**
+   * @brief Split the graph into @p nParts parts
+   * @return part (0 .. nParts - 1) of each vertex
+   */
+  std::vector<uint32_t>
+  Partition(uint32_t nParts) const;
+
+  /**
+   * @brief Total weight of edges between different parts of @p parts
+   */
+  uint64_t
+  GetEdgeCut(const std::vector<uint32_t>& parts) const;
+
+private:
+  struct Edge {
+    uint32_t to;
+    uint32_t weight;
+  };
+
+  void
+  Split(std::vector<uint32_t>& vertices, uint32_t firstPart, uint32_t nParts,
+        std::vector<uint32_t>& parts, std::vector<int32_t>& local) const;
+
+  /**
+   * @brief Bisect @p vertices so that side 0 weighs about @p target
+   * @param local vertex => index in @p vertices, -1 for vertices outside
+   * @param[out] side 0 or 1 per entry of @p vertices
+   */
+  void
+  Bisect(const std::vector<uint32_t>& vertices, const std::vector<int32_t>& local,
+         uint64_t target, std::vector<uint8_t>& side) const;
+
+  void
+  Grow(const std::vector<uint32_t>& vertices, const std::vector<int32_t>& local,
+       uint64_t target, std::vector<uint8_t>& side) const;
+
+  /**
+   * @brief One Fiduccia-Mattheyses pass
+   * @return whether the cut was reduced
+   */
+  bool
+  Refine(const std::vector<uint32_t>& vertices, const std::vector<int32_t>& local,
+         uint64_t target, uint64_t tolerance, std::vector<uint8_t>& side) const;
+
+private:
+  std::vector<std::vector<Edge>> m_adjacency;
+  std::vector<uint64_t> m_degrees; ///< weighted degree of each vertex
+  double m_imbalance;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_GRAPH_PARTITIONER_HPP
@@ -55,6 +55,10 @@
 #include "ns3/double.h"
 #include "ns3/constant-position-mobility-model.h"
 
+#ifdef NS3_MPI
+#include <ns3/mpi-interface.h>
+#endif
+
 #include <boost/foreach.hpp>
 #include <boost/lexical_cast.hpp>
 #include <boost/tokenizer.hpp>
@@ -68,10 +72,12 @@
 #include "update/prefix-update-processor.hpp"
 
 #include "adjacent.hpp"
+#include "lsdb-snapshot.hpp"
 #include "apps/ndn-app.hpp"
 #include "apps/ndn-nlsr-app.hpp"
 
 #include "nlsr-conf-reader.hpp"
+#include "graph-partitioner.hpp"
 
 NS_LOG_COMPONENT_DEFINE("ndn.NlsrConfReader");
 
@@ -186,6 +192,7 @@ NlsrConfReader::NlsrConfReader (const std::string &path, double scale/*=1.0*/)
   , m_randY(CreateObject<UniformRandomVariable>())
   , m_scale (scale)
   , m_requiredPartitions (1)
+  , m_nPartitions (0)
 {
   m_path = m_confFileName;
 
@@ -226,7 +233,8 @@ NlsrConfReader::ProcessConfFile()
 bool
 NlsrConfReader::Load(istream& input)
 {
-  ConfigSection pt;
+  auto config = std::make_shared<ConfigSection>();
+  ConfigSection& pt = *config;
   bool ret = true;
   try {
     boost::property_tree::read_info(input, pt);
@@ -238,6 +246,9 @@ NlsrConfReader::Load(istream& input)
     return false;
   }
 
+  // kept by the node's NetworkNode, so that NLSR does not need to parse it again
+  m_parsedConfig = config;
+
   for (ConfigSection::const_iterator tn = pt.begin();
        tn != pt.end(); ++tn) {
     ret = ProcessSection(tn->first, tn->second);
@@ -280,6 +291,10 @@ NlsrConfReader::ProcessSection(const std::string& sectionName, const ConfigSecti
   {
     // Do nothing.
   }
+  else if (sectionName == "sim-crypto")
+  {
+    // Do nothing.
+  }
   else
   {
     std::cerr << "Wrong configuration section: " << sectionName << " " << m_confFileName << std::endl;
@@ -347,6 +362,7 @@ NlsrConfReader::ProcessNodeId(const ConfigSection& section)
   // Save the node configuration.
   m_srcNodeId = nodeId;
   NetworkNode node(m_confFileName, nodeId, city, latitude, longitude);
+  node.SetParsedConfig(m_parsedConfig);
   m_node_map[nodeId] = node;
 
   return true;
@@ -433,29 +449,127 @@ NlsrConfReader::PrintConfig()
 void
 NlsrConfReader::InitializeNlsr()
 {
-  // Copy over the NLSR config object from node to the application.
-  for (NodeContainer::Iterator it = m_nodes.Begin(); it != m_nodes.End(); ++it) {
-    NetworkNode node = m_node_map[Names::FindName (*it)];
+  // The node name Id mapping is shared by all NLSR instances.
+  auto nodeNameToId = std::make_shared<ndn::NlsrApp::NodeNameToIdMap>();
+  for (NODE_MAP::iterator nodeIt = m_node_map.begin(); nodeIt != m_node_map.end(); ++nodeIt) {
+    NetworkNode& srcNode = nodeIt->second;
+    (*nodeNameToId)[srcNode.GetNodeId()] = srcNode.GetNdnNodeId();
+  }
+  std::shared_ptr<const ndn::NlsrApp::NodeNameToIdMap> nodeMap = nodeNameToId;
+
+  // So is the LSDB snapshot to start from, if any.
+  std::shared_ptr<const nlsr::LsdbSnapshot> lsdbSnapshot;
+  if (!m_lsdbSnapshotFile.empty()) {
+    auto snapshot = std::make_shared<nlsr::LsdbSnapshot>();
+    snapshot->load(m_lsdbSnapshotFile);
+    lsdbSnapshot = snapshot;
+  }
+
+  // Hand over the parsed NLSR config from node to the application.
+  NodeContainer localNodes = GetLocalNodes();
+  for (NodeContainer::Iterator it = localNodes.Begin(); it != localNodes.End(); ++it) {
+    const NetworkNode& node = m_node_map[Names::FindName (*it)];
     std::string nodeConfig = node.GetConfigPath();
     NS_ASSERT (!nodeConfig.empty());
 
     Ptr<ndn::NlsrApp> nlsrApp = (*it)->GetApplication(0)->GetObject<ndn::NlsrApp> ();
     NS_ASSERT (nlsrApp != 0);
 
-    // Set the node name Id mapping in NLSR.
-    NODE_MAP::iterator nodeIt;
-    for (nodeIt = m_node_map.begin(); nodeIt != m_node_map.end(); ++nodeIt) {
-      std::string nodeId = nodeIt->first;
-      NetworkNode& srcNode = nodeIt->second;
-      nlsrApp->SetNodeNameToIdMapping(srcNode.GetNodeId(), srcNode.GetNdnNodeId());
-    }
-
+    nlsrApp->SetNodeNameToIdMap(nodeMap);
+    nlsrApp->SetLsdbSnapshot(lsdbSnapshot);
     nlsrApp->SetNodeName(node.GetNodeId());
-    nlsrApp->Initialize(nodeConfig);
+    nlsrApp->Initialize(nodeConfig, node.GetParsedConfig());
     nlsrApp->SetStartTime(Seconds (1.0));
   }
 }
 
+void
+NlsrConfReader::SetLsdbSnapshot (const std::string &file)
+{
+  m_lsdbSnapshotFile = file;
+}
+
+void
+NlsrConfReader::WriteLsdbSnapshot (const std::string &file)
+{
+  nlsr::LsdbSnapshot snapshot;
+  for (NODE_MAP::iterator nodeIt = m_node_map.begin (); nodeIt != m_node_map.end (); ++nodeIt)
+    {
+      NS_ASSERT (nodeIt->second.GetParsedConfig () != nullptr);
+      snapshot.addRouter (*nodeIt->second.GetParsedConfig ());
+    }
+  snapshot.save (file);
+  NS_LOG_INFO ("LSDB snapshot of " << m_node_map.size () << " nodes written to " << file);
+}
+
+void
+NlsrConfReader::SetPartitions (uint32_t nPartitions, Time minLookahead)
+{
+  m_nPartitions = nPartitions;
+  m_minLookahead = minLookahead;
+}
+
+NodeContainer
+NlsrConfReader::GetLocalNodes () const
+{
+#ifdef NS3_MPI
+  if (MpiInterface::IsEnabled ())
+    {
+      uint32_t systemId = MpiInterface::GetSystemId ();
+      NodeContainer localNodes;
+      for (NodeContainer::Iterator it = m_nodes.Begin (); it != m_nodes.End (); ++it)
+        {
+          if ((*it)->GetSystemId () == systemId)
+            localNodes.Add (*it);
+        }
+      return localNodes;
+    }
+#endif
+  return m_nodes;
+}
+
+std::vector<uint32_t>
+NlsrConfReader::PartitionNodes ()
+{
+  if (m_nPartitions <= 1)
+    return std::vector<uint32_t> (m_node_map.size (), 0);
+
+  std::map<std::string, uint32_t> index;
+  for (NODE_MAP::iterator nodeIt = m_node_map.begin (); nodeIt != m_node_map.end (); ++nodeIt)
+    {
+      uint32_t i = static_cast<uint32_t> (index.size ());
+      index[nodeIt->first] = i;
+    }
+
+  // neighbors are listed by both ends of a link
+  GraphPartitioner graph (static_cast<uint32_t> (index.size ()));
+  set<pair<uint32_t, uint32_t> > edges;
+  for (ADJACENCY_MAP::iterator adjIt = m_adj_map.begin (); adjIt != m_adj_map.end (); ++adjIt)
+    {
+      std::map<std::string, uint32_t>::iterator src = index.find (adjIt->first);
+      if (src == index.end ())
+        continue;
+
+      for (ADJACENCY_LIST::iterator linkIt = adjIt->second.begin (); linkIt != adjIt->second.end (); ++linkIt)
+        {
+          std::map<std::string, uint32_t>::iterator dst = index.find (linkIt->GetNodeId ());
+          if (dst == index.end ())
+            continue;
+
+          pair<uint32_t, uint32_t> edge (std::min (src->second, dst->second),
+                                         std::max (src->second, dst->second));
+          if (edges.insert (edge).second)
+            graph.AddEdge (edge.first, edge.second);
+        }
+    }
+
+  std::vector<uint32_t> parts = graph.Partition (m_nPartitions);
+  NS_LOG_INFO ("Partitioned " << parts.size () << " nodes into " << m_nPartitions
+               << " systems, " << graph.GetEdgeCut (parts) << " of " << edges.size ()
+               << " links between systems");
+  return parts;
+}
+
 Ptr<Node>
 NlsrConfReader::CreateNode (const std::string name, uint32_t systemId)
 {
@@ -1005,8 +1119,11 @@ NodeContainer
 NlsrConfReader::BuildTopology()
 {
   // Create nodes.
+  std::vector<uint32_t> systemIds = PartitionNodes();
+  m_requiredPartitions = std::max(m_requiredPartitions, m_nPartitions);
   try {
     NODE_MAP::iterator nodeIt;
+    size_t nodeIndex = 0;
 
     for (nodeIt = m_node_map.begin(); nodeIt != m_node_map.end(); ++nodeIt) {
       std::string nodeId = nodeIt->first;
@@ -1015,7 +1132,7 @@ NlsrConfReader::BuildTopology()
       // Create a Node
       double longitude = srcNode.GetLongitude();
       double latitude = srcNode.GetLatitude();
-      uint32_t systemId = 0;
+      uint32_t systemId = systemIds[nodeIndex++];
       Ptr<Node> node;
 
       if (abs(longitude) > 0.001 && abs(latitude) > 0.001) {
@@ -1074,6 +1191,16 @@ NlsrConfReader::BuildTopology()
 
         //if (!dstLink.GetDelay().empty())
         //  link.SetAttribute ("Delay", dstLink.GetDelay());
+        if (m_nPartitions > 0) {
+          // links between systems are the lookahead of the distributed simulator
+          Time delay = dstLink.GetDelay().empty() ? Time() : Time(dstLink.GetDelay());
+          if (fromNode->GetSystemId() != toNode->GetSystemId() && delay < m_minLookahead) {
+            NS_LOG_WARN ("Delay of link " << srcNode.GetNodeId() << " <==> " << dstLink.GetNodeId()
+                         << " between systems raised to " << m_minLookahead.GetMilliSeconds() << "ms");
+            delay = m_minLookahead;
+          }
+          link.SetAttribute ("Delay", std::to_string(delay.GetNanoSeconds()) + "ns");
+        }
         //if (!dstLink.GetQueue().empty ())
         //  link.SetAttribute ("MaxPackets", dstLink.GetQueue());
 
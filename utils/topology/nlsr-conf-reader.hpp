@@ -30,9 +30,12 @@
 #include <map>
 #include <stdint.h>
 #include <sstream>
+#include <memory>
+#include <vector>
 
 #include "ns3/topology-reader.h"
 #include "ns3/node-container.h"
+#include "ns3/nstime.h"
 #include "ns3/random-variable-stream.h"
 #include "ns3/object-factory.h"
 #include "ns3/ptr.h"
@@ -111,6 +114,21 @@ public:
       return m_ndnNodeId;
     }
 
+    /**
+     * @brief Set the NLSR configuration parsed from GetConfigPath ()
+     */
+    void
+    SetParsedConfig (std::shared_ptr<const boost::property_tree::ptree> config)
+    {
+      m_parsedConfig = config;
+    }
+
+    std::shared_ptr<const boost::property_tree::ptree>
+    GetParsedConfig () const
+    {
+      return m_parsedConfig;
+    }
+
     void
     PrintNode()
     {
@@ -126,6 +144,7 @@ public:
     double m_latitude;
     double m_longitude;
     uint32_t m_ndnNodeId;
+    std::shared_ptr<const boost::property_tree::ptree> m_parsedConfig;
   };
 
   // Network link
@@ -232,9 +251,49 @@ public:
   void
   PrintConfig();
 
+  /**
+   * @brief Initialize NLSR applications of the nodes simulated by this MPI rank
+   */
   void
   InitializeNlsr();
 
+  /**
+   * @brief Split the topology over @p nPartitions ns-3 system ids (MPI ranks)
+   *
+   * Must be called before Read ().  Nodes are assigned by GraphPartitioner, which minimizes
+   * the number of links between ranks while balancing the node degrees per rank.  Links of
+   * a partitioned topology use the delays from the configuration files, so that links
+   * between ranks provide the lookahead of the distributed simulator; links between ranks
+   * are never shorter than @p minLookahead.
+   */
+  void
+  SetPartitions (uint32_t nPartitions, Time minLookahead = MilliSeconds (1));
+
+  /**
+   * @brief Start NLSR from the converged LSDB in @p file (see nlsr::LsdbSnapshot)
+   *
+   * Must be called before InitializeNlsr ().  The snapshot is loaded once and shared by all
+   * NLSR instances, which then start in steady state: without the HELLO, adjacency LSA
+   * build, sync and LSA fetching rounds of a cold start.
+   */
+  void
+  SetLsdbSnapshot (const std::string &file);
+
+  /**
+   * @brief Write the LSDB that the topology converges to into @p file
+   *
+   * Must be called after Read ().  The LSDB is derived from the NLSR configuration of all
+   * nodes, assuming all links are up, so no simulation needs to run.
+   */
+  void
+  WriteLsdbSnapshot (const std::string &file);
+
+  /**
+   * @brief Get nodes simulated by this MPI rank (all nodes when MPI is not enabled)
+   */
+  NodeContainer
+  GetLocalNodes () const;
+
   virtual NodeContainer
   Read ();
 
@@ -278,6 +337,12 @@ protected:
 
   void SetLinkMTUSize();
 
+  /**
+   * @brief Get system id of each node in m_node_map order
+   */
+  std::vector<uint32_t>
+  PartitionNodes ();
+
 protected:
   std::string m_path;
   NodeContainer m_nodes;
@@ -305,6 +370,7 @@ private:
 
 private:
   std::string m_confFileName;
+  std::shared_ptr<const ConfigSection> m_parsedConfig; ///< configuration file being processed
   std::string m_srcNodeId;
   NODE_MAP m_node_map;
   ADJACENCY_MAP m_adj_map;
@@ -318,6 +384,9 @@ private:
   ObjectFactory m_mobilityFactory;
   double m_scale;
   uint32_t m_requiredPartitions;
+  uint32_t m_nPartitions; ///< 0 if the topology is not partitioned
+  Time m_minLookahead;
+  std::string m_lsdbSnapshotFile;
 };
 
 } // namespace ndn
@@ -25,7 +25,7 @@
 #include "ns3/callback.h"
 
 #include "apps/ndn-app.hpp"
-#include "model/cs/ndn-content-store.hpp"
+#include "model/ndn-l3-protocol.hpp"
 #include "ns3/simulator.h"
 #include "ns3/node-list.h"
 #include "ns3/log.h"
@@ -200,9 +200,9 @@ CsTracer::~CsTracer(){};
 void
 CsTracer::Connect()
 {
-  Ptr<ContentStore> cs = m_nodePtr->GetObject<ContentStore>();
-  cs->TraceConnectWithoutContext("CacheHits", MakeCallback(&CsTracer::CacheHits, this));
-  cs->TraceConnectWithoutContext("CacheMisses", MakeCallback(&CsTracer::CacheMisses, this));
+  Ptr<L3Protocol> l3 = m_nodePtr->GetObject<L3Protocol>();
+  l3->TraceConnectWithoutContext("CacheHits", MakeCallback(&CsTracer::CacheHits, this));
+  l3->TraceConnectWithoutContext("CacheMisses", MakeCallback(&CsTracer::CacheMisses, this));
 
   Reset();
 }
@@ -259,13 +259,13 @@ CsTracer::Print(std::ostream& os) const
 }
 
 void
-CsTracer::CacheHits(shared_ptr<const Interest>, shared_ptr<const Data>)
+CsTracer::CacheHits(const Interest&, const Data&)
 {
   m_stats.m_cacheHits++;
 }
 
 void
-CsTracer::CacheMisses(shared_ptr<const Interest>)
+CsTracer::CacheMisses(const Interest&)
 {
   m_stats.m_cacheMisses++;
 }
@@ -58,6 +58,9 @@ struct Stats {
 /**
  * @ingroup ndn-tracers
  * @brief NDN tracer for cache performance (hits and misses)
+ *
+ * Works with both NFD's content store and the one enabled with StackHelper::SetOldContentStore,
+ * as lookups of either are traced by L3Protocol.
  */
 class CsTracer : public SimpleRefCount<CsTracer> {
 public:
@@ -173,10 +176,10 @@ private:
   Connect();
 
   void
-  CacheHits(shared_ptr<const Interest>, shared_ptr<const Data>);
+  CacheHits(const Interest&, const Data&);
 
   void
-  CacheMisses(shared_ptr<const Interest>);
+  CacheMisses(const Interest&);
 
 private:
   void
@@ -0,0 +1,100 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-delay-histogram.hpp"
+
+#include <cmath>
+
+namespace ns3 {
+namespace ndn {
+
+const unsigned DelayHistogram::PRECISION_BITS;
+
+DelayHistogram::DelayHistogram()
+{
+  Reset();
+}
+
+void
+DelayHistogram::Reset()
+{
+  std::fill(m_buckets.begin(), m_buckets.end(), 0);
+  m_count = 0;
+  m_sum = 0;
+  m_min = std::numeric_limits<uint64_t>::max();
+  m_max = 0;
+}
+
+Time
+DelayHistogram::GetMin() const
+{
+  return NanoSeconds(m_count > 0 ? m_min : 0);
+}
+
+Time
+DelayHistogram::GetMax() const
+{
+  return NanoSeconds(m_max);
+}
+
+Time
+DelayHistogram::GetMean() const
+{
+  return NanoSeconds(m_count > 0 ? static_cast<uint64_t>(m_sum / m_count) : 0);
+}
+
+Time
+DelayHistogram::GetQuantile(double q) const
+{
+  if (m_count == 0) {
+    return Seconds(0);
+  }
+
+  // rank of the quantile among the sorted delays, starting from 1
+  uint64_t rank = static_cast<uint64_t>(std::ceil(std::min(std::max(q, 0.0), 1.0) * m_count));
+  rank = std::max<uint64_t>(rank, 1);
+  if (rank == m_count) {
+    return GetMax();
+  }
+
+  uint64_t nBelow = 0;
+  for (size_t index = 0; index < m_buckets.size(); ++index) {
+    nBelow += m_buckets[index];
+    if (nBelow >= rank) {
+      // middle of the bucket, but never outside of the recorded delays
+      uint64_t lowest = GetLowest(index);
+      uint64_t middle = lowest + (GetLowest(index + 1) - lowest) / 2;
+      return NanoSeconds(std::min(std::max(middle, m_min), m_max));
+    }
+  }
+  return NanoSeconds(m_max);
+}
+
+uint64_t
+DelayHistogram::GetLowest(size_t index)
+{
+  if (index < (2u << PRECISION_BITS)) {
+    return index;
+  }
+  unsigned shift = (index >> PRECISION_BITS) - 1;
+  return static_cast<uint64_t>(index - (static_cast<size_t>(shift) << PRECISION_BITS)) << shift;
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,123 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_DELAY_HISTOGRAM_H
+#define NDN_DELAY_HISTOGRAM_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ns3/nstime.h"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-tracers
+ * @brief Streaming histogram of delays, to get their quantiles without keeping every sample
+ *
+ * Delays are counted in log-linear buckets, as in HDR histograms: delays below
+ * 2^(PRECISION_BITS + 1) nanoseconds have their own bucket, and longer delays share buckets
+ * whose width is 2^-PRECISION_BITS of their magnitude.  Recording is constant-time, memory only
+ * grows with the logarithm of the longest delay, and quantiles are within 0.4% of the recorded
+ * delays.
+ */
+class DelayHistogram {
+public:
+  static const unsigned PRECISION_BITS = 7;
+
+  DelayHistogram();
+
+  void
+  Record(const Time& delay)
+  {
+    uint64_t value = static_cast<uint64_t>(std::max<int64_t>(delay.GetNanoSeconds(), 0));
+
+    size_t index = GetIndex(value);
+    if (index >= m_buckets.size()) {
+      m_buckets.resize(index + 1, 0);
+    }
+    ++m_buckets[index];
+
+    ++m_count;
+    m_sum += value;
+    m_min = std::min(m_min, value);
+    m_max = std::max(m_max, value);
+  }
+
+  /**
+   * @brief Forget all recorded delays
+   */
+  void
+  Reset();
+
+  uint64_t
+  GetCount() const
+  {
+    return m_count;
+  }
+
+  Time
+  GetMin() const;
+
+  Time
+  GetMax() const;
+
+  Time
+  GetMean() const;
+
+  /**
+   * @brief Get the delay below which a fraction @p q of the recorded delays fall
+   * @param q fraction in [0, 1]
+   */
+  Time
+  GetQuantile(double q) const;
+
+private:
+  static size_t
+  GetIndex(uint64_t value)
+  {
+    if (value < (2u << PRECISION_BITS)) {
+      return value;
+    }
+    unsigned shift = 63 - __builtin_clzll(value) - PRECISION_BITS;
+    return (static_cast<size_t>(shift) << PRECISION_BITS) + (value >> shift);
+  }
+
+  /**
+   * @brief Get the smallest value counted in bucket @p index
+   */
+  static uint64_t
+  GetLowest(size_t index);
+
+private:
+  std::vector<uint64_t> m_buckets;
+  uint64_t m_count;
+  double m_sum;
+  uint64_t m_min;
+  uint64_t m_max;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_DELAY_HISTOGRAM_H
@@ -0,0 +1,419 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-l3-rate-binary-tracer.hpp"
+#include "ns3/node.h"
+#include "ns3/names.h"
+#include "ns3/simulator.h"
+#include "ns3/log.h"
+
+#include "daemon/table/pit-entry.hpp"
+
+#include <algorithm>
+#include <fstream>
+
+NS_LOG_COMPONENT_DEFINE("ndn.L3RateBinaryTracer");
+
+namespace ns3 {
+namespace ndn {
+
+const size_t L3RateBinaryTracer::N_BYTE_COUNTERS;
+const uint32_t L3RateBinaryTracer::NODE_TOTALS;
+
+static const char MAGIC[8] = {'N', 'D', 'N', 'L', '3', 'R', 'B', '1'};
+static const size_t OUTPUT_BUFFER_SIZE = 1 << 20;
+
+template<typename T>
+static void
+WriteValue(std::ostream& os, const T& value)
+{
+  os.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template<typename T>
+static void
+WriteColumn(std::ostream& os, const std::vector<T>& column)
+{
+  os.write(reinterpret_cast<const char*>(column.data()), column.size() * sizeof(T));
+}
+
+static void
+WriteString(std::ostream& os, const std::string& str)
+{
+  uint16_t length = static_cast<uint16_t>(std::min<size_t>(str.size(), 0xFFFF));
+  WriteValue(os, length);
+  os.write(str.data(), length);
+}
+
+/**
+ * @brief Binary trace file shared by a group of L3RateBinaryTracer instances
+ */
+class L3RateBinaryOutput : boost::noncopyable
+{
+public:
+  L3RateBinaryOutput(const std::string& file, const Time& period)
+    : m_buffer(OUTPUT_BUFFER_SIZE)
+    , m_period(period)
+    , m_lastFlush(Simulator::Now())
+  {
+    m_os.rdbuf()->pubsetbuf(m_buffer.data(), m_buffer.size());
+    m_os.open(file.c_str(), std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+    if (!m_os.is_open()) {
+      return;
+    }
+
+    m_os.write(MAGIC, sizeof(MAGIC));
+    WriteValue(m_os, static_cast<int64_t>(m_period.GetNanoSeconds()));
+
+    m_flushEvent = Simulator::Schedule(m_period, &L3RateBinaryOutput::PeriodicFlush, this);
+    // the last partial period is written when the simulation is destroyed
+    m_destroyEvent = Simulator::ScheduleDestroy(&L3RateBinaryOutput::Flush, this);
+  }
+
+  ~L3RateBinaryOutput()
+  {
+    m_flushEvent.Cancel();
+    m_destroyEvent.Cancel();
+  }
+
+  bool
+  IsOpen() const
+  {
+    return m_os.is_open();
+  }
+
+  const Time&
+  GetPeriod() const
+  {
+    return m_period;
+  }
+
+  void
+  Add(Ptr<Node> node)
+  {
+    Ptr<L3RateBinaryTracer> tracer = Create<L3RateBinaryTracer>(*this, node);
+
+    std::string name = Names::FindName(node);
+    if (name.empty()) {
+      name = std::to_string(node->GetId());
+    }
+
+    m_os.put('N');
+    WriteValue(m_os, static_cast<uint32_t>(node->GetId()));
+    WriteString(m_os, name);
+    m_tracers.push_back(tracer);
+  }
+
+  /**
+   * @brief Write the period ending now, unless it is empty, and flush the file
+   */
+  void
+  Flush()
+  {
+    if (Simulator::Now() > m_lastFlush) {
+      WritePeriod();
+    }
+    m_os.flush();
+  }
+
+private:
+  void
+  WritePeriod()
+  {
+    m_os.put('T');
+    WriteValue(m_os, static_cast<int64_t>(Simulator::Now().GetNanoSeconds()));
+
+    for (const auto& tracer : m_tracers) {
+      tracer->Flush(m_os);
+    }
+    m_lastFlush = Simulator::Now();
+  }
+
+  void
+  PeriodicFlush()
+  {
+    WritePeriod();
+
+    m_flushEvent = Simulator::Schedule(m_period, &L3RateBinaryOutput::PeriodicFlush, this);
+  }
+
+private:
+  std::vector<char> m_buffer;
+  std::ofstream m_os;
+  Time m_period;
+  Time m_lastFlush;
+  EventId m_flushEvent;
+  EventId m_destroyEvent;
+  std::list<Ptr<L3RateBinaryTracer>> m_tracers;
+};
+
+static std::list<shared_ptr<L3RateBinaryOutput>> g_outputs;
+
+void
+L3RateBinaryTracer::Destroy()
+{
+  for (const auto& output : g_outputs) {
+    output->Flush();
+  }
+  g_outputs.clear();
+}
+
+void
+L3RateBinaryTracer::InstallAll(const std::string& file, Time averagingPeriod /* = Seconds (0.5)*/)
+{
+  Install(NodeContainer::GetGlobal(), file, averagingPeriod);
+}
+
+void
+L3RateBinaryTracer::Install(const NodeContainer& nodes, const std::string& file,
+                            Time averagingPeriod /* = Seconds (0.5)*/)
+{
+  auto output = make_shared<L3RateBinaryOutput>(file, averagingPeriod);
+  if (!output->IsOpen()) {
+    NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
+    return;
+  }
+
+  for (NodeContainer::Iterator node = nodes.Begin(); node != nodes.End(); node++) {
+    NS_LOG_DEBUG("Node: " << (*node)->GetId());
+    output->Add(*node);
+  }
+
+  g_outputs.push_back(output);
+}
+
+L3RateBinaryTracer::L3RateBinaryTracer(L3RateBinaryOutput& output, Ptr<Node> node)
+  : L3Tracer(node)
+  , m_output(output)
+  , m_faceIds({NODE_TOTALS})
+  , m_faceUris({"all"})
+  , m_nReportedFaces(1)
+  , m_isActive(1, false)
+{
+  for (auto& column : m_packets) {
+    column.resize(1, 0);
+  }
+  for (auto& column : m_bytes) {
+    column.resize(1, 0);
+  }
+}
+
+L3RateBinaryTracer::~L3RateBinaryTracer()
+{
+}
+
+size_t
+L3RateBinaryTracer::GetIndex(const Face& face)
+{
+  nfd::FaceId faceId = face.getId();
+  if (faceId >= m_indexByFaceId.size()) {
+    m_indexByFaceId.resize(faceId + 1, 0);
+  }
+
+  uint32_t& index = m_indexByFaceId[faceId];
+  if (index == 0) {
+    index = static_cast<uint32_t>(m_faceIds.size());
+    m_faceIds.push_back(static_cast<uint32_t>(faceId));
+    m_faceUris.push_back(face.getLocalUri().toString());
+    for (auto& column : m_packets) {
+      column.push_back(0);
+    }
+    for (auto& column : m_bytes) {
+      column.push_back(0);
+    }
+    m_isActive.push_back(false);
+  }
+  return index;
+}
+
+void
+L3RateBinaryTracer::Count(size_t index, Counter counter, size_t nBytes)
+{
+  if (!m_isActive[index]) {
+    m_isActive[index] = true;
+    m_active.push_back(static_cast<uint32_t>(index));
+  }
+
+  ++m_packets[counter][index];
+  if (counter < N_BYTE_COUNTERS) {
+    m_bytes[counter][index] += nBytes;
+  }
+}
+
+void
+L3RateBinaryTracer::Flush(std::ostream& os)
+{
+  uint32_t nodeId = m_nodePtr->GetId();
+
+  for (; m_nReportedFaces < m_faceIds.size(); ++m_nReportedFaces) {
+    os.put('F');
+    WriteValue(os, nodeId);
+    WriteValue(os, m_faceIds[m_nReportedFaces]);
+    WriteString(os, m_faceUris[m_nReportedFaces]);
+  }
+
+  if (m_active.empty()) {
+    return;
+  }
+  std::sort(m_active.begin(), m_active.end());
+
+  os.put('S');
+  WriteValue(os, nodeId);
+  WriteValue(os, static_cast<uint32_t>(m_active.size()));
+
+  std::vector<uint32_t> column32(m_active.size());
+  std::vector<uint64_t> column64(m_active.size());
+
+  for (size_t row = 0; row < m_active.size(); ++row) {
+    column32[row] = m_faceIds[m_active[row]];
+  }
+  WriteColumn(os, column32);
+
+  for (auto& counter : m_packets) {
+    for (size_t row = 0; row < m_active.size(); ++row) {
+      column32[row] = counter[m_active[row]];
+      counter[m_active[row]] = 0;
+    }
+    WriteColumn(os, column32);
+  }
+
+  for (auto& counter : m_bytes) {
+    for (size_t row = 0; row < m_active.size(); ++row) {
+      column64[row] = counter[m_active[row]];
+      counter[m_active[row]] = 0;
+    }
+    WriteColumn(os, column64);
+  }
+
+  for (uint32_t index : m_active) {
+    m_isActive[index] = false;
+  }
+  m_active.clear();
+}
+
+void
+L3RateBinaryTracer::PrintHeader(std::ostream& os) const
+{
+  os << "Time"
+     << "\t"
+
+     << "Node"
+     << "\t"
+     << "FaceId"
+     << "\t"
+     << "FaceDescr"
+     << "\t"
+
+     << "Type"
+     << "\t"
+     << "Packets"
+     << "\t"
+     << "Kilobytes"
+     << "\t"
+     << "PacketRaw"
+     << "\t"
+     << "KilobytesRaw";
+}
+
+void
+L3RateBinaryTracer::Print(std::ostream& os) const
+{
+  static const char* NAMES[N_COUNTERS] = {"InInterests", "OutInterests", "InData", "OutData",
+                                          "InSatisfiedInterests", "InTimedOutInterests",
+                                          "OutSatisfiedInterests", "OutTimedOutInterests"};
+
+  double time = Simulator::Now().ToDouble(Time::S);
+  double period = m_output.GetPeriod().ToDouble(Time::S);
+
+  auto printRow = [&] (size_t index, size_t counter, const char* name) {
+    double kilobytes = counter < N_BYTE_COUNTERS ? m_bytes[counter][index] / 1024.0 : 0;
+    os << time << "\t" << m_node << "\t";
+    if (index == 0) {
+      os << "-1\tall\t";
+    }
+    else {
+      os << m_faceIds[index] << "\t" << m_faceUris[index] << "\t";
+    }
+    os << name << "\t" << m_packets[counter][index] / period << "\t" << kilobytes / period
+       << "\t" << m_packets[counter][index] << "\t" << kilobytes << "\n";
+  };
+
+  for (size_t index = 1; index < m_faceIds.size(); ++index) {
+    for (size_t counter = 0; counter < N_COUNTERS; ++counter) {
+      printRow(index, counter, NAMES[counter]);
+    }
+  }
+  printRow(0, SATISFIED_INTERESTS, "SatisfiedInterests");
+  printRow(0, TIMED_OUT_INTERESTS, "TimedOutInterests");
+}
+
+void
+L3RateBinaryTracer::OutInterests(const Interest& interest, const Face& face)
+{
+  Count(GetIndex(face), OUT_INTERESTS, interest.hasWire() ? interest.wireEncode().size() : 0);
+}
+
+void
+L3RateBinaryTracer::InInterests(const Interest& interest, const Face& face)
+{
+  Count(GetIndex(face), IN_INTERESTS, interest.hasWire() ? interest.wireEncode().size() : 0);
+}
+
+void
+L3RateBinaryTracer::OutData(const Data& data, const Face& face)
+{
+  Count(GetIndex(face), OUT_DATA, data.hasWire() ? data.wireEncode().size() : 0);
+}
+
+void
+L3RateBinaryTracer::InData(const Data& data, const Face& face)
+{
+  Count(GetIndex(face), IN_DATA, data.hasWire() ? data.wireEncode().size() : 0);
+}
+
+void
+L3RateBinaryTracer::SatisfiedInterests(const nfd::pit::Entry& entry, const Face&, const Data&)
+{
+  Count(0, SATISFIED_INTERESTS, 0);
+
+  for (const auto& in : entry.getInRecords()) {
+    Count(GetIndex(*in.getFace()), SATISFIED_INTERESTS, 0);
+  }
+
+  for (const auto& out : entry.getOutRecords()) {
+    Count(GetIndex(*out.getFace()), OUT_SATISFIED_INTERESTS, 0);
+  }
+}
+
+void
+L3RateBinaryTracer::TimedOutInterests(const nfd::pit::Entry& entry)
+{
+  Count(0, TIMED_OUT_INTERESTS, 0);
+
+  for (const auto& in : entry.getInRecords()) {
+    Count(GetIndex(*in.getFace()), TIMED_OUT_INTERESTS, 0);
+  }
+
+  for (const auto& out : entry.getOutRecords()) {
+    Count(GetIndex(*out.getFace()), OUT_TIMED_OUT_INTERESTS, 0);
+  }
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,186 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_L3_RATE_BINARY_TRACER_H
+#define NDN_L3_RATE_BINARY_TRACER_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ndn-l3-tracer.hpp"
+
+#include "ns3/nstime.h"
+#include "ns3/node-container.h"
+
+#include <array>
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+
+class L3RateBinaryOutput;
+
+/**
+ * @ingroup ndn-tracers
+ * @brief NDN network-layer rate tracer with binary output
+ *
+ * Collects the same counters as L3RateTracer, but keeps them in flat arrays indexed by FaceId
+ * and writes raw per-period counters of active faces as binary column blocks.  All tracers
+ * sharing an output file are flushed by a single periodic event.
+ *
+ * The file can be converted to the L3RateTracer layout (including EWMA rates) with
+ * `examples/graphs/l3-rate-binary-to-csv.py`.
+ *
+ * File format (native byte order):
+ *
+ *     header:   char[8] "NDNL3RB1", int64 period (ns)
+ *     'N':      uint32 node, uint16 length, char[length] node name
+ *     'T':      int64 time (ns), starts a period; followed by per-node 'F' and 'S' records
+ *     'F':      uint32 node, uint32 face, uint16 length, char[length] face local URI
+ *     'S':      uint32 node, uint32 nRows,
+ *               uint32 face[nRows],
+ *               uint32 packets[N_COUNTERS][nRows], uint64 bytes[N_BYTE_COUNTERS][nRows]
+ *
+ * Face 0xFFFFFFFF denotes the node-wide totals.
+ */
+class L3RateBinaryTracer : public L3Tracer {
+public:
+  /**
+   * @brief Helper method to install tracers on all simulation nodes
+   *
+   * @param file File to which traces will be written
+   * @param averagingPeriod How often data will be written into the trace file
+   */
+  static void
+  InstallAll(const std::string& file, Time averagingPeriod = Seconds(0.5));
+
+  /**
+   * @brief Helper method to install tracers on the selected simulation nodes
+   *
+   * @param nodes Nodes on which to install tracer
+   * @param file File to which traces will be written
+   * @param averagingPeriod How often data will be written into the trace file
+   */
+  static void
+  Install(const NodeContainer& nodes, const std::string& file,
+          Time averagingPeriod = Seconds(0.5));
+
+  /**
+   * @brief Explicit request to write the last partial period, remove all statically created
+   *        tracers and close their files
+   */
+  static void
+  Destroy();
+
+  /**
+   * @brief Counters in the order of 'S' record columns
+   */
+  enum Counter {
+    IN_INTERESTS,
+    OUT_INTERESTS,
+    IN_DATA,
+    OUT_DATA,
+    SATISFIED_INTERESTS,
+    TIMED_OUT_INTERESTS,
+    OUT_SATISFIED_INTERESTS,
+    OUT_TIMED_OUT_INTERESTS,
+    N_COUNTERS
+  };
+
+  /**
+   * @brief Only the first N_BYTE_COUNTERS counters have byte counts
+   */
+  static const size_t N_BYTE_COUNTERS = OUT_DATA + 1;
+
+  static const uint32_t NODE_TOTALS = 0xFFFFFFFF;
+
+  L3RateBinaryTracer(L3RateBinaryOutput& output, Ptr<Node> node);
+
+  virtual
+  ~L3RateBinaryTracer();
+
+  // from L3Tracer
+  virtual void
+  PrintHeader(std::ostream& os) const;
+
+  /**
+   * @brief Print raw counters of the current period in L3RateTracer layout (rates are not
+   *        smoothed)
+   */
+  virtual void
+  Print(std::ostream& os) const;
+
+  /**
+   * @brief Write 'F' and 'S' records for the current period and reset counters
+   */
+  void
+  Flush(std::ostream& os);
+
+protected:
+  // from L3Tracer
+  virtual void
+  OutInterests(const Interest& interest, const Face& face);
+
+  virtual void
+  InInterests(const Interest& interest, const Face& face);
+
+  virtual void
+  OutData(const Data& data, const Face& face);
+
+  virtual void
+  InData(const Data& data, const Face& face);
+
+  virtual void
+  SatisfiedInterests(const nfd::pit::Entry&, const Face&, const Data&);
+
+  virtual void
+  TimedOutInterests(const nfd::pit::Entry&);
+
+private:
+  /**
+   * @brief Get column index of a face, registering it on first use
+   */
+  size_t
+  GetIndex(const Face& face);
+
+  void
+  Count(size_t index, Counter counter, size_t nBytes);
+
+private:
+  L3RateBinaryOutput& m_output;
+
+  /// FaceId => column index, or 0 if the face has not been seen
+  std::vector<uint32_t> m_indexByFaceId;
+
+  /// column index => FaceId; index 0 holds the node-wide totals
+  std::vector<uint32_t> m_faceIds;
+  std::vector<std::string> m_faceUris;
+  size_t m_nReportedFaces;
+
+  std::array<std::vector<uint32_t>, N_COUNTERS> m_packets;
+  std::array<std::vector<uint64_t>, N_BYTE_COUNTERS> m_bytes;
+
+  /// column indices with non-zero counters in the current period
+  std::vector<uint32_t> m_active;
+  std::vector<bool> m_isActive;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_L3_RATE_BINARY_TRACER_H
@@ -31,6 +31,18 @@
 
 #include "ns3/simulator.h"
 
+#ifdef NS3_MPI
+#include <ns3/mpi-interface.h>
+#endif
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <limits>
+#include <mutex>
+#include <thread>
+
 NS_LOG_COMPONENT_DEFINE("NlsrTracer");
 
 std::string helloTraceFile = "-node-nlsr-hello-trace-";
@@ -38,11 +50,215 @@ std::string syncTraceFile = "-node-nlsr-sync-trace-";
 std::string nlsaTraceFile = "-node-nlsr-nlsa-trace-";
 std::string llsaTraceFile = "-node-nlsr-llsa-trace-";
 std::string fibTraceFile = "-node-nlsr-fib-trace-";
+std::string binaryTraceFile = "-node-nlsr-trace.bin";
 
 namespace ns3 {
 
 namespace ndn {
 
+static const char MAGIC[8] = {'N', 'L', 'S', 'R', 'T', 'R', 'B', '1'};
+static const uint32_t NO_NAME = 0xFFFFFFFF;
+static const uint64_t NO_SIZE = std::numeric_limits<uint64_t>::max();
+static const size_t MAX_INTERNED_NAMES = 1 << 20;
+
+enum Category {
+  HELLO,
+  NAME_LSA,
+  LINK_LSA,
+  NSYNC,
+  FIB
+};
+
+struct EventInfo {
+  Category category;
+  const char* type;
+};
+
+// indexed by NlsrTracer::Event; type strings are those of the TEXT format
+static const EventInfo EVENTS[NlsrTracer::N_EVENTS] = {
+  {HELLO, "outHelloInterest"},
+  {HELLO, "inHelloInterest"},
+  {HELLO, "outHelloData"},
+  {HELLO, "inHelloData"},
+  {HELLO, "timedOutHelloInterest"},
+  {NAME_LSA, "outNameLsaInterest"},
+  {NAME_LSA, "inNameLsaInterest"},
+  {NAME_LSA, "outNameLsaData"},
+  {NAME_LSA, "inNameLsaData"},
+  {NAME_LSA, "timedoutNameLsaInterest"},
+  {NAME_LSA, "outCordLsaInterest"},
+  {NAME_LSA, "inCordLsaInterest"},
+  {NAME_LSA, "outCordLsaData"},
+  {NAME_LSA, "inCordLsaData"},
+  {NAME_LSA, "timedoutCordLsaInterest"},
+  {LINK_LSA, "outAdjLsaInterest"},
+  {LINK_LSA, "inAdjLsaInterest"},
+  {LINK_LSA, "outAdjLsaData"},
+  {LINK_LSA, "inAdjLsaData"},
+  {LINK_LSA, "timedoutAdjLsaInterest"},
+  {NSYNC, "outSyncInterest"},
+  {NSYNC, "inSyncInterest"},
+  {NSYNC, "outSyncData"},
+  {NSYNC, "inSyncData"},
+  {NSYNC, "timedOutSyncInterest"},
+  {NSYNC, "outRecovInterest"},
+  {NSYNC, "inRecovInterest"},
+  {NSYNC, "outRecovData"},
+  {NSYNC, "inRecovData"},
+  {NSYNC, "timedOutRecovInterest"},
+  {FIB, "dijkSinglePath"},
+  {FIB, "dijkMultiPath"},
+  {FIB, "hyperbolRouting"},
+  {FIB, "hyperDryRouting"},
+  {HELLO, "suppressedHelloInterest"},
+  {NSYNC, "suppressedSyncInterest"},
+};
+
+/**
+ * @brief Binary trace file written by a background thread
+ *
+ * Records are appended to the current block by the simulation thread.  Full blocks are
+ * handed to the writer thread, so the simulation thread takes the lock once per block
+ * and only waits for the disk when all blocks are in flight.
+ */
+class NlsrBinaryTraceWriter : boost::noncopyable
+{
+public:
+  static const size_t BLOCK_SIZE = 1 << 20;
+  static const size_t MAX_BLOCKS = 8;
+
+  explicit
+  NlsrBinaryTraceWriter(const std::string& file)
+    : m_nBlocks(1)
+    , m_isClosing(false)
+  {
+    m_os.open(file.c_str(), std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+    if (!m_os.is_open()) {
+      return;
+    }
+
+    m_block.reset(new std::vector<char>);
+    m_block->reserve(BLOCK_SIZE);
+    Append(MAGIC, sizeof(MAGIC));
+
+    m_thread = std::thread(&NlsrBinaryTraceWriter::Run, this);
+  }
+
+  ~NlsrBinaryTraceWriter()
+  {
+    Close();
+  }
+
+  bool
+  IsOpen() const
+  {
+    return m_os.is_open();
+  }
+
+  void
+  Append(const char* data, size_t length)
+  {
+    while (length > 0) {
+      size_t n = std::min(length, BLOCK_SIZE - m_block->size());
+      m_block->insert(m_block->end(), data, data + n);
+      data += n;
+      length -= n;
+      if (m_block->size() == BLOCK_SIZE) {
+        Submit();
+      }
+    }
+  }
+
+  void
+  Close()
+  {
+    if (!m_thread.joinable()) {
+      return;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (!m_block->empty()) {
+        m_full.push_back(std::move(m_block));
+      }
+      m_isClosing = true;
+    }
+    m_hasFull.notify_one();
+    m_thread.join();
+    m_os.close();
+  }
+
+private:
+  typedef std::unique_ptr<std::vector<char>> Block;
+
+  void
+  Submit()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_full.push_back(std::move(m_block));
+    m_hasFull.notify_one();
+
+    if (m_free.empty() && m_nBlocks < MAX_BLOCKS) {
+      ++m_nBlocks;
+      lock.unlock();
+      m_block.reset(new std::vector<char>);
+      m_block->reserve(BLOCK_SIZE);
+      return;
+    }
+
+    m_hasFree.wait(lock, [this] { return !m_free.empty(); });
+    m_block = std::move(m_free.front());
+    m_free.pop_front();
+    m_block->clear();
+  }
+
+  void
+  Run()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+      m_hasFull.wait(lock, [this] { return !m_full.empty() || m_isClosing; });
+      if (m_full.empty()) {
+        break;
+      }
+
+      Block block = std::move(m_full.front());
+      m_full.pop_front();
+      lock.unlock();
+      m_os.write(block->data(), block->size());
+      lock.lock();
+
+      m_free.push_back(std::move(block));
+      m_hasFree.notify_one();
+    }
+    m_os.flush();
+  }
+
+private:
+  std::ofstream m_os;
+  Block m_block;    ///< block being filled by the simulation thread
+  size_t m_nBlocks; ///< number of allocated blocks
+
+  std::mutex m_mutex;
+  std::condition_variable m_hasFull;
+  std::condition_variable m_hasFree;
+  std::deque<Block> m_full;
+  std::deque<Block> m_free;
+  bool m_isClosing;
+  std::thread m_thread;
+};
+
+const size_t NlsrBinaryTraceWriter::BLOCK_SIZE;
+const size_t NlsrBinaryTraceWriter::MAX_BLOCKS;
+
+template<typename T>
+static char*
+Put(char* p, const T& value)
+{
+  std::memcpy(p, &value, sizeof(value));
+  return p + sizeof(value);
+}
+
 NlsrTracer* NlsrTracer::inst = 0;
 int NlsrTracer::m_HelloCount = 0;
 int NlsrTracer::m_NameLsaCount = 0;
@@ -64,7 +280,10 @@ NlsrTracer& NlsrTracer::Instance() {
   return *inst;
 }
 
-NlsrTracer::NlsrTracer() {
+NlsrTracer::NlsrTracer()
+  : m_format(TEXT)
+  , m_nextNameId(0)
+{
   m_LogBlockSize = 4000;
 
   char* str = getenv("ENABLE_TRACER");
@@ -83,6 +302,8 @@ NlsrTracer::NlsrTracer() {
 }
 
 NlsrTracer::~NlsrTracer() {
+  Close();
+
   // Close of streams
   of_hello.close();
   of_nlsa.close();
@@ -113,14 +334,52 @@ NlsrTracer::IsEnabled() {
 }
 
 void 
-NlsrTracer::InitializeTracer(std::string prefix) {
+NlsrTracer::InitializeTracer(std::string prefix, Format format) {
 
   if (!m_EnableTracer) {
     return;
   }
 
   m_prefix = prefix;
+  m_format = format;
+
+#ifdef NS3_MPI
+  // every rank traces its own nodes; merge with examples/graphs/merge-rank-traces.py
+  if (MpiInterface::IsEnabled() && MpiInterface::GetSize() > 1) {
+    m_prefix += "-rank" + std::to_string(MpiInterface::GetSystemId());
+  }
+#endif
+
+  char* str = getenv("TRACER_FORMAT");
+  if (str != NULL) {
+    if (strcmp(str, "BINARY") == 0) {
+      m_format = BINARY;
+    } else if (strcmp(str, "TEXT") == 0) {
+      m_format = TEXT;
+    }
+  }
+
+  // a new simulation may name its nodes differently, and a new file defines them again
+  m_nodeNames.clear();
+  m_isNodeDefined.clear();
+  m_names.clear();
+
   boost::filesystem::path full_path(boost::filesystem::current_path());
+
+  if (m_format == BINARY) {
+    std::string file = full_path.string() + "/" + m_prefix + binaryTraceFile;
+    m_binaryWriter.reset(new NlsrBinaryTraceWriter(file));
+    if (!m_binaryWriter->IsOpen()) {
+      NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
+      m_binaryWriter.reset();
+      m_EnableTracer = false;
+      return;
+    }
+    NS_LOG_INFO("Nlsr tracer writes binary trace to " << file);
+    Simulator::ScheduleDestroy(&NlsrTracer::Close, this);
+    return;
+  }
+
   m_helloTracer = full_path.string() + "/" + m_prefix + helloTraceFile + std::to_string(m_HelloFileCount++) + ".txt";
   of_hello.open(m_helloTracer.c_str());
 
@@ -138,15 +397,16 @@ NlsrTracer::InitializeTracer(std::string prefix) {
 
   WriteHeaders();
   SetLogRollOverSize();
+  Simulator::ScheduleDestroy(&NlsrTracer::Close, this);
 }
 
 void
 NlsrTracer::WriteHeaders() {
-  of_llsa << "Time" << "\tNode" << "\tFaceId" << "\tFaceDescr" << "\tType" << "\tPackets" << "\tKBytes" << "\tPacketRaw" << endl;
-  of_nlsa << "Time" << "\tNode" << "\tName" << "\tType" << "\tPackets" << "\tKBytes" << "\t-" << "\t-" << endl;
-  of_hello << "Time" << "\tNode" << "\tName" << "\tType" << "\tPackets" << "\tKBytes" << "\t-" << "\t-" << endl;
-  of_nsync << "Time" << "\tNode" << "\tName" << "\tType" << "\tPackets" << "\tKBytes" << "\t-" << "\t-" << endl;
-  of_fib << "Time" << "\tNode" << "\tName" << "\tType" << "\tAttempt" << "\t-" << "\t-" << "\t-" << endl;
+  of_llsa << "Time" << "\tNode" << "\tFaceId" << "\tFaceDescr" << "\tType" << "\tPackets" << "\tKBytes" << "\tPacketRaw" << "\n";
+  of_nlsa << "Time" << "\tNode" << "\tName" << "\tType" << "\tPackets" << "\tKBytes" << "\t-" << "\t-" << "\n";
+  of_hello << "Time" << "\tNode" << "\tName" << "\tType" << "\tPackets" << "\tKBytes" << "\t-" << "\t-" << "\n";
+  of_nsync << "Time" << "\tNode" << "\tName" << "\tType" << "\tPackets" << "\tKBytes" << "\t-" << "\t-" << "\n";
+  of_fib << "Time" << "\tNode" << "\tName" << "\tType" << "\tAttempt" << "\t-" << "\t-" << "\t-" << "\n";
 }
 
 void
@@ -156,10 +416,9 @@ NlsrTracer::HelloTrace(std::string arg1, std::string arg2, std::string arg3, std
     return;
   }
 
-  ns3::Ptr<ns3::Node> node = ns3::NodeList::GetNode(ns3::Simulator::GetContext());
-  std::string nodeName = Names::FindName(node);
+  const std::string& nodeName = GetNodeName(Simulator::GetContext());
 
-  of_hello << Simulator::Now().ToDouble(Time::S) << "\t" << nodeName << "\t" << arg1 << "\t" << arg2 << "\t" << arg3 << "\t" << arg4 << "\t" << arg5 << "\t" << arg6 << endl; 
+  of_hello << Simulator::Now().ToDouble(Time::S) << "\t" << nodeName << "\t" << arg1 << "\t" << arg2 << "\t" << arg3 << "\t" << arg4 << "\t" << arg5 << "\t" << arg6 << "\n";
   if (++m_HelloCount == m_LogBlockSize) {
     // Close and create a new log file
     of_hello.flush();
@@ -169,7 +428,7 @@ NlsrTracer::HelloTrace(std::string arg1, std::string arg2, std::string arg3, std
     boost::filesystem::path full_path(boost::filesystem::current_path());
     m_helloTracer = full_path.string() + "/" + m_prefix + helloTraceFile + std::to_string(m_HelloFileCount++) + ".txt";
     of_hello.open(m_helloTracer.c_str()); 
-    of_hello << "Time" << "\tNode" << "\tName" << "\tType" << "\tPackets" << "\tKBytes" << "\t-" << "\t-" << endl;
+    of_hello << "Time" << "\tNode" << "\tName" << "\tType" << "\tPackets" << "\tKBytes" << "\t-" << "\t-" << "\n";
   }
 }
 
@@ -180,10 +439,9 @@ NlsrTracer::NameLsaTrace(std::string arg1, std::string arg2, std::string arg3, s
     return;
   }
 
-  ns3::Ptr<ns3::Node> node = ns3::NodeList::GetNode(ns3::Simulator::GetContext());
-  std::string nodeName = Names::FindName(node);
+  const std::string& nodeName = GetNodeName(Simulator::GetContext());
 
-  of_nlsa << Simulator::Now().ToDouble(Time::S) << "\t" << nodeName << "\t" << arg1 << "\t" << arg2 << "\t" << arg3 << "\t" << arg4 << "\t" << arg5 << "\t" << arg6 << endl; 
+  of_nlsa << Simulator::Now().ToDouble(Time::S) << "\t" << nodeName << "\t" << arg1 << "\t" << arg2 << "\t" << arg3 << "\t" << arg4 << "\t" << arg5 << "\t" << arg6 << "\n";
   if (++m_NameLsaCount == m_LogBlockSize) {
     // Close and create a new log file
     of_nlsa.flush();
@@ -193,7 +451,7 @@ NlsrTracer::NameLsaTrace(std::string arg1, std::string arg2, std::string arg3, s
     boost::filesystem::path full_path(boost::filesystem::current_path());
     m_nameLsaTracer = full_path.string() + "/" + m_prefix + nlsaTraceFile + std::to_string(m_NameLsaFileCount++) + ".txt";
     of_nlsa.open(m_nameLsaTracer.c_str()); 
-    of_nlsa << "Time" << "\tNode" << "\tName" << "\tType" << "\tPackets" << "\tKBytes" << "\t-" << "\t-" << endl;
+    of_nlsa << "Time" << "\tNode" << "\tName" << "\tType" << "\tPackets" << "\tKBytes" << "\t-" << "\t-" << "\n";
   }
 }
 
@@ -204,10 +462,9 @@ NlsrTracer::LinkLsaTrace(std::string arg1, std::string arg2, std::string arg3, s
     return;
   }
 
-  ns3::Ptr<ns3::Node> node = ns3::NodeList::GetNode(ns3::Simulator::GetContext());
-  std::string nodeName = Names::FindName(node);
+  const std::string& nodeName = GetNodeName(Simulator::GetContext());
 
-  of_llsa << Simulator::Now().ToDouble(Time::S) << "\t" << nodeName << "\t" << arg1 << "\t" << arg2 << "\t" << arg3 << "\t" << arg4 << "\t" << arg5 << "\t" << arg6 << endl; 
+  of_llsa << Simulator::Now().ToDouble(Time::S) << "\t" << nodeName << "\t" << arg1 << "\t" << arg2 << "\t" << arg3 << "\t" << arg4 << "\t" << arg5 << "\t" << arg6 << "\n";
   if (++m_LinkLsaCount == m_LogBlockSize) {
     of_llsa.flush();
     m_LinkLsaCount = 0;
@@ -216,7 +473,7 @@ NlsrTracer::LinkLsaTrace(std::string arg1, std::string arg2, std::string arg3, s
     boost::filesystem::path full_path(boost::filesystem::current_path());
     m_linkLsaTracer = full_path.string() + "/" + m_prefix + llsaTraceFile + std::to_string(m_LinkLsaFileCount++) + ".txt";
     of_llsa.open(m_linkLsaTracer.c_str()); 
-    of_llsa << "Time" << "\tNode" << "\tName" << "\tType" << "\tPackets" << "\tKBytes" << "\t-" << "\t-" << endl;
+    of_llsa << "Time" << "\tNode" << "\tName" << "\tType" << "\tPackets" << "\tKBytes" << "\t-" << "\t-" << "\n";
   }
 }
 
@@ -227,10 +484,9 @@ NlsrTracer::NsyncTrace(std::string arg1, std::string arg2, std::string arg3, std
     return;
   }
 
-  ns3::Ptr<ns3::Node> node = ns3::NodeList::GetNode(ns3::Simulator::GetContext());
-  std::string nodeName = Names::FindName(node);
+  const std::string& nodeName = GetNodeName(Simulator::GetContext());
 
-  of_nsync << Simulator::Now().ToDouble(Time::S) << "\t" << nodeName << "\t" << arg1 << "\t" << arg2 << "\t" << arg3 << "\t" << arg4 << "\t" << arg5 << "\t" << arg6 << endl; 
+  of_nsync << Simulator::Now().ToDouble(Time::S) << "\t" << nodeName << "\t" << arg1 << "\t" << arg2 << "\t" << arg3 << "\t" << arg4 << "\t" << arg5 << "\t" << arg6 << "\n";
   if (++m_NsyncCount == m_LogBlockSize) {
     // Close and create a new log file
     of_nsync.flush();
@@ -240,7 +496,7 @@ NlsrTracer::NsyncTrace(std::string arg1, std::string arg2, std::string arg3, std
     boost::filesystem::path full_path(boost::filesystem::current_path());
     m_nsyncTracer = full_path.string() + "/" + m_prefix + syncTraceFile + std::to_string(m_NsyncFileCount++) + ".txt";
     of_nsync.open(m_nsyncTracer.c_str()); 
-    of_nsync << "Time" << "\tNode" << "\tName" << "\tType" << "\tPackets" << "\tKBytes" << "\t-" << "\t-" << endl;
+    of_nsync << "Time" << "\tNode" << "\tName" << "\tType" << "\tPackets" << "\tKBytes" << "\t-" << "\t-" << "\n";
   }
 }
 
@@ -251,10 +507,9 @@ NlsrTracer::FibTrace(std::string arg1, std::string arg2, std::string arg3, std::
     return;
   }
 
-  ns3::Ptr<ns3::Node> node = ns3::NodeList::GetNode(ns3::Simulator::GetContext());
-  std::string nodeName = Names::FindName(node);
+  const std::string& nodeName = GetNodeName(Simulator::GetContext());
 
-  of_fib << Simulator::Now().ToDouble(Time::S) << "\t" << nodeName << "\t" << arg1 << "\t" << arg2 << "\t" << arg3 << "\t" << arg4 << "\t" << arg5 << "\t" << arg6 << endl; 
+  of_fib << Simulator::Now().ToDouble(Time::S) << "\t" << nodeName << "\t" << arg1 << "\t" << arg2 << "\t" << arg3 << "\t" << arg4 << "\t" << arg5 << "\t" << arg6 << "\n";
   if (++m_FibCount == m_LogBlockSize) {
     // Close and create a new log file
     of_fib.flush();
@@ -264,8 +519,189 @@ NlsrTracer::FibTrace(std::string arg1, std::string arg2, std::string arg3, std::
     boost::filesystem::path full_path(boost::filesystem::current_path());
     m_fibTracer = full_path.string() + "/" + m_prefix + fibTraceFile + std::to_string(m_FibFileCount++) + ".txt";
     of_fib.open(m_fibTracer.c_str()); 
-    of_fib << "Time" << "\tNode" << "\tName" << "\tType" << "\tAttempt" << "\t-" << "\t-" << "\t-" << endl;
+    of_fib << "Time" << "\tNode" << "\tName" << "\tType" << "\tAttempt" << "\t-" << "\t-" << "\t-" << "\n";
+  }
+}
+
+void
+NlsrTracer::Trace(Event event, const ::ndn::Name& name, uint64_t count, uint64_t size)
+{
+  if (!m_EnableTracer) {
+    return;
+  }
+
+  if (m_format == BINARY) {
+    if (m_binaryWriter != nullptr) {
+      WriteEvent(event, InternName(name).id, count, size);
+    }
+    return;
+  }
+
+  std::string uri = name.toUri();
+  std::string countStr = std::to_string(count);
+  std::string sizeStr = size == NO_SIZE ? "-" : std::to_string(size);
+
+  switch (EVENTS[event].category) {
+  case HELLO:
+    HelloTrace(uri, EVENTS[event].type, countStr, sizeStr);
+    break;
+  case NAME_LSA:
+    NameLsaTrace(uri, EVENTS[event].type, countStr, sizeStr);
+    break;
+  case LINK_LSA:
+    LinkLsaTrace(uri, EVENTS[event].type, countStr, sizeStr);
+    break;
+  case NSYNC:
+    NsyncTrace(uri, EVENTS[event].type, countStr, sizeStr);
+    break;
+  case FIB:
+    FibTrace(uri, EVENTS[event].type, countStr, sizeStr);
+    break;
+  }
+}
+
+void
+NlsrTracer::Trace(Event event, uint64_t count)
+{
+  if (!m_EnableTracer) {
+    return;
+  }
+
+  if (m_format == BINARY) {
+    if (m_binaryWriter != nullptr) {
+      WriteEvent(event, NO_NAME, count, NO_SIZE);
+    }
+    return;
+  }
+
+  std::string countStr = std::to_string(count);
+
+  switch (EVENTS[event].category) {
+  case HELLO:
+    HelloTrace("-", EVENTS[event].type, countStr);
+    break;
+  case NAME_LSA:
+    NameLsaTrace("-", EVENTS[event].type, countStr);
+    break;
+  case LINK_LSA:
+    LinkLsaTrace("-", EVENTS[event].type, countStr);
+    break;
+  case NSYNC:
+    NsyncTrace("-", EVENTS[event].type, countStr);
+    break;
+  case FIB:
+    FibTrace("-", EVENTS[event].type, countStr);
+    break;
+  }
+}
+
+size_t
+NlsrTracer::GetUriLength(const ::ndn::Name& name)
+{
+  if (m_EnableTracer && m_binaryWriter != nullptr) {
+    return InternName(name).uriLength;
+  }
+  return name.toUri().size();
+}
+
+void
+NlsrTracer::Close()
+{
+  if (m_binaryWriter != nullptr) {
+    m_binaryWriter->Close();
+    m_binaryWriter.reset();
+  }
+
+  // TEXT rows are not flushed one by one
+  of_hello.flush();
+  of_nlsa.flush();
+  of_llsa.flush();
+  of_nsync.flush();
+  of_fib.flush();
+}
+
+const NlsrTracer::InternedName&
+NlsrTracer::InternName(const ::ndn::Name& name)
+{
+  auto it = m_names.find(name);
+  if (it != m_names.end()) {
+    return it->second;
+  }
+
+  // bound memory in long runs; evicted names are defined again under a new id on next use,
+  // and ids are never reused
+  if (m_names.size() >= MAX_INTERNED_NAMES) {
+    m_names.clear();
+    m_binaryWriter->Append("R", 1);
+  }
+
+  std::string uri = name.toUri();
+  InternedName interned = {m_nextNameId++, static_cast<uint32_t>(uri.size())};
+
+  uint16_t length = static_cast<uint16_t>(std::min<size_t>(uri.size(), 0xFFFF));
+  char header[1 + sizeof(uint32_t) + sizeof(uint16_t)];
+  char* p = Put(header, 'S');
+  p = Put(p, interned.id);
+  Put(p, length);
+  m_binaryWriter->Append(header, sizeof(header));
+  m_binaryWriter->Append(uri.data(), length);
+
+  return m_names.emplace(name, interned).first->second;
+}
+
+void
+NlsrTracer::WriteEvent(Event event, uint32_t nameId, uint64_t count, uint64_t size)
+{
+  uint32_t nodeId = Simulator::GetContext();
+  if (nodeId < NodeList::GetNNodes()) {
+    if (nodeId >= m_isNodeDefined.size()) {
+      m_isNodeDefined.resize(nodeId + 1, false);
+    }
+
+    if (!m_isNodeDefined[nodeId]) {
+      m_isNodeDefined[nodeId] = true;
+
+      std::string nodeName = GetNodeName(nodeId);
+      if (nodeName.empty()) {
+        nodeName = std::to_string(nodeId);
+      }
+      uint16_t length = static_cast<uint16_t>(std::min<size_t>(nodeName.size(), 0xFFFF));
+      char header[1 + sizeof(uint32_t) + sizeof(uint16_t)];
+      char* p = Put(header, 'N');
+      p = Put(p, nodeId);
+      Put(p, length);
+      m_binaryWriter->Append(header, sizeof(header));
+      m_binaryWriter->Append(nodeName.data(), length);
+    }
+  }
+
+  char record[1 + sizeof(int64_t) + sizeof(uint32_t) + sizeof(uint8_t) + sizeof(uint32_t) +
+              sizeof(uint64_t) + sizeof(uint64_t)];
+  char* p = Put(record, 'E');
+  p = Put(p, static_cast<int64_t>(Simulator::Now().GetNanoSeconds()));
+  p = Put(p, nodeId);
+  p = Put(p, static_cast<uint8_t>(event));
+  p = Put(p, nameId);
+  p = Put(p, count);
+  Put(p, size);
+  m_binaryWriter->Append(record, sizeof(record));
+}
+
+const std::string&
+NlsrTracer::GetNodeName(uint32_t nodeId)
+{
+  static const std::string noName;
+  if (nodeId >= NodeList::GetNNodes()) {
+    return noName;
+  }
+
+  if (nodeId >= m_nodeNames.size()) {
+    m_nodeNames.resize(NodeList::GetNNodes());
+  }
+  if (m_nodeNames[nodeId].empty()) {
+    m_nodeNames[nodeId] = Names::FindName(NodeList::GetNode(nodeId));
   }
+  return m_nodeNames[nodeId];
 }
 
 } // namespace ndn
@@ -28,23 +28,138 @@
 
 #include <boost/filesystem.hpp>
 
+#include <ndn-cxx/name.hpp>
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
 namespace ns3 {
 
 using namespace std;
 
 namespace ndn {
 
+class NlsrBinaryTraceWriter;
+
 class NlsrTracer {
 
 public:
+  /**
+   * @brief Output format of the tracer
+   *
+   * TEXT writes one tab-separated file per category, as before.
+   * BINARY writes all categories into a single buffered binary file
+   * (<prefix>-node-nlsr-trace.bin), which is converted into the TEXT layout
+   * by examples/graphs/nlsr-trace-to-tsv.py.
+   *
+   * Binary file format (native byte order):
+   *
+   *     header:   char[8] "NLSRTRB1"
+   *     'N':      uint32 node, uint16 length, char[length] node name
+   *     'S':      uint32 name id, uint16 length, char[length] name URI
+   *     'R':      names defined so far are forgotten (to bound memory in long runs);
+   *               a name used again is defined under a new id, ids are never reused
+   *     'E':      int64 time (ns), uint32 node, uint8 event, uint32 name id,
+   *               uint64 count, uint64 size
+   *
+   * A node or name is defined before the first event that refers to it.  Name id
+   * 0xFFFFFFFF and size 0xFFFFFFFFFFFFFFFF are printed as "-".
+   */
+  enum Format {
+    TEXT,
+    BINARY
+  };
+
+  /**
+   * @brief Typed trace events; the order is part of the binary format
+   */
+  enum Event : uint8_t {
+    // hello trace
+    OUT_HELLO_INTEREST,
+    IN_HELLO_INTEREST,
+    OUT_HELLO_DATA,
+    IN_HELLO_DATA,
+    TIMED_OUT_HELLO_INTEREST,
+    // name LSA trace
+    OUT_NAME_LSA_INTEREST,
+    IN_NAME_LSA_INTEREST,
+    OUT_NAME_LSA_DATA,
+    IN_NAME_LSA_DATA,
+    TIMED_OUT_NAME_LSA_INTEREST,
+    OUT_CORD_LSA_INTEREST,
+    IN_CORD_LSA_INTEREST,
+    OUT_CORD_LSA_DATA,
+    IN_CORD_LSA_DATA,
+    TIMED_OUT_CORD_LSA_INTEREST,
+    // link LSA trace
+    OUT_ADJ_LSA_INTEREST,
+    IN_ADJ_LSA_INTEREST,
+    OUT_ADJ_LSA_DATA,
+    IN_ADJ_LSA_DATA,
+    TIMED_OUT_ADJ_LSA_INTEREST,
+    // sync trace
+    OUT_SYNC_INTEREST,
+    IN_SYNC_INTEREST,
+    OUT_SYNC_DATA,
+    IN_SYNC_DATA,
+    TIMED_OUT_SYNC_INTEREST,
+    OUT_RECOV_INTEREST,
+    IN_RECOV_INTEREST,
+    OUT_RECOV_DATA,
+    IN_RECOV_DATA,
+    TIMED_OUT_RECOV_INTEREST,
+    // fib trace
+    DIJK_SINGLE_PATH,
+    DIJK_MULTI_PATH,
+    HYPERBOL_ROUTING,
+    HYPER_DRY_ROUTING,
+    // periodic Interests not sent while the network was quiescent, see NlsrFastForward
+    SUPPRESSED_HELLO_INTEREST,
+    SUPPRESSED_SYNC_INTEREST,
+    N_EVENTS
+  };
+
   static NlsrTracer& Instance();
 
   virtual ~NlsrTracer();
 
-  void InitializeTracer(std::string prefix);
+  /**
+   * @brief Open trace files named after @p prefix
+   *
+   * The TRACER_FORMAT environment variable ("TEXT" or "BINARY") overrides @p format.
+   * In a distributed simulation, "-rank<system id>" is appended to @p prefix.
+   */
+  void InitializeTracer(std::string prefix, Format format = TEXT);
 
   bool IsEnabled();
 
+  /**
+   * @brief Record an event about a packet with name @p name on the current node
+   */
+  void
+  Trace(Event event, const ::ndn::Name& name, uint64_t count, uint64_t size);
+
+  /**
+   * @brief Record an event that is not about a packet on the current node
+   */
+  void
+  Trace(Event event, uint64_t count);
+
+  /**
+   * @brief Length of name.toUri(), computed once per distinct name in BINARY format
+   */
+  size_t
+  GetUriLength(const ::ndn::Name& name);
+
+  /**
+   * @brief Write out buffered BINARY records and close the file, flush TEXT files
+   *
+   * Scheduled to run at Simulator::Destroy.
+   */
+  void
+  Close();
+
   void 
   HelloTrace(std::string agr1 = "-", std::string agr2 = "-", std::string agr3 = "-", std::string agr4 = "-", std::string agr5 = "-", std::string agr6 = "-");
 
@@ -69,6 +184,26 @@ private:
   void WriteHeaders();
   void SetLogRollOverSize();
 
+  struct InternedName {
+    uint32_t id;
+    uint32_t uriLength;
+  };
+
+  /**
+   * @brief Interned id of @p name in BINARY format, defining it in the trace on first use
+   */
+  const InternedName&
+  InternName(const ::ndn::Name& name);
+
+  void
+  WriteEvent(Event event, uint32_t nameId, uint64_t count, uint64_t size);
+
+  /**
+   * @brief Name of node @p nodeId, looked up in ns3::Names once per node
+   */
+  const std::string&
+  GetNodeName(uint32_t nodeId);
+
   std::string m_prefix;
   std::string m_currPath;
   std::string m_helloTracer;
@@ -98,6 +233,15 @@ private:
 
   static bool m_EnableTracer;
   int m_LogBlockSize;
+
+  // BINARY format
+  Format m_format;
+  std::unique_ptr<NlsrBinaryTraceWriter> m_binaryWriter;
+  std::unordered_map<::ndn::Name, InternedName> m_names;
+  uint32_t m_nextNameId;
+  std::vector<bool> m_isNodeDefined;
+
+  std::vector<std::string> m_nodeNames;
 };
 
 } // namespace ndn
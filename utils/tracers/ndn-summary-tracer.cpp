@@ -0,0 +1,380 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-summary-tracer.hpp"
+#include "ndn-l3-tracer.hpp"
+#include "ns3/node.h"
+#include "ns3/application.h"
+#include "ns3/names.h"
+#include "ns3/callback.h"
+#include "ns3/simulator.h"
+#include "ns3/log.h"
+
+#include "apps/ndn-app.hpp"
+#include "model/ndn-l3-protocol.hpp"
+#include "daemon/table/pit-entry.hpp"
+
+#include <fstream>
+#include <list>
+
+NS_LOG_COMPONENT_DEFINE("ndn.SummaryTracer");
+
+namespace ns3 {
+namespace ndn {
+
+const size_t SummaryTracer::N_BYTE_COUNTERS;
+
+static const char* COUNTER_NAMES[SummaryTracer::N_COUNTERS] = {"InInterests", "OutInterests",
+                                                               "InData", "OutData",
+                                                               "SatisfiedInterests",
+                                                               "TimedOutInterests", "CacheHits",
+                                                               "CacheMisses"};
+
+/**
+ * @brief Counts the packets of one node in the arrays of its SummaryTracer
+ */
+class SummaryTracer::NodeTracer : public L3Tracer {
+public:
+  NodeTracer(SummaryTracer& tracer, size_t index, Ptr<Node> node)
+    : L3Tracer(node)
+    , m_tracer(tracer)
+    , m_index(index)
+  {
+    Ptr<L3Protocol> l3 = node->GetObject<L3Protocol>();
+    l3->TraceConnectWithoutContext("CacheHits", MakeCallback(&NodeTracer::CacheHits, this));
+    l3->TraceConnectWithoutContext("CacheMisses", MakeCallback(&NodeTracer::CacheMisses, this));
+
+    // only consumers have these trace sources, connecting other applications fails silently
+    for (uint32_t i = 0; i < node->GetNApplications(); ++i) {
+      Ptr<Application> app = node->GetApplication(i);
+      app->TraceConnectWithoutContext("FirstInterestDataDelay",
+                                      MakeCallback(&NodeTracer::FirstInterestDataDelay, this));
+      app->TraceConnectWithoutContext("LastRetransmittedInterestDataDelay",
+                                      MakeCallback(&NodeTracer::LastRetransmittedInterestDataDelay,
+                                                   this));
+    }
+  }
+
+  // from L3Tracer
+  virtual void
+  PrintHeader(std::ostream& os) const
+  {
+    m_tracer.PrintHeader(os);
+  }
+
+  /**
+   * @brief Print the counters of the node in the current period
+   */
+  virtual void
+  Print(std::ostream& os) const
+  {
+    m_tracer.PrintCounters(os, m_node, &m_tracer.m_packets[m_index * N_COUNTERS],
+                           &m_tracer.m_bytes[m_index * N_BYTE_COUNTERS], false);
+  }
+
+protected:
+  // from L3Tracer
+  virtual void
+  OutInterests(const Interest& interest, const Face&)
+  {
+    m_tracer.Count(m_index, OUT_INTERESTS, interest.hasWire() ? interest.wireEncode().size() : 0);
+  }
+
+  virtual void
+  InInterests(const Interest& interest, const Face&)
+  {
+    m_tracer.Count(m_index, IN_INTERESTS, interest.hasWire() ? interest.wireEncode().size() : 0);
+  }
+
+  virtual void
+  OutData(const Data& data, const Face&)
+  {
+    m_tracer.Count(m_index, OUT_DATA, data.hasWire() ? data.wireEncode().size() : 0);
+  }
+
+  virtual void
+  InData(const Data& data, const Face&)
+  {
+    m_tracer.Count(m_index, IN_DATA, data.hasWire() ? data.wireEncode().size() : 0);
+  }
+
+  virtual void
+  SatisfiedInterests(const nfd::pit::Entry&, const Face&, const Data&)
+  {
+    m_tracer.Count(m_index, SATISFIED_INTERESTS, 0);
+  }
+
+  virtual void
+  TimedOutInterests(const nfd::pit::Entry&)
+  {
+    m_tracer.Count(m_index, TIMED_OUT_INTERESTS, 0);
+  }
+
+private:
+  void
+  CacheHits(const Interest&, const Data&)
+  {
+    m_tracer.Count(m_index, CACHE_HITS, 0);
+  }
+
+  void
+  CacheMisses(const Interest&)
+  {
+    m_tracer.Count(m_index, CACHE_MISSES, 0);
+  }
+
+  void
+  FirstInterestDataDelay(Ptr<App>, uint32_t, Time delay, uint32_t retxCount, int32_t hopCount)
+  {
+    m_tracer.FirstInterestDataDelay(delay, retxCount, hopCount);
+  }
+
+  void
+  LastRetransmittedInterestDataDelay(Ptr<App>, uint32_t, Time delay, int32_t)
+  {
+    m_tracer.LastRetransmittedInterestDataDelay(delay);
+  }
+
+private:
+  SummaryTracer& m_tracer;
+  size_t m_index;
+};
+
+static std::list<Ptr<SummaryTracer>> g_tracers;
+
+void
+SummaryTracer::Destroy()
+{
+  for (const auto& tracer : g_tracers) {
+    tracer->Flush();
+  }
+  g_tracers.clear();
+}
+
+void
+SummaryTracer::InstallAll(const std::string& file, Time averagingPeriod /* = Seconds (0.5)*/,
+                          uint32_t delaySampling /* = 1*/, bool perNode /* = false*/)
+{
+  Install(NodeContainer::GetGlobal(), file, averagingPeriod, delaySampling, perNode);
+}
+
+void
+SummaryTracer::Install(const NodeContainer& nodes, const std::string& file,
+                       Time averagingPeriod /* = Seconds (0.5)*/, uint32_t delaySampling /* = 1*/,
+                       bool perNode /* = false*/)
+{
+  shared_ptr<std::ostream> outputStream;
+  if (file != "-") {
+    shared_ptr<std::ofstream> os(new std::ofstream());
+    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
+
+    if (!os->is_open()) {
+      NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
+      return;
+    }
+
+    outputStream = os;
+  }
+  else {
+    outputStream = shared_ptr<std::ostream>(&std::cout, std::bind([]{}));
+  }
+
+  Ptr<SummaryTracer> tracer = Install(nodes, outputStream, averagingPeriod, delaySampling,
+                                      perNode);
+  tracer->PrintHeader(*outputStream);
+  *outputStream << "\n";
+
+  g_tracers.push_back(tracer);
+}
+
+Ptr<SummaryTracer>
+SummaryTracer::Install(const NodeContainer& nodes, shared_ptr<std::ostream> outputStream,
+                       Time averagingPeriod /* = Seconds (0.5)*/, uint32_t delaySampling /* = 1*/,
+                       bool perNode /* = false*/)
+{
+  return Create<SummaryTracer>(outputStream, nodes, averagingPeriod, delaySampling, perNode);
+}
+
+SummaryTracer::SummaryTracer(shared_ptr<std::ostream> os, const NodeContainer& nodes,
+                             Time averagingPeriod, uint32_t delaySampling, bool perNode)
+  : m_os(os)
+  , m_period(averagingPeriod)
+  , m_lastPrint(Simulator::Now())
+  , m_delaySampling(std::max<uint32_t>(delaySampling, 1))
+  , m_perNode(perNode)
+  , m_packets(nodes.GetN() * N_COUNTERS, 0)
+  , m_bytes(nodes.GetN() * N_BYTE_COUNTERS, 0)
+  , m_nFullDelays(0)
+  , m_nLastDelays(0)
+{
+  for (NodeContainer::Iterator node = nodes.Begin(); node != nodes.End(); node++) {
+    NS_LOG_DEBUG("Node: " << (*node)->GetId());
+
+    std::string name = Names::FindName(*node);
+    if (name.empty()) {
+      name = std::to_string((*node)->GetId());
+    }
+    m_nodeNames.push_back(name);
+    m_nodeTracers.push_back(Create<NodeTracer>(*this, m_nodeTracers.size(), *node));
+  }
+
+  Reset();
+  m_printEvent = Simulator::Schedule(m_period, &SummaryTracer::PeriodicPrinter, this);
+}
+
+SummaryTracer::~SummaryTracer()
+{
+  m_printEvent.Cancel();
+}
+
+void
+SummaryTracer::PeriodicPrinter()
+{
+  Flush();
+
+  m_printEvent = Simulator::Schedule(m_period, &SummaryTracer::PeriodicPrinter, this);
+}
+
+void
+SummaryTracer::Flush()
+{
+  if (Simulator::Now() <= m_lastPrint) {
+    return;
+  }
+
+  Print(*m_os);
+  Reset();
+  m_lastPrint = Simulator::Now();
+}
+
+void
+SummaryTracer::Reset()
+{
+  std::fill(m_packets.begin(), m_packets.end(), 0);
+  std::fill(m_bytes.begin(), m_bytes.end(), 0);
+
+  m_fullDelays.Reset();
+  m_lastDelays.Reset();
+  m_retxCountSum = 0;
+  m_hopCountSum = 0;
+}
+
+void
+SummaryTracer::FirstInterestDataDelay(Time delay, uint32_t retxCount, int32_t hopCount)
+{
+  if (m_nFullDelays++ % m_delaySampling != 0) {
+    return;
+  }
+
+  m_fullDelays.Record(delay);
+  m_retxCountSum += retxCount;
+  m_hopCountSum += hopCount;
+}
+
+void
+SummaryTracer::LastRetransmittedInterestDataDelay(Time delay)
+{
+  if (m_nLastDelays++ % m_delaySampling != 0) {
+    return;
+  }
+
+  m_lastDelays.Record(delay);
+}
+
+void
+SummaryTracer::PrintHeader(std::ostream& os) const
+{
+  os << "Time"
+     << "\t"
+
+     << "Node"
+     << "\t"
+
+     << "Type"
+     << "\t"
+     << "Value";
+}
+
+void
+SummaryTracer::PrintCounters(std::ostream& os, const std::string& node, const uint64_t* packets,
+                             const uint64_t* bytes, bool skipZeros) const
+{
+  double time = Simulator::Now().ToDouble(Time::S);
+
+  for (size_t counter = 0; counter < N_COUNTERS; ++counter) {
+    if (!skipZeros || packets[counter] != 0) {
+      os << time << "\t" << node << "\t" << COUNTER_NAMES[counter] << "\t" << packets[counter]
+         << "\n";
+    }
+  }
+  for (size_t counter = 0; counter < N_BYTE_COUNTERS; ++counter) {
+    if (!skipZeros || bytes[counter] != 0) {
+      os << time << "\t" << node << "\t" << COUNTER_NAMES[counter] << "Kilobytes"
+         << "\t" << bytes[counter] / 1024.0 << "\n";
+    }
+  }
+}
+
+void
+SummaryTracer::Print(std::ostream& os) const
+{
+  double time = Simulator::Now().ToDouble(Time::S);
+
+  std::vector<uint64_t> packets(N_COUNTERS, 0);
+  std::vector<uint64_t> bytes(N_BYTE_COUNTERS, 0);
+  for (size_t node = 0; node < m_nodeNames.size(); ++node) {
+    for (size_t counter = 0; counter < N_COUNTERS; ++counter) {
+      packets[counter] += m_packets[node * N_COUNTERS + counter];
+    }
+    for (size_t counter = 0; counter < N_BYTE_COUNTERS; ++counter) {
+      bytes[counter] += m_bytes[node * N_BYTE_COUNTERS + counter];
+    }
+  }
+  PrintCounters(os, "all", packets.data(), bytes.data(), false);
+
+  auto printDelays = [&] (const DelayHistogram& delays, const std::string& name) {
+    if (delays.GetCount() == 0) {
+      return;
+    }
+    os << time << "\tall\t" << name << "Samples\t" << delays.GetCount() << "\n"
+       << time << "\tall\t" << name << "Mean\t" << delays.GetMean().ToDouble(Time::S) << "\n"
+       << time << "\tall\t" << name << "P50\t" << delays.GetQuantile(0.5).ToDouble(Time::S) << "\n"
+       << time << "\tall\t" << name << "P90\t" << delays.GetQuantile(0.9).ToDouble(Time::S) << "\n"
+       << time << "\tall\t" << name << "P99\t" << delays.GetQuantile(0.99).ToDouble(Time::S) << "\n"
+       << time << "\tall\t" << name << "Max\t" << delays.GetMax().ToDouble(Time::S) << "\n";
+  };
+
+  printDelays(m_fullDelays, "FullDelay");
+  if (m_fullDelays.GetCount() > 0) {
+    double nSamples = m_fullDelays.GetCount();
+    os << time << "\tall\tHopCountMean\t" << m_hopCountSum / nSamples << "\n"
+       << time << "\tall\tRetxCountMean\t" << m_retxCountSum / nSamples << "\n";
+  }
+  printDelays(m_lastDelays, "LastDelay");
+
+  if (m_perNode) {
+    for (size_t node = 0; node < m_nodeNames.size(); ++node) {
+      PrintCounters(os, m_nodeNames[node], &m_packets[node * N_COUNTERS],
+                    &m_bytes[node * N_BYTE_COUNTERS], true);
+    }
+  }
+}
+
+} // namespace ndn
+} // namespace ns3
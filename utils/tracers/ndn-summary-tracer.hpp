@@ -0,0 +1,209 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_SUMMARY_TRACER_H
+#define NDN_SUMMARY_TRACER_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ndn-delay-histogram.hpp"
+
+#include "ns3/ptr.h"
+#include "ns3/simple-ref-count.h"
+#include "ns3/nstime.h"
+#include "ns3/event-id.h"
+#include "ns3/node-container.h"
+
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-tracers
+ * @brief Tracer summarizing network-layer, content store and application metrics of many nodes
+ *
+ * Counts the packets of L3RateTracer and the cache hits and misses of CsTracer on every traced
+ * node, and the delays reported by AppDelayTracer on their applications, but only writes totals
+ * over all nodes once per period, and streaming quantiles of the delays (see DelayHistogram)
+ * instead of one line per Data packet.  A single event flushes all nodes.
+ *
+ * Output is tab-separated values, with columns Time, Node, Type and Value.  Every period has:
+ *
+ * - for all nodes (Node is "all"), the number of packets of each counter (InInterests,
+ *   OutInterests, InData, OutData, SatisfiedInterests, TimedOutInterests, CacheHits,
+ *   CacheMisses) and the kilobytes of InInterests, OutInterests, InData and OutData (as
+ *   InInterestsKilobytes, ...)
+ * - if any Data came back to applications, FullDelay and LastDelay statistics in seconds (the
+ *   number of Samples, Mean, P50, P90, P99 and Max), and the mean HopCount and RetxCount of
+ *   the Data
+ * - optionally, the non-zero counters of each node
+ */
+class SummaryTracer : public SimpleRefCount<SummaryTracer> {
+public:
+  /**
+   * @brief Helper method to install the tracer on all simulation nodes
+   *
+   * @param file File to which traces will be written.  If filename is -, then std::out is used
+   * @param averagingPeriod How often data will be written into the trace file
+   * @param delaySampling Only one out of every delaySampling delays is recorded
+   * @param perNode Whether counters of each node are written as well as their totals
+   */
+  static void
+  InstallAll(const std::string& file, Time averagingPeriod = Seconds(0.5),
+             uint32_t delaySampling = 1, bool perNode = false);
+
+  /**
+   * @brief Helper method to install the tracer on the selected simulation nodes
+   *
+   * @param nodes Nodes on which to install tracer
+   * @param file File to which traces will be written.  If filename is -, then std::out is used
+   * @param averagingPeriod How often data will be written into the trace file
+   * @param delaySampling Only one out of every delaySampling delays is recorded
+   * @param perNode Whether counters of each node are written as well as their totals
+   */
+  static void
+  Install(const NodeContainer& nodes, const std::string& file, Time averagingPeriod = Seconds(0.5),
+          uint32_t delaySampling = 1, bool perNode = false);
+
+  /**
+   * @brief Helper method to install the tracer on the selected simulation nodes
+   *
+   * @param nodes Nodes on which to install tracer
+   * @param outputStream Smart pointer to a stream
+   * @param averagingPeriod How often data will be written into the trace file
+   * @param delaySampling Only one out of every delaySampling delays is recorded
+   * @param perNode Whether counters of each node are written as well as their totals
+   *
+   * @returns the tracer, which needs to be preserved for the lifetime of simulation
+   */
+  static Ptr<SummaryTracer>
+  Install(const NodeContainer& nodes, shared_ptr<std::ostream> outputStream,
+          Time averagingPeriod = Seconds(0.5), uint32_t delaySampling = 1, bool perNode = false);
+
+  /**
+   * @brief Explicit request to write the last period and remove all statically created tracers
+   */
+  static void
+  Destroy();
+
+  /**
+   * @brief Per-node counters
+   */
+  enum Counter {
+    IN_INTERESTS,
+    OUT_INTERESTS,
+    IN_DATA,
+    OUT_DATA,
+    SATISFIED_INTERESTS,
+    TIMED_OUT_INTERESTS,
+    CACHE_HITS,
+    CACHE_MISSES,
+    N_COUNTERS
+  };
+
+  /**
+   * @brief Only the first N_BYTE_COUNTERS counters have byte counts
+   */
+  static const size_t N_BYTE_COUNTERS = OUT_DATA + 1;
+
+  SummaryTracer(shared_ptr<std::ostream> os, const NodeContainer& nodes, Time averagingPeriod,
+                uint32_t delaySampling, bool perNode);
+
+  ~SummaryTracer();
+
+  /**
+   * @brief Print head of the trace (e.g., for post-processing)
+   *
+   * @param os reference to output stream
+   */
+  void
+  PrintHeader(std::ostream& os) const;
+
+  /**
+   * @brief Print trace data of the current period
+   *
+   * @param os reference to output stream
+   */
+  void
+  Print(std::ostream& os) const;
+
+  /**
+   * @brief Write the current period, if it has started, and reset counters
+   */
+  void
+  Flush();
+
+private:
+  class NodeTracer;
+
+  void
+  PeriodicPrinter();
+
+  void
+  Reset();
+
+  void
+  Count(size_t node, Counter counter, size_t nBytes)
+  {
+    ++m_packets[node * N_COUNTERS + counter];
+    if (counter < N_BYTE_COUNTERS) {
+      m_bytes[node * N_BYTE_COUNTERS + counter] += nBytes;
+    }
+  }
+
+  void
+  FirstInterestDataDelay(Time delay, uint32_t retxCount, int32_t hopCount);
+
+  void
+  LastRetransmittedInterestDataDelay(Time delay);
+
+  void
+  PrintCounters(std::ostream& os, const std::string& node, const uint64_t* packets,
+                const uint64_t* bytes, bool skipZeros) const;
+
+private:
+  shared_ptr<std::ostream> m_os;
+  Time m_period;
+  EventId m_printEvent;
+  Time m_lastPrint;
+
+  uint32_t m_delaySampling;
+  bool m_perNode;
+
+  std::vector<Ptr<NodeTracer>> m_nodeTracers;
+  std::vector<std::string> m_nodeNames;
+
+  /// node index * N_COUNTERS + counter => number of packets in the current period
+  std::vector<uint64_t> m_packets;
+  /// node index * N_BYTE_COUNTERS + counter => number of bytes in the current period
+  std::vector<uint64_t> m_bytes;
+
+  DelayHistogram m_fullDelays;
+  DelayHistogram m_lastDelays;
+  uint64_t m_nFullDelays;
+  uint64_t m_nLastDelays;
+  uint64_t m_retxCountSum;
+  int64_t m_hopCountSum;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_SUMMARY_TRACER_H
@@ -0,0 +1,258 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef BUCKET_LFU_POLICY_H_
+#define BUCKET_LFU_POLICY_H_
+
+/// @cond include_hidden
+
+#include <boost/intrusive/options.hpp>
+#include <boost/intrusive/list.hpp>
+
+namespace ns3 {
+namespace ndn {
+namespace ndnSIM {
+
+/**
+ * @brief Traits for LFU replacement policy with constant-time hits
+ *
+ * Evicts the same entries as lfu_policy_traits: the least frequently used one and, among
+ * equally used ones, the one that reached this frequency first.  Instead of a multiset ordered
+ * by frequency, entries are kept in a list sorted by frequency, split into buckets of entries
+ * with the same frequency.  A hit moves the entry to the end of the next bucket, in O(1).
+ */
+struct bucket_lfu_policy_traits {
+  /// @brief Name that can be used to identify the policy (for NS-3 object model and logging)
+  static std::string
+  GetName()
+  {
+    return "BucketLfu";
+  }
+
+  struct policy_hook_type : public boost::intrusive::list_member_hook<> {
+    void* bucket; ///< bucket of the entry, owned by the policy
+  };
+
+  template<class Container>
+  struct container_hook {
+    typedef boost::intrusive::member_hook<Container, policy_hook_type, &Container::policy_hook_>
+      type;
+  };
+
+  template<class Base, class Container, class Hook>
+  struct policy {
+    typedef typename boost::intrusive::list<Container, Hook> policy_container;
+
+    struct bucket : public boost::intrusive::list_base_hook<> {
+      bucket(size_t freq)
+        : frequency(freq)
+        , tail(0)
+      {
+      }
+
+      size_t frequency;
+      Container* tail; ///< last entry of the bucket in policy_container
+    };
+
+    typedef boost::intrusive::list<bucket> bucket_container;
+
+    static policy_hook_type*
+    get_hook(typename Container::iterator item)
+    {
+      return static_cast<policy_hook_type*>(policy_container::value_traits::to_node_ptr(*item));
+    }
+
+    static bucket*
+    get_bucket(typename Container::iterator item)
+    {
+      return static_cast<bucket*>(get_hook(item)->bucket);
+    }
+
+    static void
+    set_bucket(typename Container::iterator item, bucket* b)
+    {
+      get_hook(item)->bucket = b;
+    }
+
+    static size_t
+    get_frequency(typename Container::const_iterator item)
+    {
+      return static_cast<const bucket*>(
+               static_cast<const policy_hook_type*>(
+                 policy_container::value_traits::to_node_ptr(*item))->bucket)->frequency;
+    }
+
+    struct bucket_disposer {
+      void
+      operator()(bucket* delete_this)
+      {
+        delete delete_this;
+      }
+    };
+
+    // could be just typedef
+    class type : public policy_container {
+    public:
+      typedef policy policy_base; // to get access to get_frequency methods from outside
+      typedef Container parent_trie;
+
+      type(Base& base)
+        : base_(base)
+        , max_size_(100)
+      {
+      }
+
+      ~type()
+      {
+        buckets_.clear_and_dispose(bucket_disposer());
+      }
+
+      inline void
+      update(typename parent_trie::iterator item)
+      {
+        increment(item);
+      }
+
+      inline bool
+      insert(typename parent_trie::iterator item)
+      {
+        if (max_size_ != 0 && policy_container::size() >= max_size_) {
+          // this erases the "least frequently used item" from cache
+          base_.erase(&(*policy_container::begin()));
+        }
+
+        // new entries have frequency 0 and go last among them
+        if (buckets_.empty() || buckets_.front().frequency != 0) {
+          buckets_.push_front(*new bucket(0));
+          policy_container::push_front(*item);
+        }
+        else {
+          policy_container::insert(next_to(buckets_.front().tail), *item);
+        }
+
+        set_bucket(item, &buckets_.front());
+        buckets_.front().tail = item;
+        return true;
+      }
+
+      inline void
+      lookup(typename parent_trie::iterator item)
+      {
+        increment(item);
+      }
+
+      inline void
+      erase(typename parent_trie::iterator item)
+      {
+        detach(item);
+        policy_container::erase(policy_container::s_iterator_to(*item));
+      }
+
+      inline void
+      clear()
+      {
+        policy_container::clear();
+        buckets_.clear_and_dispose(bucket_disposer());
+      }
+
+      inline void
+      set_max_size(size_t max_size)
+      {
+        max_size_ = max_size;
+      }
+
+      inline size_t
+      get_max_size() const
+      {
+        return max_size_;
+      }
+
+    private:
+      type()
+        : base_(*((Base*)0)){};
+
+      typename policy_container::iterator
+      next_to(Container* entry)
+      {
+        return ++policy_container::s_iterator_to(*entry);
+      }
+
+      /**
+       * @brief Move the entry to the end of the bucket with the next frequency
+       */
+      void
+      increment(typename parent_trie::iterator item)
+      {
+        bucket* current = get_bucket(item);
+        typename bucket_container::iterator next = ++buckets_.iterator_to(*current);
+
+        typename policy_container::iterator position;
+        if (next == buckets_.end() || next->frequency != current->frequency + 1) {
+          // the entries of a new bucket follow the ones of the current bucket
+          position = next_to(current->tail);
+          next = buckets_.insert(next, *new bucket(current->frequency + 1));
+        }
+        else {
+          position = next_to(next->tail);
+        }
+
+        detach(item);
+        policy_container::splice(position, *this, policy_container::s_iterator_to(*item));
+        set_bucket(item, &(*next));
+        next->tail = item;
+      }
+
+      /**
+       * @brief Remove the entry from its bucket, deleting the bucket if it becomes empty
+       */
+      void
+      detach(typename parent_trie::iterator item)
+      {
+        bucket* current = get_bucket(item);
+        if (current->tail != item) {
+          return;
+        }
+
+        typename policy_container::iterator entry = policy_container::s_iterator_to(*item);
+        if (entry != policy_container::begin()) {
+          --entry;
+          if (get_bucket(&(*entry)) == current) {
+            current->tail = &(*entry);
+            return;
+          }
+        }
+
+        buckets_.erase_and_dispose(buckets_.iterator_to(*current), bucket_disposer());
+      }
+
+    private:
+      Base& base_;
+      size_t max_size_;
+      bucket_container buckets_; ///< buckets by increasing frequency
+    };
+  };
+};
+
+} // ndnSIM
+} // ndn
+} // ns3
+
+/// @endcond
+
+#endif // BUCKET_LFU_POLICY_H_
@@ -0,0 +1,133 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef FREQUENCY_SKETCH_H_
+#define FREQUENCY_SKETCH_H_
+
+/// @cond include_hidden
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+namespace ndnSIM {
+namespace detail {
+
+/**
+ * @brief Count-Min sketch of recent access frequencies, with 4-bit saturating counters
+ *
+ * All counters are halved once the number of increments reaches ten times the number of
+ * tracked items, so that the estimates follow changes in popularity.
+ */
+class frequency_sketch {
+public:
+  frequency_sketch()
+  {
+    resize(16);
+  }
+
+  /**
+   * @brief Size the sketch for @p max_size items, clearing all counters
+   */
+  void
+  resize(size_t max_size)
+  {
+    width_ = 16;
+    while (width_ < max_size) {
+      width_ <<= 1;
+    }
+    counters_.assign(depth * width_, 0);
+    sample_size_ = 10 * std::max<size_t>(max_size, 1);
+    additions_ = 0;
+  }
+
+  void
+  increment(size_t hash)
+  {
+    bool isAdded = false;
+    for (size_t row = 0; row < depth; ++row) {
+      uint8_t& counter = counters_[index(hash, row)];
+      if (counter < max_count) {
+        ++counter;
+        isAdded = true;
+      }
+    }
+
+    if (isAdded && ++additions_ >= sample_size_) {
+      age();
+    }
+  }
+
+  uint8_t
+  estimate(size_t hash) const
+  {
+    uint8_t count = max_count;
+    for (size_t row = 0; row < depth; ++row) {
+      count = std::min(count, counters_[index(hash, row)]);
+    }
+    return count;
+  }
+
+  void
+  clear()
+  {
+    std::fill(counters_.begin(), counters_.end(), 0);
+    additions_ = 0;
+  }
+
+private:
+  size_t
+  index(size_t hash, size_t row) const
+  {
+    static const uint64_t seeds[depth] = {0xc3a5c85c97cb3127ULL, 0xb492b66fbe98f273ULL,
+                                          0x9ae16a3b2f90404fULL, 0xcbf29ce484222325ULL};
+    uint64_t h = (static_cast<uint64_t>(hash) + seeds[row]) * seeds[row];
+    h ^= h >> 32;
+    return row * width_ + (h & (width_ - 1));
+  }
+
+  void
+  age()
+  {
+    for (uint8_t& counter : counters_) {
+      counter >>= 1;
+    }
+    additions_ /= 2;
+  }
+
+private:
+  static const size_t depth = 4;
+  static const uint8_t max_count = 15;
+
+  size_t width_; ///< counters per row, a power of two
+  std::vector<uint8_t> counters_;
+  size_t sample_size_;
+  size_t additions_;
+};
+
+} // detail
+} // ndnSIM
+} // ndn
+} // ns3
+
+/// @endcond
+
+#endif // FREQUENCY_SKETCH_H_
@@ -0,0 +1,245 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef TINY_LFU_POLICY_H_
+#define TINY_LFU_POLICY_H_
+
+/// @cond include_hidden
+
+#include "detail/frequency-sketch.hpp"
+
+#include <boost/functional/hash.hpp>
+#include <boost/intrusive/options.hpp>
+#include <boost/intrusive/list.hpp>
+
+#include <algorithm>
+#include <iterator>
+
+namespace ns3 {
+namespace ndn {
+namespace ndnSIM {
+
+/**
+ * @brief Traits for W-TinyLFU replacement policy
+ *
+ * New entries go to an LRU window holding 1% of the cache.  An entry leaving the window is
+ * only admitted to the main LRU part if it was requested more often than the entry it would
+ * evict, as estimated by a Count-Min sketch of recent requests; otherwise it is evicted
+ * itself.  One-time requests thus do not push popular content out of the cache.
+ *
+ * The policy only sees cache hits and insertions, so a miss is counted when its Data is
+ * inserted.
+ */
+struct tiny_lfu_policy_traits {
+  /// @brief Name that can be used to identify the policy (for NS-3 object model and logging)
+  static std::string
+  GetName()
+  {
+    return "TinyLfu";
+  }
+
+  struct policy_hook_type : public boost::intrusive::list_member_hook<> {
+    bool isInWindow;
+  };
+
+  template<class Container>
+  struct container_hook {
+    typedef boost::intrusive::member_hook<Container, policy_hook_type, &Container::policy_hook_>
+      type;
+  };
+
+  template<class Base, class Container, class Hook>
+  struct policy {
+    // main part from least to most recently used, followed by the window in the same order
+    typedef typename boost::intrusive::list<Container, Hook> policy_container;
+
+    static bool&
+    is_in_window(typename Container::iterator item)
+    {
+      return static_cast<policy_hook_type*>(policy_container::value_traits::to_node_ptr(*item))
+        ->isInWindow;
+    }
+
+    template<class Key>
+    static size_t
+    get_key_hash(const Key& key)
+    {
+      return boost::hash_range(key.value(), key.value() + key.value_size());
+    }
+
+    /**
+     * @brief Hash of the full name of the entry, to count requests across evictions
+     */
+    static size_t
+    get_hash(typename Container::const_iterator item)
+    {
+      size_t hash = 0;
+      for (; item != 0; item = item->parent()) {
+        // from the last component of the name to the first one
+        for (auto component = item->suffix().rbegin(); component != item->suffix().rend();
+             ++component) {
+          boost::hash_combine(hash, get_key_hash(*component));
+        }
+        boost::hash_combine(hash, get_key_hash(item->key()));
+      }
+      return hash;
+    }
+
+    // could be just typedef
+    class type : public policy_container {
+    public:
+      typedef policy policy_base; // to get access to get_hash methods from outside
+      typedef Container parent_trie;
+
+      type(Base& base)
+        : base_(base)
+        , max_size_(100)
+        , window_begin_(policy_container::end())
+        , window_size_(0)
+      {
+        sketch_.resize(max_size_);
+      }
+
+      inline void
+      update(typename parent_trie::iterator item)
+      {
+        relocate(item);
+      }
+
+      inline bool
+      insert(typename parent_trie::iterator item)
+      {
+        sketch_.increment(get_hash(item));
+
+        is_in_window(item) = true;
+        policy_container::push_back(*item);
+        if (window_begin_ == policy_container::end()) {
+          window_begin_ = policy_container::s_iterator_to(*item);
+        }
+        ++window_size_;
+
+        if (max_size_ != 0 && window_size_ > get_window_max_size()) {
+          // the least recently used entry of the window becomes the most recently used one of
+          // the main part, where it may only stay if more popular than the main part's victim
+          typename parent_trie::iterator candidate = &(*window_begin_);
+          ++window_begin_;
+          --window_size_;
+          is_in_window(candidate) = false;
+
+          if (policy_container::size() > max_size_) {
+            typename parent_trie::iterator victim = &(*policy_container::begin());
+            if (victim != candidate
+                && sketch_.estimate(get_hash(candidate)) > sketch_.estimate(get_hash(victim))) {
+              base_.erase(victim);
+            }
+            else {
+              base_.erase(candidate);
+            }
+          }
+        }
+        return true;
+      }
+
+      inline void
+      lookup(typename parent_trie::iterator item)
+      {
+        sketch_.increment(get_hash(item));
+        relocate(item);
+      }
+
+      inline void
+      erase(typename parent_trie::iterator item)
+      {
+        typename policy_container::iterator entry = policy_container::s_iterator_to(*item);
+        if (is_in_window(item)) {
+          if (entry == window_begin_) {
+            ++window_begin_;
+          }
+          --window_size_;
+        }
+        policy_container::erase(entry);
+      }
+
+      inline void
+      clear()
+      {
+        policy_container::clear();
+        window_begin_ = policy_container::end();
+        window_size_ = 0;
+        sketch_.clear();
+      }
+
+      inline void
+      set_max_size(size_t max_size)
+      {
+        max_size_ = max_size;
+        sketch_.resize(max_size_);
+      }
+
+      inline size_t
+      get_max_size() const
+      {
+        return max_size_;
+      }
+
+    private:
+      type()
+        : base_(*((Base*)0)){};
+
+      size_t
+      get_window_max_size() const
+      {
+        return std::max<size_t>(max_size_ / 100, 1);
+      }
+
+      /**
+       * @brief Make the entry the most recently used one of its part
+       */
+      void
+      relocate(typename parent_trie::iterator item)
+      {
+        typename policy_container::iterator entry = policy_container::s_iterator_to(*item);
+        if (!is_in_window(item)) {
+          policy_container::splice(window_begin_, *this, entry);
+        }
+        else if (std::next(entry) != policy_container::end()) {
+          if (entry == window_begin_) {
+            ++window_begin_;
+          }
+          policy_container::splice(policy_container::end(), *this, entry);
+        }
+      }
+
+    private:
+      Base& base_;
+      size_t max_size_;
+      typename policy_container::iterator window_begin_; ///< oldest entry of the window
+      size_t window_size_;
+      detail::frequency_sketch sketch_;
+    };
+  };
+};
+
+} // ndnSIM
+} // ndn
+} // ns3
+
+/// @endcond
+
+#endif // TINY_LFU_POLICY_H_
@@ -41,8 +41,8 @@ public:
                     typename PolicyTraits::template container_hook<parent_trie>::type>::type
       policy_container;
 
-  inline trie_with_policy(size_t bucketSize = 1, size_t bucketIncrement = 1)
-    : trie_(name::Component(), bucketSize, bucketIncrement)
+  inline trie_with_policy()
+    : trie_(name::Component())
     , policy_(*this)
   {
   }
@@ -72,9 +72,10 @@ public:
   {
     iterator foundItem, lastItem;
     bool reachLast;
-    std::tie(foundItem, reachLast, lastItem) = trie_.find(key);
+    size_t pastKey;
+    std::tie(foundItem, reachLast, lastItem, pastKey) = trie_.find(key);
 
-    if (!reachLast || lastItem->payload() == PayloadTraits::empty_payload)
+    if (!reachLast || pastKey > 0 || lastItem->payload() == PayloadTraits::empty_payload)
       return; // nothing to invalidate
 
     erase(lastItem);
@@ -119,9 +120,10 @@ public:
   {
     iterator foundItem, lastItem;
     bool reachLast;
-    std::tie(foundItem, reachLast, lastItem) = trie_.find(key);
+    size_t pastKey;
+    std::tie(foundItem, reachLast, lastItem, pastKey) = trie_.find(key);
 
-    if (!reachLast || lastItem->payload() == PayloadTraits::empty_payload)
+    if (!reachLast || pastKey > 0 || lastItem->payload() == PayloadTraits::empty_payload)
       return end();
 
     return lastItem;
@@ -135,7 +137,8 @@ public:
   {
     iterator foundItem, lastItem;
     bool reachLast;
-    std::tie(foundItem, reachLast, lastItem) = trie_.find(key);
+    size_t pastKey;
+    std::tie(foundItem, reachLast, lastItem, pastKey) = trie_.find(key);
     if (foundItem != trie_.end()) {
       policy_.lookup(s_iterator_to(foundItem));
     }
@@ -151,7 +154,8 @@ public:
   {
     iterator foundItem, lastItem;
     bool reachLast;
-    std::tie(foundItem, reachLast, lastItem) = trie_.find_if(key, pred);
+    size_t pastKey;
+    std::tie(foundItem, reachLast, lastItem, pastKey) = trie_.find_if(key, pred);
     if (foundItem != trie_.end()) {
       policy_.lookup(s_iterator_to(foundItem));
     }
@@ -176,7 +180,8 @@ public:
   {
     iterator foundItem, lastItem;
     bool reachLast;
-    std::tie(foundItem, reachLast, lastItem) = trie_.find(key);
+    size_t pastKey;
+    std::tie(foundItem, reachLast, lastItem, pastKey) = trie_.find(key);
 
     // guard in case we don't have anything in the trie
     if (lastItem == trie_.end())
@@ -203,7 +208,8 @@ public:
   {
     iterator foundItem, lastItem;
     bool reachLast;
-    std::tie(foundItem, reachLast, lastItem) = trie_.find(key);
+    size_t pastKey;
+    std::tie(foundItem, reachLast, lastItem, pastKey) = trie_.find(key);
 
     // guard in case we don't have anything in the trie
     if (lastItem == trie_.end())
@@ -234,14 +240,22 @@ public:
   {
     iterator foundItem, lastItem;
     bool reachLast;
-    std::tie(foundItem, reachLast, lastItem) = trie_.find(key);
+    size_t pastKey;
+    std::tie(foundItem, reachLast, lastItem, pastKey) = trie_.find(key);
 
     // guard in case we don't have anything in the trie
     if (lastItem == trie_.end())
       return trie_.end();
 
     if (reachLast) {
-      foundItem = lastItem->find_if_next_level(pred); // may or may not find something
+      if (pastKey == 0) {
+        foundItem = lastItem->find_if_next_level(pred); // may or may not find something
+      }
+      else {
+        // the key ends within the label of lastItem, which has the only next level component
+        const name::Component& next = lastItem->suffix()[lastItem->suffix().size() - pastKey];
+        foundItem = pred(next) ? lastItem->find() : trie_.end();
+      }
       if (foundItem == trie_.end()) {
         return trie_.end();
       }
@@ -30,10 +30,12 @@
 #include <boost/intrusive/list.hpp>
 #include <boost/intrusive/set.hpp>
 #include <boost/functional/hash.hpp>
-#include <boost/interprocess/smart_ptr/unique_ptr.hpp>
 #include <tuple>
 #include <boost/foreach.hpp>
-#include <boost/mpl/if.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
 
 namespace ns3 {
 namespace ndn {
@@ -126,10 +128,21 @@ class trie_iterator;
 template<class T>
 class trie_point_iterator;
 
+/**
+ * @brief Name trie with path compression
+ *
+ * A chain of nodes without payload that have a single child is stored as one node, labeled with
+ * all the components of the chain: key() followed by suffix().  Nodes with payload are never
+ * merged or split into other nodes, so iterators to them stay valid until they are erased.
+ *
+ * Children are kept in a small array sorted by key, compared without hashing, until a node has
+ * more than max_array_children of them, and in a hash set from then on.
+ */
 template<typename FullKey, typename PayloadTraits, typename PolicyHook>
 class trie {
 public:
   typedef typename FullKey::value_type Key;
+  typedef std::vector<Key> key_suffix;
 
   typedef trie* iterator;
   typedef const trie* const_iterator;
@@ -142,15 +155,13 @@ public:
 
   typedef PayloadTraits payload_traits;
 
-  inline trie(const Key& key, size_t bucketSize = 1, size_t bucketIncrement = 1)
+  /**
+   * @brief Maximum number of children kept in the sorted array
+   */
+  static const size_t max_array_children = 8;
+
+  inline trie(const Key& key)
     : key_(key)
-    , initialBucketSize_(bucketSize)
-    , bucketIncrement_(bucketIncrement)
-    , bucketSize_(initialBucketSize_)
-    , buckets_(new bucket_type[bucketSize_]) // cannot use normal pointer, because lifetime of
-                                             // buckets should be larger than lifetime of the
-                                             // container
-    , children_(bucket_traits(buckets_.get(), bucketSize_))
     , payload_(PayloadTraits::empty_payload)
     , parent_(nullptr)
   {
@@ -195,29 +206,30 @@ public:
   {
     trie* trieNode = this;
 
-    BOOST_FOREACH (const Key& subkey, key) {
-      typename unordered_set::iterator item = trieNode->children_.find(subkey);
-      if (item == trieNode->children_.end()) {
-        trie* newNode = new trie(subkey, initialBucketSize_, bucketIncrement_);
-        // std::cout << "new " << newNode << "\n";
-        newNode->parent_ = trieNode;
-
-        if (trieNode->children_.size() >= trieNode->bucketSize_) {
-          trieNode->bucketSize_ += trieNode->bucketIncrement_;
-          trieNode->bucketIncrement_ *= 2; // increase bucketIncrement exponentially
-
-          buckets_array newBuckets(new bucket_type[trieNode->bucketSize_]);
-          trieNode->children_.rehash(bucket_traits(newBuckets.get(), trieNode->bucketSize_));
-          trieNode->buckets_.swap(newBuckets);
+    size_t i = 0;
+    while (i < key.size()) {
+      trie* child = trieNode->children_.find(key[i]);
+      if (child == 0) {
+        // the rest of the key is the label of a single new node
+        trie* newNode = new trie(key[i]);
+        newNode->suffix_.reserve(key.size() - i - 1);
+        for (++i; i < key.size(); ++i) {
+          newNode->suffix_.push_back(key[i]);
         }
+        trieNode->add_child(*newNode);
 
-        std::pair<typename unordered_set::iterator, bool> ret =
-          trieNode->children_.insert(*newNode);
+        trieNode = newNode;
+        break;
+      }
 
-        trieNode = &(*ret.first);
+      ++i;
+      size_t matched = child->match_suffix(key, i);
+      i += matched;
+      if (matched < child->suffix_.size()) {
+        // the key ends or diverges within the label
+        child = child->split(matched);
       }
-      else
-        trieNode = &(*item);
+      trieNode = child;
     }
 
     if (trieNode->payload_ == PayloadTraits::empty_payload) {
@@ -240,21 +252,29 @@ public:
 
   /**
    * @brief Do exactly as erase, but without erasing the payload
+   *
+   * A node without payload is deleted if it has no children, and merged into its child if it
+   * has only one.
+   *
+   * @return the deepest node left on the path to this node
    */
   inline iterator
   prune()
   {
-    if (payload_ == PayloadTraits::empty_payload && children_.size() == 0) {
-      if (parent_ == 0)
-        return this;
+    if (payload_ != PayloadTraits::empty_payload || parent_ == 0)
+      return this;
 
-      trie* parent = parent_;
-      parent->children_
-        .erase_and_dispose(*this,
-                           trie_delete_disposer()); // delete this; basically, committing a suicide
+    trie* parent = parent_;
+    if (children_.size() == 0) {
+      parent->children_.erase(*this);
+      delete this; // basically, committing a suicide
 
       return parent->prune();
     }
+    else if (children_.size() == 1) {
+      merge_into_child();
+      return parent;
+    }
     return this;
   }
 
@@ -264,83 +284,72 @@ public:
   inline void
   prune_node()
   {
-    if (payload_ == PayloadTraits::empty_payload && children_.size() == 0) {
-      if (parent_ == 0)
-        return;
+    if (payload_ != PayloadTraits::empty_payload || parent_ == 0)
+      return;
 
-      trie* parent = parent_;
-      parent->children_
-        .erase_and_dispose(*this,
-                           trie_delete_disposer()); // delete this; basically, committing a suicide
+    if (children_.size() == 0) {
+      parent_->children_.erase(*this);
+      delete this; // basically, committing a suicide
+    }
+    else if (children_.size() == 1) {
+      merge_into_child();
     }
   }
 
-  // inline std::tuple<const iterator, bool, const iterator>
-  // find (const FullKey &key) const
-  // {
-  //   return const_cast<trie*> (this)->find (key);
-  // }
-
   /**
    * @brief Perform the longest prefix match
    * @param key the key for which to perform the longest prefix match
    *
-   * @return ->second is true if prefix in ->first is longer than key
+   * @return tuple of:
+   *  - the deepest node with payload whose name is a prefix of the key, or 0
+   *  - true if the whole key is a prefix of the name of the node where the match ended
+   *  - the node where the match ended
+   *  - the number of components of the label of that node past the end of the key, 0 if the
+   *    key ends exactly at the node
    */
-  inline std::tuple<iterator, bool, iterator>
+  inline std::tuple<iterator, bool, iterator, size_t>
   find(const FullKey& key)
   {
-    trie* trieNode = this;
-    iterator foundNode = (payload_ != PayloadTraits::empty_payload) ? this : 0;
-    bool reachLast = true;
-
-    BOOST_FOREACH (const Key& subkey, key) {
-      typename unordered_set::iterator item = trieNode->children_.find(subkey);
-      if (item == trieNode->children_.end()) {
-        reachLast = false;
-        break;
-      }
-      else {
-        trieNode = &(*item);
-
-        if (trieNode->payload_ != PayloadTraits::empty_payload)
-          foundNode = trieNode;
-      }
-    }
-
-    return std::make_tuple(foundNode, reachLast, trieNode);
+    return find_if(key, any_payload());
   }
 
   /**
    * @brief Perform the longest prefix match satisfying preficate
    * @param key the key for which to perform the longest prefix match
    *
-   * @return ->second is true if prefix in ->first is longer than key
+   * @return same as find(), but only nodes whose payload satisfies the predicate are matched
    */
   template<class Predicate>
-  inline std::tuple<iterator, bool, iterator>
+  inline std::tuple<iterator, bool, iterator, size_t>
   find_if(const FullKey& key, Predicate pred)
   {
     trie* trieNode = this;
     iterator foundNode = (payload_ != PayloadTraits::empty_payload) ? this : 0;
-    bool reachLast = true;
 
-    BOOST_FOREACH (const Key& subkey, key) {
-      typename unordered_set::iterator item = trieNode->children_.find(subkey);
-      if (item == trieNode->children_.end()) {
-        reachLast = false;
-        break;
+    size_t i = 0;
+    while (i < key.size()) {
+      trie* child = trieNode->children_.find(key[i]);
+      if (child == 0) {
+        return std::make_tuple(foundNode, false, trieNode, 0);
       }
-      else {
-        trieNode = &(*item);
 
-        if (trieNode->payload_ != PayloadTraits::empty_payload && pred(trieNode->payload_)) {
-          foundNode = trieNode;
+      ++i;
+      size_t matched = child->match_suffix(key, i);
+      i += matched;
+      if (matched < child->suffix_.size()) {
+        if (i < key.size()) {
+          return std::make_tuple(foundNode, false, trieNode, 0);
         }
+        return std::make_tuple(foundNode, true, child, child->suffix_.size() - matched);
+      }
+
+      trieNode = child;
+      if (trieNode->payload_ != PayloadTraits::empty_payload && pred(trieNode->payload_)) {
+        foundNode = trieNode;
       }
     }
 
-    return std::make_tuple(foundNode, reachLast, trieNode);
+    return std::make_tuple(foundNode, true, trieNode, 0);
   }
 
   /**
@@ -354,11 +363,7 @@ public:
     if (payload_ != PayloadTraits::empty_payload)
       return this;
 
-    typedef trie<FullKey, PayloadTraits, PolicyHook> trie;
-    for (typename trie::unordered_set::iterator subnode = children_.begin();
-         subnode != children_.end(); subnode++)
-    // BOOST_FOREACH (trie &subnode, children_)
-    {
+    for (trie* subnode = children_.first(); subnode != 0; subnode = children_.next(*subnode)) {
       iterator value = subnode->find();
       if (value != 0)
         return value;
@@ -380,11 +385,7 @@ public:
     if (payload_ != PayloadTraits::empty_payload && pred(payload_))
       return this;
 
-    typedef trie<FullKey, PayloadTraits, PolicyHook> trie;
-    for (typename trie::unordered_set::iterator subnode = children_.begin();
-         subnode != children_.end(); subnode++)
-    // BOOST_FOREACH (const trie &subnode, children_)
-    {
+    for (trie* subnode = children_.first(); subnode != 0; subnode = children_.next(*subnode)) {
       iterator value = subnode->find_if(pred);
       if (value != 0)
         return value;
@@ -406,9 +407,7 @@ public:
   inline const iterator
   find_if_next_level(Predicate pred)
   {
-    typedef trie<FullKey, PayloadTraits, PolicyHook> trie;
-    for (typename trie::unordered_set::iterator subnode = children_.begin();
-         subnode != children_.end(); subnode++) {
+    for (trie* subnode = children_.first(); subnode != 0; subnode = children_.next(*subnode)) {
       if (pred(subnode->key())) {
         return subnode->find();
       }
@@ -447,12 +446,35 @@ public:
     payload_ = payload;
   }
 
+  /**
+   * @brief Get the first component of the label of the node
+   */
   Key
   key() const
   {
     return key_;
   }
 
+  /**
+   * @brief Get the components following key() in the label of the node
+   *
+   * Empty unless the node stands for a compressed chain of nodes.
+   */
+  const key_suffix&
+  suffix() const
+  {
+    return suffix_;
+  }
+
+  /**
+   * @brief Get the parent node, or 0 for the root node
+   */
+  const trie*
+  parent() const
+  {
+    return parent_;
+  }
+
   inline void
   PrintStat(std::ostream& os) const;
 
@@ -466,15 +488,86 @@ private:
     }
   };
 
-  template<class D>
-  struct array_disposer {
-    void
-    operator()(D* array)
+  struct any_payload {
+    template<class Payload>
+    bool
+    operator()(const Payload&) const
     {
-      delete[] array;
+      return true;
     }
   };
 
+  /**
+   * @brief Number of components of the suffix of the label equal to the components of @p key
+   *        starting at @p pos
+   */
+  size_t
+  match_suffix(const FullKey& key, size_t pos) const
+  {
+    size_t matched = 0;
+    while (matched < suffix_.size() && pos + matched < key.size()
+           && suffix_[matched] == key[pos + matched]) {
+      ++matched;
+    }
+    return matched;
+  }
+
+  void
+  add_child(trie& child)
+  {
+    child.parent_ = this;
+    children_.insert(child);
+  }
+
+  /**
+   * @brief Split the label of the node after the first @p n components of its suffix
+   * @return the new parent of the node, labeled with the first part of the label
+   */
+  trie*
+  split(size_t n)
+  {
+    trie* upper = new trie(key_);
+    upper->suffix_.assign(suffix_.begin(), suffix_.begin() + n);
+
+    trie* parent = parent_;
+    parent->children_.erase(*this);
+
+    key_ = suffix_[n];
+    suffix_.erase(suffix_.begin(), suffix_.begin() + n + 1);
+
+    upper->add_child(*this);
+    parent->add_child(*upper);
+    return upper;
+  }
+
+  /**
+   * @brief Merge the node, without payload, into its only child and delete it
+   */
+  void
+  merge_into_child()
+  {
+    trie* parent = parent_;
+    trie* child = children_.first();
+    children_.erase(*child);
+    parent->children_.erase(*this);
+
+    // label of the child becomes the label of the node followed by the label of the child
+    suffix_.push_back(child->key_);
+    suffix_.insert(suffix_.end(), child->suffix_.begin(), child->suffix_.end());
+    child->key_ = key_;
+    child->suffix_.swap(suffix_);
+
+    parent->add_child(*child);
+    delete this;
+  }
+
+  static std::size_t
+  hash_key(const Key& key)
+  {
+    // equality of components only depends on their values
+    return boost::hash_range(key.value(), key.value() + key.value_size());
+  }
+
   friend std::ostream& operator<<<>(std::ostream& os, const trie& trie_node);
 
 public:
@@ -492,6 +585,192 @@ private:
   typedef typename unordered_set::bucket_type bucket_type;
   typedef typename unordered_set::bucket_traits bucket_traits;
 
+  struct key_hash {
+    std::size_t
+    operator()(const Key& key) const
+    {
+      return hash_key(key);
+    }
+  };
+
+  struct key_equal {
+    bool
+    operator()(const Key& key, const trie& node) const
+    {
+      return key == node.key_;
+    }
+
+    bool
+    operator()(const trie& node, const Key& key) const
+    {
+      return key == node.key_;
+    }
+  };
+
+  /**
+   * @brief Children of a node, in an array sorted by key while there are few of them and in a
+   *        hash set otherwise
+   */
+  class children_container {
+  public:
+    size_t
+    size() const
+    {
+      return hashed_ != nullptr ? hashed_->set.size() : array_.size();
+    }
+
+    trie*
+    find(const Key& key) const
+    {
+      if (hashed_ != nullptr) {
+        typename unordered_set::const_iterator item =
+          hashed_->set.find(key, key_hash(), key_equal());
+        return item != hashed_->set.end() ? const_cast<trie*>(&*item) : 0;
+      }
+
+      for (trie* child : array_) {
+        if (child->key_ == key)
+          return child;
+      }
+      return 0;
+    }
+
+    void
+    insert(trie& child)
+    {
+      if (hashed_ == nullptr && array_.size() >= max_array_children) {
+        hashed_.reset(new hashed_children(4 * max_array_children));
+        for (trie* item : array_) {
+          hashed_->set.insert(*item);
+        }
+        array_ = std::vector<trie*>();
+      }
+
+      if (hashed_ != nullptr) {
+        if (hashed_->set.size() >= hashed_->bucketCount) {
+          hashed_->rehash(2 * hashed_->bucketCount);
+        }
+        hashed_->set.insert(child);
+      }
+      else {
+        array_.insert(std::upper_bound(array_.begin(), array_.end(), &child, key_less()), &child);
+      }
+    }
+
+    void
+    erase(trie& child)
+    {
+      if (hashed_ == nullptr) {
+        array_.erase(std::find(array_.begin(), array_.end(), &child));
+        return;
+      }
+
+      hashed_->set.erase(hashed_->set.iterator_to(child));
+      if (hashed_->set.size() <= max_array_children / 2) {
+        array_.reserve(max_array_children);
+        for (trie& item : hashed_->set) {
+          array_.push_back(&item);
+        }
+        std::sort(array_.begin(), array_.end(), key_less());
+        hashed_->set.clear();
+        hashed_.reset();
+      }
+    }
+
+    /**
+     * @brief Get the first child, or 0 if there are none
+     */
+    trie*
+    first() const
+    {
+      if (hashed_ != nullptr) {
+        return hashed_->set.empty() ? 0 : const_cast<trie*>(&*hashed_->set.begin());
+      }
+      return array_.empty() ? 0 : array_.front();
+    }
+
+    /**
+     * @brief Get the child after @p child, or 0 if it is the last one
+     */
+    trie*
+    next(const trie& child) const
+    {
+      if (hashed_ != nullptr) {
+        typename unordered_set::const_iterator item = hashed_->set.iterator_to(child);
+        ++item;
+        return item != hashed_->set.end() ? const_cast<trie*>(&*item) : 0;
+      }
+
+      typename std::vector<trie*>::const_iterator item =
+        std::find(array_.begin(), array_.end(), &child);
+      ++item;
+      return item != array_.end() ? *item : 0;
+    }
+
+    template<class Disposer>
+    void
+    clear_and_dispose(Disposer disposer)
+    {
+      if (hashed_ != nullptr) {
+        hashed_->set.clear_and_dispose(disposer);
+        hashed_.reset();
+      }
+      else {
+        std::vector<trie*> array;
+        array.swap(array_);
+        std::for_each(array.begin(), array.end(), disposer);
+      }
+    }
+
+    void
+    PrintStat(std::ostream& os) const
+    {
+      if (hashed_ != nullptr) {
+        for (size_t bucket = 0; bucket < hashed_->set.bucket_count(); bucket++) {
+          os << " " << hashed_->set.bucket_size(bucket);
+        }
+      }
+      else {
+        os << " array";
+      }
+      os << "\n";
+    }
+
+  private:
+    struct key_less {
+      bool
+      operator()(const trie* a, const trie* b) const
+      {
+        return a->key_ < b->key_;
+      }
+    };
+
+    struct hashed_children {
+      explicit hashed_children(size_t count)
+        : bucketCount(count)
+        , buckets(new bucket_type[bucketCount])
+        , set(bucket_traits(buckets.get(), bucketCount))
+      {
+      }
+
+      void
+      rehash(size_t count)
+      {
+        std::unique_ptr<bucket_type[]> newBuckets(new bucket_type[count]);
+        set.rehash(bucket_traits(newBuckets.get(), count));
+        buckets.swap(newBuckets);
+        bucketCount = count;
+      }
+
+      size_t bucketCount;
+      std::unique_ptr<bucket_type[]> buckets; // must outlive the set
+      unordered_set set;
+    };
+
+    std::vector<trie*> array_;
+    std::unique_ptr<hashed_children> hashed_;
+  };
+
   template<class T, class NonConstT>
   friend class trie_iterator;
 
@@ -502,43 +781,41 @@ private:
   // Actual data
   ////////////////////////////////////////////////
 
-  Key key_; ///< name component
-
-  size_t initialBucketSize_;
-  size_t bucketIncrement_;
-
-  size_t bucketSize_;
-  typedef boost::interprocess::unique_ptr<bucket_type, array_disposer<bucket_type>> buckets_array;
-  buckets_array buckets_;
-  unordered_set children_;
+  Key key_;           ///< first name component of the label
+  key_suffix suffix_; ///< other name components of the label
+  children_container children_;
 
   typename PayloadTraits::storage_type payload_;
   trie* parent_; // to make cleaning effective
 };
 
+template<typename FullKey, typename PayloadTraits, typename PolicyHook>
+const size_t trie<FullKey, PayloadTraits, PolicyHook>::max_array_children;
+
 template<typename FullKey, typename PayloadTraits, typename PolicyHook>
 inline std::ostream&
 operator<<(std::ostream& os, const trie<FullKey, PayloadTraits, PolicyHook>& trie_node)
 {
-  os << "# " << trie_node.key_ << ((trie_node.payload_ != PayloadTraits::empty_payload) ? "*" : "")
-     << std::endl;
+  os << "# " << trie_node.key_;
+  for (const auto& component : trie_node.suffix_) {
+    os << "/" << component;
+  }
+  os << ((trie_node.payload_ != PayloadTraits::empty_payload) ? "*" : "") << std::endl;
   typedef trie<FullKey, PayloadTraits, PolicyHook> trie;
 
-  for (typename trie::unordered_set::const_iterator subnode = trie_node.children_.begin();
-       subnode != trie_node.children_.end(); subnode++)
-  // BOOST_FOREACH (const trie &subnode, trie_node.children_)
-  {
+  for (const trie* subnode = trie_node.children_.first(); subnode != 0;
+       subnode = trie_node.children_.next(*subnode)) {
     os << "\"" << &trie_node << "\""
        << " [label=\"" << trie_node.key_
        << ((trie_node.payload_ != PayloadTraits::empty_payload) ? "*" : "") << "\"]\n";
-    os << "\"" << &(*subnode) << "\""
+    os << "\"" << subnode << "\""
        << " [label=\"" << subnode->key_
        << ((subnode->payload_ != PayloadTraits::empty_payload) ? "*" : "") << "\"]"
-                                                                              "\n";
+                                                                             "\n";
 
     os << "\"" << &trie_node << "\""
        << " -> "
-       << "\"" << &(*subnode) << "\""
+       << "\"" << subnode << "\""
        << "\n";
     os << *subnode;
   }
@@ -552,16 +829,9 @@ trie<FullKey, PayloadTraits, PolicyHook>::PrintStat(std::ostream& os) const
 {
   os << "# " << key_ << ((payload_ != PayloadTraits::empty_payload) ? "*" : "") << ": "
      << children_.size() << " children" << std::endl;
-  for (size_t bucket = 0, maxbucket = children_.bucket_count(); bucket < maxbucket; bucket++) {
-    os << " " << children_.bucket_size(bucket);
-  }
-  os << "\n";
+  children_.PrintStat(os);
 
-  typedef trie<FullKey, PayloadTraits, PolicyHook> trie;
-  for (typename trie::unordered_set::const_iterator subnode = children_.begin();
-       subnode != children_.end(); subnode++)
-  // BOOST_FOREACH (const trie &subnode, children_)
-  {
+  for (const trie* subnode = children_.first(); subnode != 0; subnode = children_.next(*subnode)) {
     subnode->PrintStat(os);
   }
 }
@@ -578,7 +848,7 @@ template<typename FullKey, typename PayloadTraits, typename PolicyHook>
 inline std::size_t
 hash_value(const trie<FullKey, PayloadTraits, PolicyHook>& trie_node)
 {
-  return boost::hash_value(trie_node.key_);
+  return trie<FullKey, PayloadTraits, PolicyHook>::hash_key(trie_node.key_);
 }
 
 template<class Trie, class NonConstTrie> // hack for boost < 1.47
@@ -637,8 +907,9 @@ public:
   trie_iterator<Trie, NonConstTrie>&
   operator++(int)
   {
-    if (trie_->children_.size() > 0)
-      trie_ = &(*trie_->children_.begin());
+    Trie* child = trie_->children_.first();
+    if (child != 0)
+      trie_ = child;
     else
       trie_ = goUp();
     return *this;
@@ -652,28 +923,17 @@ public:
   }
 
 private:
-  typedef typename boost::mpl::if_<boost::is_same<Trie, NonConstTrie>,
-                                   typename Trie::unordered_set::iterator,
-                                   typename Trie::unordered_set::const_iterator>::type set_iterator;
-
   Trie*
   goUp()
   {
-    if (trie_->parent_ != 0) {
-      // typename Trie::unordered_set::iterator item =
-      set_iterator item = const_cast<NonConstTrie*>(trie_)
-                            ->parent_->children_.iterator_to(const_cast<NonConstTrie&>(*trie_));
-      item++;
-      if (item != trie_->parent_->children_.end()) {
-        return &(*item);
-      }
-      else {
-        trie_ = trie_->parent_;
-        return goUp();
+    while (trie_->parent_ != 0) {
+      Trie* sibling = trie_->parent_->children_.next(*trie_);
+      if (sibling != 0) {
+        return sibling;
       }
+      trie_ = trie_->parent_;
     }
-    else
-      return 0;
+    return 0;
   }
 
 private:
@@ -682,11 +942,6 @@ private:
 
 template<class Trie>
 class trie_point_iterator {
-private:
-  typedef typename boost::mpl::if_<boost::is_same<Trie, const Trie>,
-                                   typename Trie::unordered_set::const_iterator,
-                                   typename Trie::unordered_set::iterator>::type set_iterator;
-
 public:
   trie_point_iterator()
     : trie_(0)
@@ -697,11 +952,8 @@ public:
   {
   }
   trie_point_iterator(Trie& item)
+    : trie_(item.children_.first())
   {
-    if (item.children_.size() != 0)
-      trie_ = &*item.children_.begin();
-    else
-      trie_ = 0;
   }
 
   Trie& operator*()
@@ -744,17 +996,10 @@ public:
   trie_point_iterator<Trie>&
   operator++(int)
   {
-    if (trie_->parent_ != 0) {
-      set_iterator item = trie_->parent_->children_.iterator_to(*trie_);
-      item++;
-      if (item == trie_->parent_->children_.end())
-        trie_ = 0;
-      else
-        trie_ = &*item;
-    }
-    else {
+    if (trie_->parent_ != 0)
+      trie_ = trie_->parent_->children_.next(*trie_);
+    else
       trie_ = 0;
-    }
     return *this;
   }
 